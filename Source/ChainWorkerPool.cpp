@@ -0,0 +1,156 @@
+//================================================================================
+// File: ChainWorkerPool.cpp
+//================================================================================
+#include "ChainWorkerPool.h"
+#include "TraceRecorder.h"
+#include "RealtimeGuard.h"
+#include <thread>
+
+#if JUCE_INTEL
+ #include <emmintrin.h>
+#endif
+
+namespace
+{
+    inline void spinPause() noexcept
+    {
+#if JUCE_INTEL
+        _mm_pause();
+#else
+        std::this_thread::yield();
+#endif
+    }
+}
+
+//==============================================================================
+class ChainWorkerPool::Worker : public juce::Thread
+{
+public:
+    Worker(ChainWorkerPool& p, int index)
+        : juce::Thread("Tessera Chain Worker " + juce::String(index + 1)), pool(p) {}
+
+    void run() override
+    {
+        TraceRecorder::nameCurrentThread("Chain Worker");
+        juce::uint32 seenBatch = pool.batchCounter.load(std::memory_order_acquire);
+        int idleSpins = 0;
+
+        while (!threadShouldExit())
+        {
+            const auto batch = pool.batchCounter.load(std::memory_order_acquire);
+            if (batch != seenBatch)
+            {
+                seenBatch = batch;
+                idleSpins = 0;
+                while (pool.runNextJob()) {}
+                continue;
+            }
+
+            // The next block usually arrives within a few milliseconds: spin a little, then sleep.
+            if (++idleSpins < maxIdleSpins)
+            {
+                spinPause();
+                continue;
+            }
+
+            sleeping.store(true);
+            if (pool.batchCounter.load() == seenBatch)
+                wakeEvent.wait(sleepTimeoutMs);
+            sleeping.store(false);
+            idleSpins = 0;
+        }
+    }
+
+    void wakeIfSleeping() noexcept
+    {
+        if (sleeping.load())
+            wakeEvent.signal();
+    }
+
+    void wakeForExit()
+    {
+        signalThreadShouldExit();
+        wakeEvent.signal();
+    }
+
+private:
+    static constexpr int maxIdleSpins = 4000;
+    static constexpr int sleepTimeoutMs = 100;
+
+    ChainWorkerPool& pool;
+    juce::WaitableEvent wakeEvent;
+    std::atomic<bool> sleeping{ false };
+};
+
+//==============================================================================
+ChainWorkerPool::ChainWorkerPool(int numWorkers)
+{
+    for (int i = 0; i < numWorkers; ++i)
+        workers.push_back(std::make_unique<Worker>(*this, i));
+}
+
+ChainWorkerPool::~ChainWorkerPool()
+{
+    stop();
+}
+
+void ChainWorkerPool::start()
+{
+    if (running.exchange(true)) return;
+
+    for (auto& worker : workers)
+        if (!worker->startRealtimeThread(juce::Thread::RealtimeOptions{}.withPriority(10)))
+            worker->startThread(juce::Thread::Priority::highest);
+}
+
+void ChainWorkerPool::stop()
+{
+    if (!running.exchange(false)) return;
+
+    for (auto& worker : workers)
+        worker->wakeForExit();
+    for (auto& worker : workers)
+        worker->stopThread(1000);
+}
+
+void ChainWorkerPool::runJobs(int numJobs, JobFunction function, void* context) noexcept
+{
+    if (numJobs <= 0) return;
+
+    if (numJobs == 1 || workers.empty() || !running.load(std::memory_order_relaxed))
+    {
+        for (int i = 0; i < numJobs; ++i)
+            function(context, i);
+        return;
+    }
+
+    jobFunction = function;
+    jobContext = context;
+    jobsRemaining.store(numJobs, std::memory_order_relaxed);
+    jobsToClaim.store(numJobs, std::memory_order_release);
+    batchCounter.fetch_add(1, std::memory_order_acq_rel);
+
+    for (auto& worker : workers)
+        worker->wakeIfSleeping();
+
+    while (runNextJob()) {}
+
+    // Join: wait for the jobs other threads claimed.
+    while (jobsRemaining.load(std::memory_order_acquire) > 0)
+        spinPause();
+}
+
+bool ChainWorkerPool::runNextJob() noexcept
+{
+    // A late decrement from a finished batch only drives the counter further below zero.
+    const int claimed = jobsToClaim.fetch_sub(1, std::memory_order_acq_rel);
+    if (claimed <= 0)
+        return false;
+
+    {
+        const RealtimeGuard::ScopedRealtime realtimeScope; // Workers run audio work too
+        jobFunction(jobContext, claimed - 1);
+    }
+    jobsRemaining.fetch_sub(1, std::memory_order_acq_rel);
+    return true;
+}
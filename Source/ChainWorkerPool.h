@@ -0,0 +1,58 @@
+//================================================================================
+// File: ChainWorkerPool.h
+//================================================================================
+#pragma once
+#include <juce_core/juce_core.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/**
+ * Small pool of realtime worker threads that lets the audio thread spread independent parts of
+ * the chain (parallel branches) over several cores.
+ *
+ * run() is called from the audio thread. It hands out job indices through an atomic counter,
+ * works through them itself alongside the workers, and returns only once every job has finished.
+ * The caller's join therefore never depends on how the jobs were scheduled. Workers spin briefly
+ * after each batch and then sleep. Waking a sleeping worker is the only non-lock-free step on the
+ * audio thread (WaitableEvent::signal), and it only happens after an idle period.
+ */
+class ChainWorkerPool
+{
+public:
+    explicit ChainWorkerPool(int numWorkers);
+    ~ChainWorkerPool();
+
+    // Starts/stops the worker threads. Not realtime safe; call from prepareToPlay or the destructor.
+    void start();
+    void stop();
+    int getNumWorkers() const noexcept { return (int)workers.size(); }
+
+    // Calls fn(0) .. fn(numJobs - 1), spread over the calling thread and the workers, and returns
+    // when all of them have completed. With no running workers the jobs run in order on the caller.
+    template <typename Function>
+    void run(int numJobs, Function& fn) noexcept
+    {
+        runJobs(numJobs, [](void* context, int index) { (*static_cast<Function*>(context))(index); }, &fn);
+    }
+
+private:
+    using JobFunction = void (*)(void* context, int index);
+    class Worker;
+
+    void runJobs(int numJobs, JobFunction function, void* context) noexcept;
+    bool runNextJob() noexcept;
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::atomic<bool> running{ false };
+
+    // The current batch. The function/context are written before jobsToClaim is published and only
+    // read by a thread that has claimed a job, so they need no synchronisation of their own.
+    JobFunction jobFunction = nullptr;
+    void* jobContext = nullptr;
+    std::atomic<int> jobsToClaim{ 0 };   // Counts down; a thread owns job (value - 1) when it claims a positive value
+    std::atomic<int> jobsRemaining{ 0 }; // Jobs not yet finished
+    std::atomic<juce::uint32> batchCounter{ 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ChainWorkerPool)
+};
@@ -51,6 +51,13 @@ namespace DSPUtils
 
         void setType(NoiseType newType) { type = newType; }
 
+        // Restarts the sequence from a fixed seed (deterministic renders) and clears the pink filter.
+        void setSeed(juce::uint32 seed)
+        {
+            randomEngine.seed(seed);
+            std::fill(pinkState.begin(), pinkState.end(), 0.0f);
+        }
+
         float getNextSample()
         {
             if (type == NoiseType::White)
@@ -0,0 +1,96 @@
+//================================================================================
+// File: DSP_Helpers/FrameWorker.cpp
+//================================================================================
+#include "FrameWorker.h"
+#include "../TraceRecorder.h"
+#include "../RealtimeGuard.h"
+
+//==============================================================================
+FrameWorker::Job::Job(Function fn, void* ctx)
+    : function(fn), context(ctx)
+{
+    worker->addJob(this);
+}
+
+FrameWorker::Job::~Job()
+{
+    worker->removeJob(this);
+}
+
+void FrameWorker::Job::submit() noexcept
+{
+    jassert(state.load() == idle); // finish() the previous frame first
+    state.store(queued, std::memory_order_release);
+    worker->wake();
+}
+
+void FrameWorker::Job::finish() noexcept
+{
+    if (state.load(std::memory_order_acquire) == idle)
+        return;
+
+    // Still queued: the worker is late, so run the frame here.
+    if (!tryRun())
+        while (state.load(std::memory_order_acquire) != done)
+            juce::Thread::yield();
+
+    state.store(idle, std::memory_order_release);
+}
+
+bool FrameWorker::Job::tryRun() noexcept
+{
+    int expected = queued;
+    if (!state.compare_exchange_strong(expected, running, std::memory_order_acq_rel))
+        return false;
+
+    {
+        const RealtimeGuard::ScopedRealtime realtimeScope; // The audio thread may be waiting for it
+        function(context);
+    }
+    state.store(done, std::memory_order_release);
+    return true;
+}
+
+//==============================================================================
+FrameWorker::FrameWorker()
+    : juce::Thread("Tessera Frame Worker")
+{
+    startThread(juce::Thread::Priority::high);
+}
+
+FrameWorker::~FrameWorker()
+{
+    signalThreadShouldExit();
+    wakeEvent.signal();
+    stopThread(2000);
+}
+
+void FrameWorker::addJob(Job* job)
+{
+    const juce::ScopedLock sl(jobsLock);
+    jobs.addIfNotAlreadyThere(job);
+}
+
+void FrameWorker::removeJob(Job* job)
+{
+    const juce::ScopedLock sl(jobsLock);
+    jobs.removeFirstMatchingValue(job);
+}
+
+void FrameWorker::wake() noexcept
+{
+    wakeEvent.signal();
+}
+
+void FrameWorker::run()
+{
+    TraceRecorder::nameCurrentThread("Frame Worker");
+    while (!threadShouldExit())
+    {
+        wakeEvent.wait(50);
+
+        const juce::ScopedLock sl(jobsLock);
+        for (auto* job : jobs)
+            job->tryRun();
+    }
+}
@@ -0,0 +1,63 @@
+//================================================================================
+// File: DSP_Helpers/FrameWorker.h
+//================================================================================
+#pragma once
+#include <juce_core/juce_core.h>
+#include <juce_events/juce_events.h>
+#include <atomic>
+
+/**
+ * One background thread, shared by every spectral engine in the process, that runs STFT frames
+ * off the audio thread.
+ *
+ * An engine owns a Job. When a frame is complete, the audio thread fills the job's buffers and
+ * calls submit(). One hop later it calls finish() and overlap-adds the result. If the worker has
+ * not got to the job by then, finish() runs it on the calling thread, so the output is identical
+ * either way and only the CPU spike moves. submit() wakes the worker through a WaitableEvent,
+ * which is the only step that is not lock-free.
+ */
+class FrameWorker : private juce::Thread
+{
+public:
+    class Job
+    {
+    public:
+        using Function = void (*)(void* context);
+
+        // The function is called with the context on whichever thread runs the job. Declare the
+        // Job after everything the function touches: its destructor waits for a run in progress.
+        Job(Function function, void* context);
+        ~Job();
+
+        void submit() noexcept;
+        void finish() noexcept;
+        bool isPending() const noexcept { return state.load(std::memory_order_acquire) != idle; }
+
+    private:
+        friend class FrameWorker;
+        bool tryRun() noexcept;
+
+        enum : int { idle, queued, running, done };
+        std::atomic<int> state{ idle };
+        const Function function;
+        void* const context;
+        juce::SharedResourcePointer<FrameWorker> worker;
+
+        JUCE_DECLARE_NON_COPYABLE(Job)
+    };
+
+    FrameWorker();
+    ~FrameWorker() override;
+
+private:
+    void run() override;
+    void addJob(Job* job);
+    void removeJob(Job* job);
+    void wake() noexcept;
+
+    juce::CriticalSection jobsLock; // Held by the worker while it scans and runs jobs
+    juce::Array<Job*> jobs;
+    juce::WaitableEvent wakeEvent;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FrameWorker)
+};
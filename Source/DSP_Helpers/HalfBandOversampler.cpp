@@ -0,0 +1,294 @@
+//================================================================================
+// File: DSP_Helpers/HalfBandOversampler.cpp
+//================================================================================
+#include "HalfBandOversampler.h"
+#include <cmath>
+
+// juce_dsp includes the intrinsics headers whenever JUCE_USE_SIMD is on.
+#if JUCE_USE_SIMD && (defined(__SSE2__) || defined(_M_X64) || defined(__amd64__))
+ #define TESSERA_HALFBAND_SSE 1
+#elif JUCE_USE_SIMD && (defined(__ARM_NEON__) || defined(__ARM_NEON))
+ #define TESSERA_HALFBAND_NEON 1
+#endif
+
+namespace
+{
+    // Dot product of two unaligned float arrays; the hot loop of both polyphase branches.
+    inline float dotProduct(const float* a, const float* b, int n) noexcept
+    {
+        int i = 0;
+        float sum = 0.0f;
+#if TESSERA_HALFBAND_SSE
+        __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+        for (; i + 8 <= n; i += 8)
+        {
+            acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+            acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4)));
+        }
+        for (; i + 4 <= n; i += 4)
+            acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, _mm_add_ps(acc0, acc1));
+        sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#elif TESSERA_HALFBAND_NEON
+        float32x4_t acc0 = vdupq_n_f32(0.0f), acc1 = vdupq_n_f32(0.0f);
+        for (; i + 8 <= n; i += 8)
+        {
+            acc0 = vmlaq_f32(acc0, vld1q_f32(a + i), vld1q_f32(b + i));
+            acc1 = vmlaq_f32(acc1, vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+        }
+        for (; i + 4 <= n; i += 4)
+            acc0 = vmlaq_f32(acc0, vld1q_f32(a + i), vld1q_f32(b + i));
+        float32x4_t acc = vaddq_f32(acc0, acc1);
+        sum = (vgetq_lane_f32(acc, 0) + vgetq_lane_f32(acc, 1)) + (vgetq_lane_f32(acc, 2) + vgetq_lane_f32(acc, 3));
+#endif
+        for (; i < n; ++i)
+            sum += a[i] * b[i];
+        return sum;
+    }
+
+    // Zeroth-order modified Bessel function of the first kind (Kaiser window).
+    double besselI0(double x)
+    {
+        double sum = 1.0, term = 1.0;
+        const double halfX = x * 0.5;
+        for (int k = 1; k < 64; ++k)
+        {
+            term *= (halfX / k) * (halfX / k);
+            sum += term;
+            if (term < sum * 1.0e-12) break;
+        }
+        return sum;
+    }
+}
+
+//==============================================================================
+// One 2x half-band stage. With K non-zero taps per side, the full filter has 4K-1 taps centred
+// on tap 2K-1 (value 0.5); every other tap is zero. Both directions then reduce to one 2K-tap
+// dot product per input (up) or output (down) sample plus a pure delay on the other phase.
+//==============================================================================
+class HalfBandOversampler::FIRStage
+{
+public:
+    FIRStage(int channels, FIRSpec spec)
+    {
+        // Kaiser estimate; the transition width at the stage's 2x rate is half the spec value.
+        const double attenuation = juce::jmax(21.0, (double)spec.stopbandDb);
+        const double deltaF = juce::jmax(0.005, (double)spec.transitionWidth * 0.5);
+        const double beta = attenuation > 50.0 ? 0.1102 * (attenuation - 8.7)
+                                               : 0.5842 * std::pow(attenuation - 21.0, 0.4) + 0.07886 * (attenuation - 21.0);
+        const int estimatedLength = (int)std::ceil((attenuation - 7.95) / (14.36 * deltaF)) + 1;
+
+        halfLength = juce::jmax(2, (estimatedLength + 4) / 4);
+        if (halfLength % 2 != 0) ++halfLength; // Keep the dot product a multiple of 4 wide
+        windowLength = 2 * halfLength;
+
+        const int centre = 2 * halfLength - 1;
+        const double i0Beta = besselI0(beta);
+        std::vector<double> taps((size_t)halfLength);
+        double sum = 0.0;
+        for (int j = 0; j < halfLength; ++j)
+        {
+            const int d = 2 * j + 1;
+            const double x = (double)d / (double)centre;
+            const double window = besselI0(beta * std::sqrt(juce::jmax(0.0, 1.0 - x * x))) / i0Beta;
+            const double sinc = std::sin(juce::MathConstants<double>::halfPi * d) / (juce::MathConstants<double>::pi * d);
+            taps[(size_t)j] = sinc * window;
+            sum += taps[(size_t)j];
+        }
+
+        // Both sides together sum to 0.5, plus the 0.5 centre tap: unity gain at DC.
+        coeffs.assign((size_t)windowLength, 0.0f);
+        for (int j = 0; j < halfLength; ++j)
+        {
+            const float c = (float)(taps[(size_t)j] * 0.25 / sum);
+            coeffs[(size_t)(halfLength + j)] = c;
+            coeffs[(size_t)(halfLength - 1 - j)] = c;
+        }
+
+        upHistory.resize((size_t)channels);
+        downEven.resize((size_t)channels);
+        downOdd.resize((size_t)channels);
+        for (auto* lines : { &upHistory, &downEven, &downOdd })
+            for (auto& h : *lines)
+                h.data.assign((size_t)(2 * windowLength), 0.0f);
+    }
+
+    void prepare(int maxInputSamples)
+    {
+        upBuffer.setSize((int)upHistory.size(), maxInputSamples * 2, false, true);
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        for (auto* lines : { &upHistory, &downEven, &downOdd })
+            for (auto& h : *lines)
+            {
+                std::fill(h.data.begin(), h.data.end(), 0.0f);
+                h.last = 0;
+            }
+        upBuffer.clear();
+    }
+
+    juce::dsp::AudioBlock<float> getUpBlock(size_t numSamples) noexcept
+    {
+        return juce::dsp::AudioBlock<float>(upBuffer).getSubBlock(0, numSamples);
+    }
+
+    juce::dsp::AudioBlock<float> processUp(const juce::dsp::AudioBlock<const float>& input) noexcept
+    {
+        const int numSamples = (int)input.getNumSamples();
+        const int channels = juce::jmin((int)input.getNumChannels(), (int)upHistory.size());
+        jassert(numSamples * 2 <= upBuffer.getNumSamples());
+
+        for (int ch = 0; ch < channels; ++ch)
+        {
+            const float* in = input.getChannelPointer((size_t)ch);
+            float* out = upBuffer.getWritePointer(ch);
+            auto& history = upHistory[(size_t)ch];
+
+            for (int n = 0; n < numSamples; ++n)
+            {
+                const float* w = history.push(in[n], windowLength);
+                out[2 * n] = 2.0f * dotProduct(w, coeffs.data(), windowLength);
+                out[2 * n + 1] = w[halfLength];
+            }
+        }
+        return getUpBlock((size_t)numSamples * 2).getSubsetChannelBlock(0, (size_t)channels);
+    }
+
+    void processDown(const juce::dsp::AudioBlock<float>& input, juce::dsp::AudioBlock<float>& output) noexcept
+    {
+        const int numSamples = (int)output.getNumSamples();
+        const int channels = juce::jmin((int)output.getNumChannels(), (int)input.getNumChannels(), (int)downEven.size());
+        jassert((int)input.getNumSamples() >= numSamples * 2);
+
+        for (int ch = 0; ch < channels; ++ch)
+        {
+            const float* in = input.getChannelPointer((size_t)ch);
+            float* out = output.getChannelPointer((size_t)ch);
+            auto& even = downEven[(size_t)ch];
+            auto& odd = downOdd[(size_t)ch];
+
+            for (int n = 0; n < numSamples; ++n)
+            {
+                const float* we = even.push(in[2 * n], windowLength);
+                const float* wo = odd.push(in[2 * n + 1], windowLength);
+                out[n] = dotProduct(we, coeffs.data(), windowLength) + 0.5f * wo[halfLength - 1];
+            }
+        }
+    }
+
+    // Round trip (up + down) in samples at the stage's input rate.
+    int getLatencyInSamples() const noexcept { return 2 * halfLength - 1; }
+
+private:
+    // Mirrored delay line: each sample is written twice, so the latest windowLength samples are
+    // always contiguous (oldest first) and can be fed straight to dotProduct().
+    struct History
+    {
+        std::vector<float> data;
+        int last = 0;
+
+        const float* push(float x, int length) noexcept
+        {
+            last = last + 1 < length ? last + 1 : 0;
+            data[(size_t)last] = x;
+            data[(size_t)(last + length)] = x;
+            return data.data() + last + 1;
+        }
+    };
+
+    int halfLength = 0, windowLength = 0;
+    std::vector<float> coeffs;
+    std::vector<History> upHistory, downEven, downOdd;
+    juce::AudioBuffer<float> upBuffer;
+};
+
+//==============================================================================
+HalfBandOversampler::HalfBandOversampler(int channels, int stages)
+    : numChannels(channels), numStages(stages)
+{
+    iir = std::make_unique<juce::dsp::Oversampling<float>>((size_t)numChannels, (size_t)numStages,
+        juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR, false);
+}
+
+HalfBandOversampler::HalfBandOversampler(int channels, int stages, FIRSpec firstStage, FIRSpec laterStages)
+    : numChannels(channels), numStages(stages)
+{
+    for (int s = 0; s < numStages; ++s)
+        firStages.push_back(std::make_unique<FIRStage>(numChannels, s == 0 ? firstStage : laterStages));
+}
+
+HalfBandOversampler::~HalfBandOversampler() = default;
+
+void HalfBandOversampler::initProcessing(size_t maximumNumberOfSamplesBeforeOversampling)
+{
+    if (iir)
+    {
+        iir->initProcessing(maximumNumberOfSamplesBeforeOversampling);
+        return;
+    }
+    for (int s = 0; s < numStages; ++s)
+        firStages[(size_t)s]->prepare((int)maximumNumberOfSamplesBeforeOversampling << s);
+}
+
+void HalfBandOversampler::reset() noexcept
+{
+    if (iir) iir->reset();
+    for (auto& stage : firStages)
+        stage->reset();
+}
+
+juce::dsp::AudioBlock<float> HalfBandOversampler::processSamplesUp(const juce::dsp::AudioBlock<const float>& inputBlock) noexcept
+{
+    if (iir)
+        return iir->processSamplesUp(inputBlock);
+
+    juce::dsp::AudioBlock<const float> stageInput = inputBlock;
+    juce::dsp::AudioBlock<float> stageOutput;
+    for (auto& stage : firStages)
+    {
+        stageOutput = stage->processUp(stageInput);
+        stageInput = stageOutput;
+    }
+    return stageOutput;
+}
+
+void HalfBandOversampler::processSamplesDown(juce::dsp::AudioBlock<float>& outputBlock) noexcept
+{
+    if (iir)
+    {
+        iir->processSamplesDown(outputBlock);
+        return;
+    }
+
+    // Each stage reads its own up buffer (processed in place by the caller for the last stage)
+    // and writes into the previous stage's up buffer, or the caller's block for the first stage.
+    const size_t numSamples = outputBlock.getNumSamples();
+    for (int s = numStages - 1; s >= 0; --s)
+    {
+        auto input = firStages[(size_t)s]->getUpBlock(numSamples << (s + 1));
+        if (s > 0)
+        {
+            auto output = firStages[(size_t)(s - 1)]->getUpBlock(numSamples << s);
+            firStages[(size_t)s]->processDown(input, output);
+        }
+        else
+        {
+            firStages[0]->processDown(input, outputBlock);
+        }
+    }
+}
+
+float HalfBandOversampler::getLatencyInSamples() const noexcept
+{
+    if (iir)
+        return iir->getLatencyInSamples();
+
+    float latency = 0.0f;
+    for (int s = 0; s < numStages; ++s)
+        latency += (float)firStages[(size_t)s]->getLatencyInSamples() / (float)(1 << s);
+    return latency;
+}
@@ -0,0 +1,57 @@
+//================================================================================
+// File: DSP_Helpers/HalfBandOversampler.h
+//================================================================================
+#pragma once
+#include <juce_dsp/juce_dsp.h>
+#include <memory>
+#include <vector>
+
+/**
+ * Cascade of 2x half-band stages, used for every oversampled part of the chain.
+ *
+ * FIR: linear-phase Kaiser-windowed half-band filters in polyphase form. Only the non-zero taps
+ * are convolved and the convolution is SIMD-vectorised over the taps. The first stage does the
+ * real anti-aliasing work and takes its own spec; later stages run at higher rates with a much
+ * wider transition band, so they need only a few taps.
+ *
+ * IIR: delegates to juce::dsp::Oversampling's polyphase IIR (minimum phase, lowest latency).
+ *
+ * The API mirrors juce::dsp::Oversampling: processSamplesUp() returns a block owned by the
+ * oversampler that the caller processes in place before calling processSamplesDown().
+ */
+class HalfBandOversampler
+{
+public:
+    struct FIRSpec
+    {
+        float transitionWidth; // Normalised to the stage's input sample rate (0..1)
+        float stopbandDb;      // Stopband attenuation, positive dB
+    };
+
+    // Polyphase IIR cascade.
+    HalfBandOversampler(int numChannels, int numStages);
+    // Linear-phase FIR cascade.
+    HalfBandOversampler(int numChannels, int numStages, FIRSpec firstStage, FIRSpec laterStages);
+    ~HalfBandOversampler();
+
+    void initProcessing(size_t maximumNumberOfSamplesBeforeOversampling);
+    void reset() noexcept;
+
+    juce::dsp::AudioBlock<float> processSamplesUp(const juce::dsp::AudioBlock<const float>& inputBlock) noexcept;
+    void processSamplesDown(juce::dsp::AudioBlock<float>& outputBlock) noexcept;
+
+    size_t getOversamplingFactor() const noexcept { return (size_t)1 << numStages; }
+
+    // Exact round-trip group delay in host-rate samples (fractional for later FIR stages).
+    float getLatencyInSamples() const noexcept;
+
+private:
+    class FIRStage;
+
+    const int numChannels;
+    const int numStages;
+    std::unique_ptr<juce::dsp::Oversampling<float>> iir;
+    std::vector<std::unique_ptr<FIRStage>> firStages;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(HalfBandOversampler)
+};
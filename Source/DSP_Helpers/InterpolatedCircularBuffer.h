@@ -41,7 +41,7 @@ public:
             for (int ch = 0; ch < numChannels; ++ch)
             {
                 if (ch < blockChannels)
-                    buffer.setSample(ch, writePos, block.getSample(ch, i));
+                    setSampleAtWritePosition(ch, block.getSample(ch, i));
             }
 
             advanceWritePosition();
@@ -52,19 +52,16 @@ public:
     void writeSample(int channel, float sampleValue)
     {
         if (juce::isPositiveAndBelow(channel, numChannels))
-            buffer.setSample(channel, writePos, sampleValue);
+            setSampleAtWritePosition(channel, sampleValue);
     }
 
     // NEW: Advances the write head for all channels. Call this once per sample frame.
     void advanceWritePosition()
     {
         writePos++;
-        // Handle wraparound and update margins
+        // Handle wraparound (the margins are kept current by every write)
         if (writePos >= bufferSize + INTERP_MARGIN)
-        {
             writePos = INTERP_MARGIN;
-            updateMargins();
-        }
     }
 
     // Read interpolated sample at a fractional position (relative to logical buffer bounds [0, bufferSize))
@@ -112,6 +109,17 @@ public:
     }
 
 private:
+    // Writes at the write head and mirrors the sample into the margin that aliases it, so reads
+    // across the wrap point always see current data.
+    void setSampleAtWritePosition(int channel, float sampleValue)
+    {
+        buffer.setSample(channel, writePos, sampleValue);
+        if (writePos < INTERP_MARGIN * 2)
+            buffer.setSample(channel, writePos + bufferSize, sampleValue); // Start of the buffer -> end margin
+        else if (writePos >= bufferSize)
+            buffer.setSample(channel, writePos - bufferSize, sampleValue); // End of the buffer -> start margin
+    }
+
     // Updates the margins by copying data from the opposite end of the buffer.
     void updateMargins()
     {
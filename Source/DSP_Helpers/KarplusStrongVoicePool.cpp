@@ -0,0 +1,445 @@
+//================================================================================
+// File: DSP_Helpers/KarplusStrongVoicePool.cpp
+//================================================================================
+#include "KarplusStrongVoicePool.h"
+#include <algorithm>
+#include <cmath>
+
+// juce_dsp includes the intrinsics headers whenever JUCE_USE_SIMD is on.
+#if JUCE_USE_SIMD && (defined(__SSE2__) || defined(_M_X64) || defined(__amd64__))
+ #define TESSERA_KS_SSE 1
+#elif JUCE_USE_SIMD && (defined(__ARM_NEON__) || defined(__ARM_NEON))
+ #define TESSERA_KS_NEON 1
+#endif
+
+namespace
+{
+    constexpr int lanesPerRegister = 4;
+    constexpr int numTaps = 4;
+    constexpr float retireLevel = 1.0e-5f; // -100 dB: a voice quieter than this (and no longer excited) is freed
+    constexpr float outputScale = 0.8f;
+
+    // Same design as IIR::Coefficients<float>::makeAllPass (Q = 1/sqrt 2), in float as it was.
+    void makeAllPass(double sampleRate, float frequency, float& b0, float& b1) noexcept
+    {
+        const float n = 1.0f / std::tan(juce::MathConstants<float>::pi * frequency / (float)sampleRate);
+        const float nSquared = n * n;
+        const float invQ = juce::MathConstants<float>::sqrt2;
+        const float c1 = 1.0f / (1.0f + invQ * n + nSquared);
+        b0 = c1 * (1.0f - n * invQ + nSquared);
+        b1 = c1 * 2.0f * (1.0f - nSquared);
+    }
+}
+
+void KarplusStrongVoicePool::prepare(double newSampleRate, int newNumChannels, int maxDelaySamples)
+{
+    sampleRate = newSampleRate;
+    numChannels = juce::jmax(0, newNumChannels);
+    maxDelay = juce::jmax(1, maxDelaySamples);
+
+    // The Lagrange read spans four rows, the deepest maxDelay + 2 back.
+    const int numRows = juce::nextPowerOfTwo(maxDelay + numTaps);
+    rowMask = numRows - 1;
+    delayMemory.assign((size_t)numChannels, std::vector<float>((size_t)(numRows * maxVoices), 0.0f));
+    for (auto* state : { &lowpassState, &allpass1State1, &allpass1State2, &allpass2State1, &allpass2State2, &feedback })
+        state->assign((size_t)(numChannels * maxVoices), 0.0f);
+
+    cutoff = dispersionAmount = -1.0f; // Forces the next setParameters() to compute the filters
+    reset();
+}
+
+void KarplusStrongVoicePool::reset() noexcept
+{
+    for (auto& memory : delayMemory)
+        std::fill(memory.begin(), memory.end(), 0.0f);
+    for (auto* state : { &lowpassState, &allpass1State1, &allpass1State2, &allpass2State1, &allpass2State2, &feedback })
+        std::fill(state->begin(), state->end(), 0.0f);
+
+    voices.fill({});
+    for (auto* lane : { &delay, &targetDelay, &stepDelay, &inputGain, &inputDecay, &loopGain, &level, &mask, &releaseGain, &peak })
+        lane->fill(0.0f);
+    writeRow = 0;
+    gliding = false;
+}
+
+float KarplusStrongVoicePool::computeDelay(float frequencyHz) const noexcept
+{
+    const float clamped = juce::jlimit(20.0f, (float)sampleRate * 0.45f, frequencyHz);
+    return juce::jlimit(1.0f, (float)maxDelay, (float)sampleRate / clamped - phaseDelay);
+}
+
+void KarplusStrongVoicePool::setParameters(float cutoffHz, float dispersion, float newFeedbackGain) noexcept
+{
+    bool filtersChanged = false;
+
+    if (cutoffHz != cutoff)
+    {
+        // As FirstOrderTPTFilter: g in double, G in float.
+        cutoff = cutoffHz;
+        const auto g = (float)std::tan(juce::MathConstants<double>::pi * juce::jlimit(1.0f, (float)sampleRate * 0.499f, cutoff) / sampleRate);
+        lowpassG = g / (1.0f + g);
+        filtersChanged = true;
+    }
+
+    if (dispersion != dispersionAmount)
+    {
+        dispersionAmount = dispersion;
+        makeAllPass(sampleRate, juce::jmap(dispersionAmount, 0.25f, 0.5f) * (float)sampleRate, allpass1B0, allpass1B1);
+        makeAllPass(sampleRate, juce::jmap(dispersionAmount, 0.1f, 0.25f) * (float)sampleRate, allpass2B0, allpass2B1);
+        filtersChanged = true;
+    }
+
+    if (filtersChanged)
+    {
+        // Phase delay of the one-pole (estimated from the cutoff relative to Nyquist) and a
+        // heuristic for the all-passes.
+        float dampingPhaseDelay = 0.0f;
+        if (cutoff < (float)sampleRate * 0.5f)
+            dampingPhaseDelay = std::atan(cutoff / ((float)sampleRate * 0.5f)) / juce::MathConstants<float>::pi;
+        phaseDelay = dampingPhaseDelay + dispersionAmount * 4.0f;
+    }
+
+    feedbackGain = newFeedbackGain;
+    updateVoiceLanes();
+}
+
+// Loop gains, levels, masks and delay targets from the voice list.
+void KarplusStrongVoicePool::updateVoiceLanes() noexcept
+{
+    for (size_t v = 0; v < (size_t)maxVoices; ++v)
+    {
+        const auto& voice = voices[v];
+        if (!voice.active)
+        {
+            mask[v] = loopGain[v] = level[v] = inputGain[v] = 0.0f;
+            targetDelay[v] = delay[v];
+            continue;
+        }
+
+        mask[v] = 1.0f;
+        loopGain[v] = feedbackGain * (voice.released ? releaseGain[v] : 1.0f);
+        level[v] = voice.velocity * outputScale;
+        targetDelay[v] = computeDelay(voice.frequency);
+    }
+    gliding = true;
+}
+
+int KarplusStrongVoicePool::startVoice(float frequencyHz, float velocity, int noteNumber) noexcept
+{
+    // A free voice, else the oldest that is not the drone.
+    int chosen = -1;
+    for (int v = 0; v < maxVoices && chosen < 0; ++v)
+        if (!voices[(size_t)v].active) chosen = v;
+    if (chosen < 0)
+    {
+        for (int v = 0; v < maxVoices; ++v)
+            if (!voices[(size_t)v].drone && (chosen < 0 || voices[(size_t)v].startOrder < voices[(size_t)chosen].startOrder))
+                chosen = v;
+    }
+
+    // A stolen voice keeps its ringing state, as a re-plucked string would.
+    auto& voice = voices[(size_t)chosen];
+    voice = {};
+    voice.note = noteNumber;
+    voice.frequency = frequencyHz;
+    voice.velocity = juce::jlimit(0.0f, 1.0f, velocity);
+    voice.active = true;
+    voice.startOrder = nextStartOrder++;
+
+    inputGain[(size_t)chosen] = 1.0f;
+    inputDecay[(size_t)chosen] = std::exp(-1.0f / (pluckSeconds * (float)sampleRate));
+    updateVoiceLanes();
+    delay[(size_t)chosen] = targetDelay[(size_t)chosen]; // New pitch straight away
+    return chosen;
+}
+
+void KarplusStrongVoicePool::setDrone(float frequencyHz) noexcept
+{
+    for (size_t v = 0; v < (size_t)maxVoices; ++v)
+    {
+        if (voices[v].drone)
+        {
+            voices[v].frequency = frequencyHz;
+            targetDelay[v] = computeDelay(frequencyHz);
+            gliding = true;
+            return;
+        }
+    }
+
+    const int v = startVoice(frequencyHz, 1.0f, -1);
+    voices[(size_t)v].drone = true;
+    inputDecay[(size_t)v] = 1.0f; // Excited for as long as it is held
+}
+
+void KarplusStrongVoicePool::noteOn(int noteNumber, float frequencyHz, float velocity) noexcept
+{
+    startVoice(frequencyHz, velocity, noteNumber);
+}
+
+void KarplusStrongVoicePool::noteOff(int noteNumber) noexcept
+{
+    releaseVoices([noteNumber](const Voice& voice) { return !voice.drone && voice.note == noteNumber; });
+}
+
+void KarplusStrongVoicePool::stopDrone() noexcept
+{
+    releaseVoices([](const Voice& voice) { return voice.drone; });
+}
+
+void KarplusStrongVoicePool::allNotesOff() noexcept
+{
+    releaseVoices([](const Voice& voice) { return !voice.drone && voice.note >= 0; });
+}
+
+template <typename Predicate>
+void KarplusStrongVoicePool::releaseVoices(Predicate&& shouldRelease) noexcept
+{
+    const float pluckDecay = std::exp(-1.0f / (pluckSeconds * (float)sampleRate));
+    bool anyReleased = false;
+    for (size_t v = 0; v < (size_t)maxVoices; ++v)
+    {
+        auto& voice = voices[v];
+        if (!voice.active || voice.released || !shouldRelease(voice))
+            continue;
+
+        // One pass round the loop takes 1 / frequency seconds; -60 dB over releaseSeconds.
+        voice.released = true;
+        voice.drone = false;
+        releaseGain[v] = std::pow(0.001f, 1.0f / (juce::jmax(20.0f, voice.frequency) * releaseSeconds));
+        inputDecay[v] = pluckDecay;
+        anyReleased = true;
+    }
+
+    if (anyReleased)
+        updateVoiceLanes();
+}
+
+int KarplusStrongVoicePool::getNumActiveVoices() const noexcept
+{
+    return (int)std::count_if(voices.begin(), voices.end(), [](const Voice& voice) { return voice.active; });
+}
+
+void KarplusStrongVoicePool::retireSilentVoices() noexcept
+{
+    bool anyRetired = false;
+    for (size_t v = 0; v < (size_t)maxVoices; ++v)
+    {
+        auto& voice = voices[v];
+        if (voice.active && !voice.drone && inputGain[v] < 1.0e-4f && peak[v] * voice.velocity < retireLevel)
+        {
+            voice.active = false;
+            anyRetired = true;
+        }
+    }
+
+    if (anyRetired)
+        updateVoiceLanes();
+}
+
+void KarplusStrongVoicePool::process(const juce::dsp::AudioBlock<const float>& excitation, juce::dsp::AudioBlock<float>& output) noexcept
+{
+    const int numSamples = (int)juce::jmin(excitation.getNumSamples(), output.getNumSamples());
+    const int channels = juce::jmin(numChannels, (int)excitation.getNumChannels(), (int)output.getNumChannels());
+    if (numSamples == 0 || channels == 0)
+        return;
+
+    int highestActive = -1;
+    for (int v = 0; v < maxVoices; ++v)
+        if (voices[(size_t)v].active) highestActive = v;
+
+    if (highestActive < 0)
+    {
+        for (int ch = 0; ch < channels; ++ch)
+            juce::FloatVectorOperations::clear(output.getChannelPointer((size_t)ch), numSamples);
+        return;
+    }
+
+    if (gliding)
+    {
+        const float inverseLength = 1.0f / (float)numSamples;
+        for (size_t v = 0; v < (size_t)maxVoices; ++v)
+            stepDelay[v] = (targetDelay[v] - delay[v]) * inverseLength;
+    }
+
+    // Only as many registers as the highest busy voice needs.
+    if (highestActive < lanesPerRegister)
+        processLanes<lanesPerRegister>(excitation, output, channels, numSamples, gliding);
+    else
+        processLanes<maxVoices>(excitation, output, channels, numSamples, gliding);
+
+    if (gliding)
+    {
+        delay = targetDelay; // Land exactly on the targets (the steps accumulate rounding)
+        gliding = false;
+    }
+
+    retireSilentVoices();
+}
+
+template <int numLanes>
+void KarplusStrongVoicePool::processLanes(const juce::dsp::AudioBlock<const float>& excitation, juce::dsp::AudioBlock<float>& output,
+                                          int channels, int numSamples, bool glide) noexcept
+{
+    static_assert(numLanes % lanesPerRegister == 0 && numLanes <= maxVoices, "Lanes come in whole registers");
+    std::array<int, maxVoices * numTaps> tapRows{};
+    std::fill(peak.begin(), peak.end(), 0.0f);
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        // Tap rows and Lagrange fractions: as DelayLine's Lagrange3rd, the integer part is one
+        // less than the delay's, so the fraction lies in [1, 2) and the taps straddle it.
+        for (int v = 0; v < numLanes; ++v)
+        {
+            if (glide) delay[(size_t)v] += stepDelay[(size_t)v];
+            const int whole = (int)delay[(size_t)v] - 1;
+            frac[(size_t)v] = delay[(size_t)v] - (float)whole;
+            for (int k = 0; k < numTaps; ++k)
+                tapRows[(size_t)(k * maxVoices + v)] = ((writeRow - whole - k) & rowMask) * maxVoices + v;
+        }
+
+        for (int ch = 0; ch < channels; ++ch)
+        {
+            float* memory = delayMemory[(size_t)ch].data();
+            for (int k = 0; k < numTaps; ++k)
+                for (int v = 0; v < numLanes; ++v)
+                    taps[(size_t)(k * maxVoices + v)] = memory[tapRows[(size_t)(k * maxVoices + v)]];
+
+            const float x = excitation.getChannelPointer((size_t)ch)[i];
+            float* row = memory + writeRow * maxVoices;
+            const size_t state = (size_t)(ch * maxVoices);
+            float sum = 0.0f;
+
+            int v = 0;
+#if TESSERA_KS_SSE
+            {
+                const __m128 one = _mm_set1_ps(1.0f), two = _mm_set1_ps(2.0f), three = _mm_set1_ps(3.0f);
+                const __m128 half = _mm_set1_ps(0.5f), sixth = _mm_set1_ps(1.0f / 6.0f);
+                const __m128 gv = _mm_set1_ps(lowpassG), xv = _mm_set1_ps(x);
+                const __m128 ap1B0 = _mm_set1_ps(allpass1B0), ap1B1 = _mm_set1_ps(allpass1B1);
+                const __m128 ap2B0 = _mm_set1_ps(allpass2B0), ap2B1 = _mm_set1_ps(allpass2B1);
+                const __m128 signMask = _mm_set1_ps(-0.0f);
+                __m128 acc = _mm_setzero_ps();
+                for (; v < numLanes; v += lanesPerRegister)
+                {
+                    // Lagrange weights for taps at whole, whole + 1, whole + 2, whole + 3
+                    const __m128 f = _mm_loadu_ps(frac.data() + v);
+                    const __m128 d1 = _mm_sub_ps(f, one), d2 = _mm_sub_ps(f, two), d3 = _mm_sub_ps(f, three);
+                    const __m128 c1 = _mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(d1, d2), d3), sixth));
+                    const __m128 c2 = _mm_mul_ps(_mm_mul_ps(d2, d3), half);
+                    const __m128 c3 = _mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(_mm_mul_ps(d1, d3), half));
+                    const __m128 c4 = _mm_mul_ps(_mm_mul_ps(d1, d2), sixth);
+                    const __m128 inner = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(taps.data() + maxVoices + v), c2),
+                                                               _mm_mul_ps(_mm_loadu_ps(taps.data() + 2 * maxVoices + v), c3)),
+                                                    _mm_mul_ps(_mm_loadu_ps(taps.data() + 3 * maxVoices + v), c4));
+                    const __m128 delayed = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(taps.data() + v), c1), _mm_mul_ps(f, inner));
+
+                    // Absorption
+                    const __m128 lp = _mm_loadu_ps(lowpassState.data() + state + v);
+                    const __m128 lpV = _mm_mul_ps(gv, _mm_sub_ps(delayed, lp));
+                    const __m128 damped = _mm_add_ps(lpV, lp);
+                    _mm_storeu_ps(lowpassState.data() + state + v, _mm_add_ps(damped, lpV));
+
+                    // Dispersion: two all-passes, TDF-II
+                    const __m128 a1s1 = _mm_loadu_ps(allpass1State1.data() + state + v);
+                    const __m128 dispersed1 = _mm_add_ps(_mm_mul_ps(damped, ap1B0), a1s1);
+                    _mm_storeu_ps(allpass1State1.data() + state + v,
+                                  _mm_add_ps(_mm_sub_ps(_mm_mul_ps(damped, ap1B1), _mm_mul_ps(dispersed1, ap1B1)), _mm_loadu_ps(allpass1State2.data() + state + v)));
+                    _mm_storeu_ps(allpass1State2.data() + state + v, _mm_sub_ps(damped, _mm_mul_ps(dispersed1, ap1B0)));
+
+                    const __m128 a2s1 = _mm_loadu_ps(allpass2State1.data() + state + v);
+                    const __m128 dispersed2 = _mm_add_ps(_mm_mul_ps(dispersed1, ap2B0), a2s1);
+                    _mm_storeu_ps(allpass2State1.data() + state + v,
+                                  _mm_add_ps(_mm_sub_ps(_mm_mul_ps(dispersed1, ap2B1), _mm_mul_ps(dispersed2, ap2B1)), _mm_loadu_ps(allpass2State2.data() + state + v)));
+                    _mm_storeu_ps(allpass2State2.data() + state + v, _mm_sub_ps(dispersed1, _mm_mul_ps(dispersed2, ap2B0)));
+
+                    // Into the delay: excitation plus last sample's feedback
+                    const __m128 drive = _mm_mul_ps(xv, _mm_loadu_ps(inputGain.data() + v));
+                    _mm_storeu_ps(row + v, _mm_mul_ps(_mm_add_ps(drive, _mm_loadu_ps(feedback.data() + state + v)), _mm_loadu_ps(mask.data() + v)));
+                    _mm_storeu_ps(feedback.data() + state + v, _mm_mul_ps(dispersed2, _mm_loadu_ps(loopGain.data() + v)));
+
+                    acc = _mm_add_ps(acc, _mm_mul_ps(dispersed2, _mm_loadu_ps(level.data() + v)));
+                    _mm_storeu_ps(peak.data() + v, _mm_max_ps(_mm_loadu_ps(peak.data() + v), _mm_andnot_ps(signMask, dispersed2)));
+                }
+                alignas(16) float lanes[4];
+                _mm_store_ps(lanes, acc);
+                sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+            }
+#elif TESSERA_KS_NEON
+            {
+                const float32x4_t one = vdupq_n_f32(1.0f), two = vdupq_n_f32(2.0f), three = vdupq_n_f32(3.0f);
+                const float32x4_t gv = vdupq_n_f32(lowpassG), xv = vdupq_n_f32(x);
+                const float32x4_t ap1B0 = vdupq_n_f32(allpass1B0), ap1B1 = vdupq_n_f32(allpass1B1);
+                const float32x4_t ap2B0 = vdupq_n_f32(allpass2B0), ap2B1 = vdupq_n_f32(allpass2B1);
+                float32x4_t acc = vdupq_n_f32(0.0f);
+                for (; v < numLanes; v += lanesPerRegister)
+                {
+                    const float32x4_t f = vld1q_f32(frac.data() + v);
+                    const float32x4_t d1 = vsubq_f32(f, one), d2 = vsubq_f32(f, two), d3 = vsubq_f32(f, three);
+                    const float32x4_t c1 = vmulq_n_f32(vmulq_f32(vmulq_f32(d1, d2), d3), -1.0f / 6.0f);
+                    const float32x4_t c2 = vmulq_n_f32(vmulq_f32(d2, d3), 0.5f);
+                    const float32x4_t c3 = vmulq_n_f32(vmulq_f32(d1, d3), -0.5f);
+                    const float32x4_t c4 = vmulq_n_f32(vmulq_f32(d1, d2), 1.0f / 6.0f);
+                    float32x4_t inner = vmulq_f32(vld1q_f32(taps.data() + maxVoices + v), c2);
+                    inner = vmlaq_f32(inner, vld1q_f32(taps.data() + 2 * maxVoices + v), c3);
+                    inner = vmlaq_f32(inner, vld1q_f32(taps.data() + 3 * maxVoices + v), c4);
+                    const float32x4_t delayed = vmlaq_f32(vmulq_f32(vld1q_f32(taps.data() + v), c1), f, inner);
+
+                    const float32x4_t lp = vld1q_f32(lowpassState.data() + state + v);
+                    const float32x4_t lpV = vmulq_f32(gv, vsubq_f32(delayed, lp));
+                    const float32x4_t damped = vaddq_f32(lpV, lp);
+                    vst1q_f32(lowpassState.data() + state + v, vaddq_f32(damped, lpV));
+
+                    const float32x4_t dispersed1 = vmlaq_f32(vld1q_f32(allpass1State1.data() + state + v), damped, ap1B0);
+                    vst1q_f32(allpass1State1.data() + state + v, vaddq_f32(vmulq_f32(vsubq_f32(damped, dispersed1), ap1B1), vld1q_f32(allpass1State2.data() + state + v)));
+                    vst1q_f32(allpass1State2.data() + state + v, vmlsq_f32(damped, dispersed1, ap1B0));
+
+                    const float32x4_t dispersed2 = vmlaq_f32(vld1q_f32(allpass2State1.data() + state + v), dispersed1, ap2B0);
+                    vst1q_f32(allpass2State1.data() + state + v, vaddq_f32(vmulq_f32(vsubq_f32(dispersed1, dispersed2), ap2B1), vld1q_f32(allpass2State2.data() + state + v)));
+                    vst1q_f32(allpass2State2.data() + state + v, vmlsq_f32(dispersed1, dispersed2, ap2B0));
+
+                    const float32x4_t drive = vmulq_f32(xv, vld1q_f32(inputGain.data() + v));
+                    vst1q_f32(row + v, vmulq_f32(vaddq_f32(drive, vld1q_f32(feedback.data() + state + v)), vld1q_f32(mask.data() + v)));
+                    vst1q_f32(feedback.data() + state + v, vmulq_f32(dispersed2, vld1q_f32(loopGain.data() + v)));
+
+                    acc = vmlaq_f32(acc, dispersed2, vld1q_f32(level.data() + v));
+                    vst1q_f32(peak.data() + v, vmaxq_f32(vld1q_f32(peak.data() + v), vabsq_f32(dispersed2)));
+                }
+                sum = (vgetq_lane_f32(acc, 0) + vgetq_lane_f32(acc, 1)) + (vgetq_lane_f32(acc, 2) + vgetq_lane_f32(acc, 3));
+            }
+#endif
+            for (; v < numLanes; ++v)
+            {
+                const size_t lane = (size_t)v, s = state + lane;
+                const float f = frac[lane];
+                const float d1 = f - 1.0f, d2 = f - 2.0f, d3 = f - 3.0f;
+                const float c1 = -d1 * d2 * d3 / 6.0f, c2 = d2 * d3 * 0.5f, c3 = -d1 * d3 * 0.5f, c4 = d1 * d2 / 6.0f;
+                const float delayed = taps[lane] * c1
+                    + f * (taps[maxVoices + lane] * c2 + taps[2 * maxVoices + lane] * c3 + taps[3 * maxVoices + lane] * c4);
+
+                const float lpV = lowpassG * (delayed - lowpassState[s]);
+                const float damped = lpV + lowpassState[s];
+                lowpassState[s] = damped + lpV;
+
+                const float dispersed1 = damped * allpass1B0 + allpass1State1[s];
+                allpass1State1[s] = damped * allpass1B1 - dispersed1 * allpass1B1 + allpass1State2[s];
+                allpass1State2[s] = damped - dispersed1 * allpass1B0;
+
+                const float dispersed2 = dispersed1 * allpass2B0 + allpass2State1[s];
+                allpass2State1[s] = dispersed1 * allpass2B1 - dispersed2 * allpass2B1 + allpass2State2[s];
+                allpass2State2[s] = dispersed1 - dispersed2 * allpass2B0;
+
+                row[v] = (x * inputGain[lane] + feedback[s]) * mask[lane];
+                feedback[s] = dispersed2 * loopGain[lane];
+
+                sum += dispersed2 * level[lane];
+                peak[lane] = juce::jmax(peak[lane], std::abs(dispersed2));
+            }
+
+            output.getChannelPointer((size_t)ch)[i] = sum;
+        }
+
+        for (int v = 0; v < numLanes; ++v)
+            inputGain[(size_t)v] *= inputDecay[(size_t)v];
+        writeRow = (writeRow + 1) & rowMask;
+    }
+}
@@ -0,0 +1,102 @@
+//================================================================================
+// File: DSP_Helpers/KarplusStrongVoicePool.h
+//================================================================================
+#pragma once
+#include <juce_dsp/juce_dsp.h>
+#include <array>
+#include <vector>
+
+/**
+ * Fixed pool of extended Karplus-Strong strings, each one SIMD lane.
+ *
+ * Every string is the loop the string resonator has always run: a fractional delay read with
+ * third-order Lagrange interpolation, a one-pole TPT low-pass for absorption, two second-order
+ * all-passes for dispersion, and a feedback gain. The delay is shortened by the filters' phase
+ * delay so the pitch stays put. The filters are shared by every string, and their coefficients are
+ * only recomputed when the cutoff or the dispersion changes.
+ *
+ * Strings are voices. A note or a trigger takes a free voice, or steals the oldest. The voice then
+ * takes the excitation input through a short pluck window and rings at its own pitch; a released
+ * note decays in releaseSeconds, and a voice that has rung out is freed. A drone voice is held
+ * and excited continuously (the resonator's original single-string behaviour).
+ *
+ * The delay memory is interleaved per channel (row t holds sample t of every voice), so a sample
+ * of the whole pool is written with one vector store. The four taps of each read are gathered per
+ * lane; the Lagrange weights, filters and feedback then run 4 voices per instruction (SSE or
+ * NEON, scalar otherwise). Delays glide across each process() call; nothing allocates after
+ * prepare().
+ */
+class KarplusStrongVoicePool
+{
+public:
+    static constexpr int maxVoices = 8;
+    static constexpr float pluckSeconds = 0.05f;   // Time constant of a voice's excitation window
+    static constexpr float releaseSeconds = 0.25f; // -60 dB after a note-off
+
+    void prepare(double sampleRate, int numChannels, int maxDelaySamples);
+    void reset() noexcept;
+
+    void setParameters(float cutoffHz, float dispersion, float feedbackGain) noexcept;
+
+    // The drone follows frequencyHz on every call; stopDrone() releases it.
+    void setDrone(float frequencyHz) noexcept;
+    void stopDrone() noexcept;
+
+    // noteNumber < 0 starts a voice no note-off will release (transient triggers).
+    void noteOn(int noteNumber, float frequencyHz, float velocity) noexcept;
+    void noteOff(int noteNumber) noexcept;
+    void allNotesOff() noexcept;
+
+    // Excitation in, summed voices out (replaced). Channels beyond the pool's are left alone.
+    void process(const juce::dsp::AudioBlock<const float>& excitation, juce::dsp::AudioBlock<float>& output) noexcept;
+
+    int getNumActiveVoices() const noexcept;
+
+private:
+    struct Voice
+    {
+        int note = -1;
+        float frequency = 0.0f, velocity = 0.0f;
+        bool active = false, drone = false, released = false;
+        juce::uint32 startOrder = 0; // For stealing the oldest voice
+    };
+
+    int startVoice(float frequencyHz, float velocity, int noteNumber) noexcept;
+    template <typename Predicate>
+    void releaseVoices(Predicate&& shouldRelease) noexcept;
+    void updateVoiceLanes() noexcept;
+    float computeDelay(float frequencyHz) const noexcept;
+    void retireSilentVoices() noexcept;
+
+    template <int numLanes>
+    void processLanes(const juce::dsp::AudioBlock<const float>& excitation, juce::dsp::AudioBlock<float>& output,
+                      int channels, int numSamples, bool glide) noexcept;
+
+    double sampleRate = 44100.0;
+    int numChannels = 0, maxDelay = 1;
+
+    std::array<Voice, maxVoices> voices;
+    juce::uint32 nextStartOrder = 0;
+
+    // Shared loop filters; the inputs they were computed for, to skip unchanged updates.
+    float cutoff = -1.0f, dispersionAmount = -1.0f;
+    float lowpassG = 0.0f;
+    float allpass1B0 = 0.0f, allpass1B1 = 0.0f, allpass2B0 = 0.0f, allpass2B1 = 0.0f; // a1 = b1, a2 = b0, b2 = 1
+    float phaseDelay = 0.0f; // Filters' phase delay, taken off every voice's delay
+    float feedbackGain = 0.0f;
+
+    // Per voice lane.
+    std::array<float, maxVoices> delay{}, targetDelay{}, stepDelay{};
+    std::array<float, maxVoices> inputGain{}, inputDecay{}; // Excitation window
+    std::array<float, maxVoices> loopGain{}, level{}, mask{};
+    std::array<float, maxVoices> releaseGain{};            // Extra loop loss per pass once released
+    std::array<float, maxVoices> peak{};                   // Loudest output this block, for retiring
+    bool gliding = false;
+
+    // Per channel, [channel * maxVoices + lane]; delay memory is [channel][row * maxVoices + lane].
+    std::vector<float> lowpassState, allpass1State1, allpass1State2, allpass2State1, allpass2State2, feedback;
+    std::vector<std::vector<float>> delayMemory;
+    int rowMask = 0, writeRow = 0;
+    std::array<float, maxVoices * 4> taps{}; // Gather scratch: tap k of lane v at [k * maxVoices + v]
+    std::array<float, maxVoices> frac{};
+};
@@ -0,0 +1,338 @@
+//================================================================================
+// File: DSP_Helpers/ModalFilterBank.cpp
+//================================================================================
+#include "ModalFilterBank.h"
+#include <algorithm>
+#include <cmath>
+
+// juce_dsp includes the intrinsics headers whenever JUCE_USE_SIMD is on.
+#if JUCE_USE_SIMD && (defined(__SSE2__) || defined(_M_X64) || defined(__amd64__))
+ #define TESSERA_MODAL_SSE 1
+#elif JUCE_USE_SIMD && (defined(__ARM_NEON__) || defined(__ARM_NEON))
+ #define TESSERA_MODAL_NEON 1
+#endif
+
+namespace
+{
+    constexpr int modesPerIteration = 8; // Two 4-lane registers
+
+    // Adds step to value, element-wise, over n (a multiple of 8) floats.
+    inline void addInPlace(float* value, const float* step, int n) noexcept
+    {
+        int m = 0;
+#if TESSERA_MODAL_SSE
+        for (; m < n; m += 4)
+            _mm_storeu_ps(value + m, _mm_add_ps(_mm_loadu_ps(value + m), _mm_loadu_ps(step + m)));
+#elif TESSERA_MODAL_NEON
+        for (; m < n; m += 4)
+            vst1q_f32(value + m, vaddq_f32(vld1q_f32(value + m), vld1q_f32(step + m)));
+#endif
+        for (; m < n; ++m)
+            value[m] += step[m];
+    }
+
+    // One sample through every mode of one channel: y = b0 x + s1; s1 = s2 - a1 y; s2 = -b0 x - a2 y
+    // (band-pass, so b1 = 0 and b2 = -b0). Returns the gain-weighted sum of the mode outputs.
+    inline float processModes(float x, const float* b0, const float* a1, const float* a2, const float* gain,
+                              float* s1, float* s2, int n) noexcept
+    {
+        int m = 0;
+        float sum = 0.0f;
+#if TESSERA_MODAL_SSE
+        const __m128 xv = _mm_set1_ps(x);
+        __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+        for (; m < n; m += modesPerIteration)
+        {
+            const __m128 bx0 = _mm_mul_ps(_mm_loadu_ps(b0 + m), xv);
+            const __m128 bx1 = _mm_mul_ps(_mm_loadu_ps(b0 + m + 4), xv);
+            const __m128 y0 = _mm_add_ps(bx0, _mm_loadu_ps(s1 + m));
+            const __m128 y1 = _mm_add_ps(bx1, _mm_loadu_ps(s1 + m + 4));
+            _mm_storeu_ps(s1 + m,     _mm_sub_ps(_mm_loadu_ps(s2 + m),     _mm_mul_ps(_mm_loadu_ps(a1 + m), y0)));
+            _mm_storeu_ps(s1 + m + 4, _mm_sub_ps(_mm_loadu_ps(s2 + m + 4), _mm_mul_ps(_mm_loadu_ps(a1 + m + 4), y1)));
+            _mm_storeu_ps(s2 + m,     _mm_sub_ps(_mm_setzero_ps(), _mm_add_ps(bx0, _mm_mul_ps(_mm_loadu_ps(a2 + m), y0))));
+            _mm_storeu_ps(s2 + m + 4, _mm_sub_ps(_mm_setzero_ps(), _mm_add_ps(bx1, _mm_mul_ps(_mm_loadu_ps(a2 + m + 4), y1))));
+            acc0 = _mm_add_ps(acc0, _mm_mul_ps(y0, _mm_loadu_ps(gain + m)));
+            acc1 = _mm_add_ps(acc1, _mm_mul_ps(y1, _mm_loadu_ps(gain + m + 4)));
+        }
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, _mm_add_ps(acc0, acc1));
+        sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#elif TESSERA_MODAL_NEON
+        const float32x4_t xv = vdupq_n_f32(x);
+        float32x4_t acc0 = vdupq_n_f32(0.0f), acc1 = vdupq_n_f32(0.0f);
+        for (; m < n; m += modesPerIteration)
+        {
+            const float32x4_t bx0 = vmulq_f32(vld1q_f32(b0 + m), xv);
+            const float32x4_t bx1 = vmulq_f32(vld1q_f32(b0 + m + 4), xv);
+            const float32x4_t y0 = vaddq_f32(bx0, vld1q_f32(s1 + m));
+            const float32x4_t y1 = vaddq_f32(bx1, vld1q_f32(s1 + m + 4));
+            vst1q_f32(s1 + m,     vmlsq_f32(vld1q_f32(s2 + m),     vld1q_f32(a1 + m), y0));
+            vst1q_f32(s1 + m + 4, vmlsq_f32(vld1q_f32(s2 + m + 4), vld1q_f32(a1 + m + 4), y1));
+            vst1q_f32(s2 + m,     vnegq_f32(vmlaq_f32(bx0, vld1q_f32(a2 + m), y0)));
+            vst1q_f32(s2 + m + 4, vnegq_f32(vmlaq_f32(bx1, vld1q_f32(a2 + m + 4), y1)));
+            acc0 = vmlaq_f32(acc0, y0, vld1q_f32(gain + m));
+            acc1 = vmlaq_f32(acc1, y1, vld1q_f32(gain + m + 4));
+        }
+        const float32x4_t acc = vaddq_f32(acc0, acc1);
+        sum = (vgetq_lane_f32(acc, 0) + vgetq_lane_f32(acc, 1)) + (vgetq_lane_f32(acc, 2) + vgetq_lane_f32(acc, 3));
+#endif
+        for (; m < n; ++m)
+        {
+            const float bx = b0[m] * x;
+            const float y = bx + s1[m];
+            s1[m] = s2[m] - a1[m] * y;
+            s2[m] = -(bx + a2[m] * y);
+            sum += y * gain[m];
+        }
+        return sum;
+    }
+}
+
+void ModalFilterBank::prepare(double newSampleRate, int newNumChannels, int newMaxModes)
+{
+    sampleRate = newSampleRate;
+    numChannels = juce::jmax(0, newNumChannels);
+    maxModes = juce::jmax(0, newMaxModes);
+    paddedModes = (maxModes + modesPerIteration - 1) / modesPerIteration * modesPerIteration;
+
+    for (auto* array : { &modeFreq, &modeB0, &modeA1, &modeA2, &modeGain })
+        array->assign((size_t)maxModes, 0.0f);
+    modeDormant.assign((size_t)maxModes, 0);
+    previousSlotOfMode.assign((size_t)maxModes, -1);
+
+    slotMode.assign((size_t)paddedModes, 0);
+    nextSlotMode.assign((size_t)paddedModes, 0);
+    for (auto* array : { &b0, &a1, &a2, &gain, &targetB0, &targetA1, &targetA2, &targetGain,
+                         &stepB0, &stepA1, &stepA2, &stepGain, &scratchB0, &scratchA1, &scratchA2, &scratchGain })
+        array->assign((size_t)paddedModes, 0.0f);
+    for (auto* array : { &state1, &state2, &scratchState1, &scratchState2 })
+        array->assign((size_t)(numChannels * paddedModes), 0.0f);
+
+    numModes = 0;
+    reset();
+}
+
+void ModalFilterBank::reset() noexcept
+{
+    std::fill(state1.begin(), state1.end(), 0.0f);
+    std::fill(state2.begin(), state2.end(), 0.0f);
+    std::fill(modeDormant.begin(), modeDormant.end(), (std::uint8_t)0);
+    numDormant = 0;
+    numActive = numActivePadded = 0; // Rebuilt, from rest, by the next setModes()
+    hasCoefficients = false;
+    gliding = false;
+}
+
+bool ModalFilterBank::isAudible(int mode) const noexcept
+{
+    const float freq = modeFreq[(size_t)mode];
+    return freq > 0.0f && freq < maxFrequencyRatio * (float)sampleRate
+        && std::abs(modeGain[(size_t)mode]) >= gainFloor && modeDormant[(size_t)mode] == 0;
+}
+
+void ModalFilterBank::setModes(const float* freqsHz, const float* qs, const float* gains, int newNumModes) noexcept
+{
+    numModes = juce::jlimit(0, maxModes, newNumModes);
+
+    // Same design as IIR::Coefficients::makeBandPass, computed in double. Modes that are culled
+    // by frequency keep their stale coefficients; they are never read.
+    for (int m = 0; m < numModes; ++m)
+    {
+        modeFreq[(size_t)m] = freqsHz[m];
+        modeGain[(size_t)m] = gains[m];
+        if (!(freqsHz[m] > 0.0f && freqsHz[m] < maxFrequencyRatio * (float)sampleRate))
+            continue;
+
+        const double n = 1.0 / std::tan(juce::MathConstants<double>::pi * (double)freqsHz[m] / sampleRate);
+        const double nSquared = n * n;
+        const double invQ = 1.0 / (double)qs[m];
+        const double c1 = 1.0 / (1.0 + invQ * n + nSquared);
+
+        modeB0[(size_t)m] = (float)(c1 * n * invQ);
+        modeA1[(size_t)m] = (float)(c1 * 2.0 * (1.0 - nSquared));
+        modeA2[(size_t)m] = (float)(c1 * (1.0 - invQ * n + nSquared));
+    }
+
+    updateActiveList();
+
+    if (!hasCoefficients)
+    {
+        std::copy_n(targetB0.begin(), numActivePadded, b0.begin());
+        std::copy_n(targetA1.begin(), numActivePadded, a1.begin());
+        std::copy_n(targetA2.begin(), numActivePadded, a2.begin());
+        std::copy_n(targetGain.begin(), numActivePadded, gain.begin());
+        hasCoefficients = true;
+        gliding = false;
+    }
+    else
+    {
+        gliding = true;
+    }
+}
+
+// Points the slot targets at the current mode targets, compacting the list if its membership
+// changed. Surviving modes carry their current coefficients and state to their new slot.
+void ModalFilterBank::updateActiveList() noexcept
+{
+    int count = 0;
+    for (int m = 0; m < numModes; ++m)
+        if (isAudible(m))
+            nextSlotMode[(size_t)count++] = m;
+
+    const bool sameMembers = count == numActive && std::equal(nextSlotMode.begin(), nextSlotMode.begin() + count, slotMode.begin());
+    if (!sameMembers)
+    {
+        std::fill(previousSlotOfMode.begin(), previousSlotOfMode.end(), -1);
+        for (int s = 0; s < numActive; ++s)
+            previousSlotOfMode[(size_t)slotMode[(size_t)s]] = s;
+
+        scratchB0 = b0; scratchA1 = a1; scratchA2 = a2; scratchGain = gain; // Same sizes: no allocation
+        scratchState1 = state1; scratchState2 = state2;
+        std::fill(state1.begin(), state1.end(), 0.0f);
+        std::fill(state2.begin(), state2.end(), 0.0f);
+
+        for (int s = 0; s < count; ++s)
+        {
+            const int m = nextSlotMode[(size_t)s];
+            const int previous = previousSlotOfMode[(size_t)m];
+            slotMode[(size_t)s] = m;
+            if (previous < 0)
+            {
+                // Joins from rest, straight at its target
+                b0[(size_t)s] = modeB0[(size_t)m]; a1[(size_t)s] = modeA1[(size_t)m];
+                a2[(size_t)s] = modeA2[(size_t)m]; gain[(size_t)s] = modeGain[(size_t)m];
+                continue;
+            }
+
+            b0[(size_t)s] = scratchB0[(size_t)previous]; a1[(size_t)s] = scratchA1[(size_t)previous];
+            a2[(size_t)s] = scratchA2[(size_t)previous]; gain[(size_t)s] = scratchGain[(size_t)previous];
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                state1[(size_t)(ch * paddedModes + s)] = scratchState1[(size_t)(ch * paddedModes + previous)];
+                state2[(size_t)(ch * paddedModes + s)] = scratchState2[(size_t)(ch * paddedModes + previous)];
+            }
+        }
+
+        // The tail of the last 8-mode group holds silent, stateless sections.
+        for (int s = count; s < paddedModes; ++s)
+            b0[(size_t)s] = a1[(size_t)s] = a2[(size_t)s] = gain[(size_t)s] = 0.0f;
+
+        numActive = count;
+        numActivePadded = (count + modesPerIteration - 1) / modesPerIteration * modesPerIteration;
+    }
+
+    for (int s = 0; s < numActivePadded; ++s)
+    {
+        const bool used = s < numActive;
+        const size_t m = (size_t)slotMode[(size_t)s];
+        targetB0[(size_t)s] = used ? modeB0[m] : 0.0f;
+        targetA1[(size_t)s] = used ? modeA1[m] : 0.0f;
+        targetA2[(size_t)s] = used ? modeA2[m] : 0.0f;
+        targetGain[(size_t)s] = used ? modeGain[m] : 0.0f;
+    }
+}
+
+// Called after a silent block: modes whose remaining output is below the decay floor leave the
+// list until the input returns.
+void ModalFilterBank::retireDecayedModes() noexcept
+{
+    bool anyRetired = false;
+    for (int s = 0; s < numActive; ++s)
+    {
+        float level = 0.0f;
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            const size_t index = (size_t)(ch * paddedModes + s);
+            level = juce::jmax(level, std::abs(state1[index]) + std::abs(state2[index]));
+        }
+
+        if (std::abs(gain[(size_t)s]) * level < decayFloor)
+        {
+            modeDormant[(size_t)slotMode[(size_t)s]] = 1;
+            ++numDormant;
+            anyRetired = true;
+        }
+    }
+
+    if (anyRetired)
+        updateActiveList();
+}
+
+void ModalFilterBank::process(const juce::dsp::AudioBlock<const float>& input, juce::dsp::AudioBlock<float>& output) noexcept
+{
+    const int numSamples = (int)juce::jmin(input.getNumSamples(), output.getNumSamples());
+    const int channels = juce::jmin(numChannels, (int)input.getNumChannels(), (int)output.getNumChannels());
+    if (numSamples == 0 || channels == 0)
+        return;
+
+    float inputPeak = 0.0f;
+    for (int ch = 0; ch < channels; ++ch)
+    {
+        const auto range = juce::FloatVectorOperations::findMinAndMax(input.getChannelPointer((size_t)ch), (size_t)numSamples);
+        inputPeak = juce::jmax(inputPeak, -range.getStart(), range.getEnd());
+    }
+    const bool inputSilent = inputPeak < silenceThreshold;
+
+    // Input is back: every retired mode rejoins from rest.
+    if (!inputSilent && numDormant > 0)
+    {
+        std::fill(modeDormant.begin(), modeDormant.end(), (std::uint8_t)0);
+        numDormant = 0;
+        updateActiveList();
+    }
+
+    if (!hasCoefficients || numActive == 0)
+    {
+        for (int ch = 0; ch < channels; ++ch)
+            juce::FloatVectorOperations::clear(output.getChannelPointer((size_t)ch), numSamples);
+        return;
+    }
+
+    if (gliding)
+    {
+        const float inverseLength = 1.0f / (float)numSamples;
+        for (size_t s = 0; s < (size_t)numActivePadded; ++s)
+        {
+            stepB0[s] = (targetB0[s] - b0[s]) * inverseLength;
+            stepA1[s] = (targetA1[s] - a1[s]) * inverseLength;
+            stepA2[s] = (targetA2[s] - a2[s]) * inverseLength;
+            stepGain[s] = (targetGain[s] - gain[s]) * inverseLength;
+        }
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            addInPlace(b0.data(), stepB0.data(), numActivePadded);
+            addInPlace(a1.data(), stepA1.data(), numActivePadded);
+            addInPlace(a2.data(), stepA2.data(), numActivePadded);
+            addInPlace(gain.data(), stepGain.data(), numActivePadded);
+            for (int ch = 0; ch < channels; ++ch)
+                output.getChannelPointer((size_t)ch)[i] = processSample(ch, input.getChannelPointer((size_t)ch)[i]);
+        }
+
+        // Land exactly on the targets (the steps accumulate rounding).
+        std::copy_n(targetB0.begin(), numActivePadded, b0.begin());
+        std::copy_n(targetA1.begin(), numActivePadded, a1.begin());
+        std::copy_n(targetA2.begin(), numActivePadded, a2.begin());
+        std::copy_n(targetGain.begin(), numActivePadded, gain.begin());
+        gliding = false;
+    }
+    else
+    {
+        for (int ch = 0; ch < channels; ++ch)
+        {
+            const float* in = input.getChannelPointer((size_t)ch);
+            float* out = output.getChannelPointer((size_t)ch);
+            for (int i = 0; i < numSamples; ++i)
+                out[i] = processSample(ch, in[i]);
+        }
+    }
+
+    if (inputSilent)
+        retireDecayedModes();
+}
+
+float ModalFilterBank::processSample(int channel, float x) noexcept
+{
+    const size_t offset = (size_t)(channel * paddedModes);
+    return processModes(x, b0.data(), a1.data(), a2.data(), gain.data(), state1.data() + offset, state2.data() + offset, numActivePadded);
+}
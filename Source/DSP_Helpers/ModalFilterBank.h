@@ -0,0 +1,78 @@
+//================================================================================
+// File: DSP_Helpers/ModalFilterBank.h
+//================================================================================
+#pragma once
+#include <juce_dsp/juce_dsp.h>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Parallel bank of constant-peak-gain band-pass resonators (one per mode), summed with a gain per
+ * mode. Equivalent to a juce::dsp::IIR::Filter per mode with makeBandPass() coefficients, in
+ * transposed direct form II.
+ *
+ * Structure of arrays: coefficients, gains and per-channel state live in flat arrays padded to a
+ * multiple of 8, and the per-sample loop runs 8 modes per iteration across two SIMD registers
+ * (SSE or NEON; scalar otherwise). Coefficients are computed straight into the arrays, with no
+ * allocation after prepare().
+ *
+ * setModes() sets new targets; the next process() glides every coefficient and gain linearly from
+ * the current values to the targets across its samples. Linear interpolation between two stable
+ * band-pass sections stays stable (the stability region is convex), so tune and structure sweeps
+ * are click-free even with sparse control updates.
+ *
+ * Only audible modes are processed. The arrays hold an active list, compacted in mode order, that
+ * leaves out modes at or above the Nyquist limit, modes whose gain is below the gain floor, and
+ * modes that have rung out while the input is silent (they rejoin, from rest, as soon as the input
+ * returns). A mode that stays in the list keeps its state and glides; one that joins starts at its
+ * target coefficients with a cleared state.
+ */
+class ModalFilterBank
+{
+public:
+    static constexpr float maxFrequencyRatio = 0.49f; // Modes at or above this share of the sample rate are dropped
+    static constexpr float gainFloor = 1.0e-6f;       // -120 dB: quieter modes are dropped
+    static constexpr float silenceThreshold = 1.0e-6f; // Input peak below which ringing modes may retire
+    static constexpr float decayFloor = 1.0e-7f;      // -140 dB: a retiring mode's remaining output
+
+    void prepare(double sampleRate, int numChannels, int maxModes);
+    void reset() noexcept;
+
+    // New targets for the first numModes modes (the rest fall silent). The first call after
+    // prepare() or reset() applies them immediately.
+    void setModes(const float* freqsHz, const float* qs, const float* gains, int numModes) noexcept;
+
+    // Replaces output with the summed response to input. Channels beyond the bank's are left alone.
+    void process(const juce::dsp::AudioBlock<const float>& input, juce::dsp::AudioBlock<float>& output) noexcept;
+
+    int getMaxModes() const noexcept { return maxModes; }
+    int getNumActiveModes() const noexcept { return numActive; } // Modes actually being filtered
+
+private:
+    bool isAudible(int mode) const noexcept;
+    void updateActiveList() noexcept;
+    void retireDecayedModes() noexcept;
+    float processSample(int channel, float x) noexcept;
+
+    double sampleRate = 44100.0;
+    int numChannels = 0, maxModes = 0, paddedModes = 0;
+
+    // Per mode: target coefficients from the last setModes(), and whether the mode has rung out.
+    int numModes = 0;
+    std::vector<float> modeFreq, modeB0, modeA1, modeA2, modeGain;
+    std::vector<std::uint8_t> modeDormant;
+    int numDormant = 0;
+
+    // Active list, [slot]: the mode it holds, and its current, target and per-sample step values.
+    int numActive = 0, numActivePadded = 0;
+    std::vector<int> slotMode, nextSlotMode, previousSlotOfMode;
+    std::vector<float> b0, a1, a2, gain;
+    std::vector<float> targetB0, targetA1, targetA2, targetGain;
+    std::vector<float> stepB0, stepA1, stepA2, stepGain;
+    bool hasCoefficients = false; // False until the first setModes() after a reset
+    bool gliding = false;
+
+    // TDF-II state, [channel * paddedModes + slot], and scratch copies for compaction.
+    std::vector<float> state1, state2;
+    std::vector<float> scratchB0, scratchA1, scratchA2, scratchGain, scratchState1, scratchState2;
+};
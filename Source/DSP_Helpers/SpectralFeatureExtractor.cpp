@@ -0,0 +1,310 @@
+//================================================================================
+// File: DSP_Helpers/SpectralFeatureExtractor.cpp
+//================================================================================
+#include "SpectralFeatureExtractor.h"
+#include <algorithm>
+#include <cmath>
+
+// juce_dsp includes the intrinsics headers whenever JUCE_USE_SIMD is on. The NEON path needs
+// AArch64 for vsqrtq_f32 and vdivq_f32.
+#if JUCE_USE_SIMD && (defined(__SSE2__) || defined(_M_X64) || defined(__amd64__))
+ #define TESSERA_FEATURES_SSE 1
+#elif JUCE_USE_SIMD && (defined(__ARM_NEON__) || defined(__ARM_NEON)) && (defined(__aarch64__) || defined(_M_ARM64))
+ #define TESSERA_FEATURES_NEON 1
+#endif
+
+namespace
+{
+    constexpr float powerFloor = 1.0e-12f;   // Keeps the flatness logs finite on empty bins
+    constexpr float fluxNormaliser = 5.0f;   // Empirical; tuned for responsiveness
+    constexpr float silenceMagnitude = 1.0e-6f;
+
+    // log2 of positive, normal floats: the exponent plus log2 of the mantissa m in [1, 2), from
+    // 2/ln2 * atanh((m - 1) / (m + 1)) as an odd series (error below 3e-6).
+    constexpr float twoOverLn2 = 2.8853900817779268f;
+    constexpr float series3 = 1.0f / 3.0f, series5 = 1.0f / 5.0f, series7 = 1.0f / 7.0f, series9 = 1.0f / 9.0f;
+
+#if TESSERA_FEATURES_SSE
+    inline __m128 log2Approx(__m128 x) noexcept
+    {
+        const __m128i bits = _mm_castps_si128(x);
+        const __m128 exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+        const __m128 mantissa = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f800000)));
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 t = _mm_div_ps(_mm_sub_ps(mantissa, one), _mm_add_ps(mantissa, one));
+        const __m128 t2 = _mm_mul_ps(t, t);
+        __m128 poly = _mm_add_ps(_mm_set1_ps(series7), _mm_mul_ps(t2, _mm_set1_ps(series9)));
+        poly = _mm_add_ps(_mm_set1_ps(series5), _mm_mul_ps(t2, poly));
+        poly = _mm_add_ps(_mm_set1_ps(series3), _mm_mul_ps(t2, poly));
+        poly = _mm_add_ps(one, _mm_mul_ps(t2, poly));
+        return _mm_add_ps(exponent, _mm_mul_ps(_mm_mul_ps(t, poly), _mm_set1_ps(twoOverLn2)));
+    }
+
+    inline float horizontalSum(__m128 v) noexcept
+    {
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, v);
+        return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+#elif TESSERA_FEATURES_NEON
+    inline float32x4_t log2Approx(float32x4_t x) noexcept
+    {
+        const uint32x4_t bits = vreinterpretq_u32_f32(x);
+        const float32x4_t exponent = vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(127)));
+        const float32x4_t mantissa = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x007fffff)), vdupq_n_u32(0x3f800000)));
+        const float32x4_t one = vdupq_n_f32(1.0f);
+        const float32x4_t t = vdivq_f32(vsubq_f32(mantissa, one), vaddq_f32(mantissa, one));
+        const float32x4_t t2 = vmulq_f32(t, t);
+        float32x4_t poly = vmlaq_f32(vdupq_n_f32(series7), t2, vdupq_n_f32(series9));
+        poly = vmlaq_f32(vdupq_n_f32(series5), t2, poly);
+        poly = vmlaq_f32(vdupq_n_f32(series3), t2, poly);
+        poly = vmlaq_f32(one, t2, poly);
+        return vmlaq_f32(exponent, vmulq_f32(t, poly), vdupq_n_f32(twoOverLn2));
+    }
+
+    inline float horizontalSum(float32x4_t v) noexcept
+    {
+        return (vgetq_lane_f32(v, 0) + vgetq_lane_f32(v, 1)) + (vgetq_lane_f32(v, 2) + vgetq_lane_f32(v, 3));
+    }
+#endif
+}
+
+SpectralFeatureExtractor::SpectralFeatureExtractor()
+    : fft(FFT_ORDER)
+{
+}
+
+void SpectralFeatureExtractor::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    sampleRate = spec.sampleRate;
+
+    // Normalised like juce::dsp::WindowingFunction's default, so feature scales are unchanged.
+    windowTable.resize(FFT_SIZE);
+    juce::dsp::WindowingFunction<float>::fillWindowingTables(windowTable.data(), (size_t)FFT_SIZE,
+        juce::dsp::WindowingFunction<float>::hann, true);
+    windowPower = 0.0f;
+    for (float w : windowTable) windowPower += w * w;
+
+    ring.assign(FFT_SIZE, 0.0f);
+    fftData.assign(FFT_SIZE * 2, 0.0f);
+    magnitudes.assign(NUM_BINS, 0.0f);
+    lastMagnitudes.assign(NUM_BINS, 0.0f);
+    powers.assign(NUM_BINS, 0.0f);
+
+    // The transient value responds faster than the descriptive features.
+    smoothedFlux.reset(sampleRate, 0.02);
+    for (auto* smoother : { &smoothedCentroid, &smoothedRolloff, &smoothedFlatness, &smoothedRms })
+        smoother->reset(sampleRate, 0.03);
+
+    reset();
+}
+
+void SpectralFeatureExtractor::reset()
+{
+    std::fill(ring.begin(), ring.end(), 0.0f);
+    std::fill(lastMagnitudes.begin(), lastMagnitudes.end(), 0.0f);
+    writePosition = 0;
+    samplesUntilFrame = FFT_SIZE;
+
+    frameFeatures = {};
+    smoothedCentroid.setCurrentAndTargetValue(frameFeatures.centroid); // Start neutral
+    smoothedFlux.setCurrentAndTargetValue(frameFeatures.flux);
+    smoothedRolloff.setCurrentAndTargetValue(frameFeatures.rolloff);
+    smoothedFlatness.setCurrentAndTargetValue(frameFeatures.flatness);
+    smoothedRms.setCurrentAndTargetValue(frameFeatures.rms);
+}
+
+void SpectralFeatureExtractor::process(const juce::dsp::AudioBlock<const float>& block, float* transientOut) noexcept
+{
+    const int numSamples = (int)block.getNumSamples();
+    if (ring.empty())
+    {
+        if (transientOut != nullptr) std::fill_n(transientOut, numSamples, 0.0f);
+        return;
+    }
+
+    // Chunks end at a frame boundary or the end of the ring, whichever comes first.
+    for (int done = 0; done < numSamples;)
+    {
+        const int chunk = juce::jmin(numSamples - done, samplesUntilFrame, FFT_SIZE - writePosition);
+        pushMono(block, done, chunk);
+        writePosition = (writePosition + chunk) & (FFT_SIZE - 1);
+        samplesUntilFrame -= chunk;
+
+        float* out = transientOut != nullptr ? transientOut + done : nullptr;
+        if (samplesUntilFrame == 0)
+        {
+            // The sample that completes a frame already moves towards its targets.
+            advanceSmoothers(chunk - 1, out);
+            processFrame();
+            samplesUntilFrame = HOP_SIZE;
+            advanceSmoothers(1, out != nullptr ? out + chunk - 1 : nullptr);
+        }
+        else
+        {
+            advanceSmoothers(chunk, out);
+        }
+        done += chunk;
+    }
+}
+
+void SpectralFeatureExtractor::pushMono(const juce::dsp::AudioBlock<const float>& block, int start, int numSamples) noexcept
+{
+    float* dest = ring.data() + writePosition;
+    const int numChannels = (int)block.getNumChannels();
+    if (numChannels == 0)
+    {
+        juce::FloatVectorOperations::clear(dest, numSamples);
+        return;
+    }
+
+    juce::FloatVectorOperations::copy(dest, block.getChannelPointer(0) + start, numSamples);
+    for (int ch = 1; ch < numChannels; ++ch)
+        juce::FloatVectorOperations::add(dest, block.getChannelPointer((size_t)ch) + start, numSamples);
+    if (numChannels > 1)
+        juce::FloatVectorOperations::multiply(dest, 1.0f / (float)numChannels, numSamples);
+}
+
+void SpectralFeatureExtractor::advanceSmoothers(int numSamples, float* transientOut) noexcept
+{
+    if (numSamples <= 0) return;
+
+    if (transientOut != nullptr)
+        for (int i = 0; i < numSamples; ++i)
+            transientOut[i] = smoothedFlux.getNextValue();
+    else
+        smoothedFlux.skip(numSamples);
+
+    for (auto* smoother : { &smoothedCentroid, &smoothedRolloff, &smoothedFlatness, &smoothedRms })
+        smoother->skip(numSamples);
+}
+
+void SpectralFeatureExtractor::processFrame() noexcept
+{
+    // Window straight out of the ring, oldest sample first.
+    const int toEnd = FFT_SIZE - writePosition;
+    juce::FloatVectorOperations::multiply(fftData.data(), ring.data() + writePosition, windowTable.data(), toEnd);
+    juce::FloatVectorOperations::multiply(fftData.data() + toEnd, ring.data(), windowTable.data() + toEnd, writePosition);
+
+    fft.performRealOnlyForwardTransform(fftData.data(), true);
+    computeFeatures();
+    std::swap(magnitudes, lastMagnitudes);
+
+    smoothedFlux.setTargetValue(frameFeatures.flux);
+    smoothedRms.setTargetValue(frameFeatures.rms);
+    smoothedCentroid.setTargetValue(frameFeatures.centroid);
+    smoothedRolloff.setTargetValue(frameFeatures.rolloff);
+    smoothedFlatness.setTargetValue(frameFeatures.flatness);
+}
+
+// Every feature from one pass over the bins (interleaved re/im, DC to Nyquist).
+void SpectralFeatureExtractor::computeFeatures() noexcept
+{
+    const float* bins = fftData.data();
+    const float* previous = lastMagnitudes.data();
+    float* magnitude = magnitudes.data();
+    float* power = powers.data();
+
+    float magnitudeSum = 0.0f, weightedSum = 0.0f, powerSum = 0.0f, fluxSum = 0.0f, logSum = 0.0f;
+    int k = 0;
+
+#if TESSERA_FEATURES_SSE || TESSERA_FEATURES_NEON
+    const int vectorBins = (NUM_BINS - 1) & ~3; // Nyquist is left to the scalar tail
+#endif
+#if TESSERA_FEATURES_SSE
+    __m128 accMagnitude = _mm_setzero_ps(), accWeighted = _mm_setzero_ps(), accPower = _mm_setzero_ps();
+    __m128 accFlux = _mm_setzero_ps(), accLog = _mm_setzero_ps();
+    __m128 binIndex = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    const __m128 four = _mm_set1_ps(4.0f), floorVector = _mm_set1_ps(powerFloor);
+    for (; k < vectorBins; k += 4)
+    {
+        const __m128 lo = _mm_loadu_ps(bins + 2 * k), hi = _mm_loadu_ps(bins + 2 * k + 4);
+        const __m128 re = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 im = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+        const __m128 p = _mm_add_ps(_mm_mul_ps(re, re), _mm_mul_ps(im, im));
+        const __m128 m = _mm_sqrt_ps(p);
+        _mm_storeu_ps(power + k, p);
+        _mm_storeu_ps(magnitude + k, m);
+
+        accMagnitude = _mm_add_ps(accMagnitude, m);
+        accWeighted = _mm_add_ps(accWeighted, _mm_mul_ps(m, binIndex));
+        accPower = _mm_add_ps(accPower, p);
+        accFlux = _mm_add_ps(accFlux, _mm_max_ps(_mm_sub_ps(m, _mm_loadu_ps(previous + k)), _mm_setzero_ps()));
+        accLog = _mm_add_ps(accLog, log2Approx(_mm_add_ps(p, floorVector)));
+        binIndex = _mm_add_ps(binIndex, four);
+    }
+    magnitudeSum = horizontalSum(accMagnitude);
+    weightedSum = horizontalSum(accWeighted);
+    powerSum = horizontalSum(accPower);
+    fluxSum = horizontalSum(accFlux);
+    logSum = horizontalSum(accLog);
+#elif TESSERA_FEATURES_NEON
+    float32x4_t accMagnitude = vdupq_n_f32(0.0f), accWeighted = vdupq_n_f32(0.0f), accPower = vdupq_n_f32(0.0f);
+    float32x4_t accFlux = vdupq_n_f32(0.0f), accLog = vdupq_n_f32(0.0f);
+    const float initialIndex[4] = { 0.0f, 1.0f, 2.0f, 3.0f };
+    float32x4_t binIndex = vld1q_f32(initialIndex);
+    const float32x4_t four = vdupq_n_f32(4.0f), floorVector = vdupq_n_f32(powerFloor);
+    for (; k < vectorBins; k += 4)
+    {
+        const float32x4x2_t reIm = vld2q_f32(bins + 2 * k); // Deinterleaves re and im
+        const float32x4_t p = vmlaq_f32(vmulq_f32(reIm.val[0], reIm.val[0]), reIm.val[1], reIm.val[1]);
+        const float32x4_t m = vsqrtq_f32(p);
+        vst1q_f32(power + k, p);
+        vst1q_f32(magnitude + k, m);
+
+        accMagnitude = vaddq_f32(accMagnitude, m);
+        accWeighted = vmlaq_f32(accWeighted, m, binIndex);
+        accPower = vaddq_f32(accPower, p);
+        accFlux = vaddq_f32(accFlux, vmaxq_f32(vsubq_f32(m, vld1q_f32(previous + k)), vdupq_n_f32(0.0f)));
+        accLog = vaddq_f32(accLog, log2Approx(vaddq_f32(p, floorVector)));
+        binIndex = vaddq_f32(binIndex, four);
+    }
+    magnitudeSum = horizontalSum(accMagnitude);
+    weightedSum = horizontalSum(accWeighted);
+    powerSum = horizontalSum(accPower);
+    fluxSum = horizontalSum(accFlux);
+    logSum = horizontalSum(accLog);
+#endif
+    for (; k < NUM_BINS; ++k)
+    {
+        const float re = bins[2 * k], im = bins[2 * k + 1];
+        const float p = re * re + im * im;
+        const float m = std::sqrt(p);
+        power[k] = p;
+        magnitude[k] = m;
+
+        magnitudeSum += m;
+        weightedSum += m * (float)k;
+        powerSum += p;
+        fluxSum += juce::jmax(0.0f, m - previous[k]);
+        logSum += std::log2(p + powerFloor);
+    }
+
+    // Flux and RMS cover every bin. The one-sided spectrum counts each bin between DC and
+    // Nyquist twice; dividing by the window's power undoes the windowing.
+    const int nyquistBin = NUM_BINS - 1;
+    frameFeatures.flux = juce::jlimit(0.0f, 1.0f, fluxSum / fluxNormaliser);
+    const float windowedEnergy = (2.0f * powerSum - power[0] - power[nyquistBin]) / (float)FFT_SIZE;
+    frameFeatures.rms = std::sqrt(juce::jmax(0.0f, windowedEnergy) / windowPower);
+
+    // The rest describe the spectrum's shape without DC, and hold their last value through silence.
+    const float bandMagnitude = magnitudeSum - magnitude[0];
+    if (bandMagnitude <= silenceMagnitude)
+        return;
+
+    frameFeatures.centroid = juce::jlimit(0.0f, 1.0f, weightedSum / bandMagnitude / (float)nyquistBin);
+
+    const float bandPower = powerSum - power[0];
+    const float meanLog = (logSum - std::log2(power[0] + powerFloor)) / (float)nyquistBin;
+    frameFeatures.flatness = juce::jlimit(0.0f, 1.0f, std::exp2(meanLog) / (bandPower / (float)nyquistBin + powerFloor));
+
+    const float rolloffPower = ROLLOFF_SHARE * bandPower;
+    float cumulative = 0.0f;
+    int rolloffBin = 1;
+    for (; rolloffBin < nyquistBin; ++rolloffBin)
+    {
+        cumulative += power[rolloffBin];
+        if (cumulative >= rolloffPower) break;
+    }
+    frameFeatures.rolloff = (float)rolloffBin / (float)nyquistBin;
+}
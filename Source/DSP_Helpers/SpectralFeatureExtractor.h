@@ -0,0 +1,82 @@
+//================================================================================
+// File: DSP_Helpers/SpectralFeatureExtractor.h
+//================================================================================
+#pragma once
+#include <juce_dsp/juce_dsp.h>
+#include <vector>
+
+/**
+ * Short-time spectral features of a mono mix, for analysis-driven modules.
+ *
+ * One windowed 512-point FFT per hop (50% overlap) feeds every feature: spectral centroid, flux,
+ * rolloff and flatness, and the frame's RMS (from the bins, by Parseval). A single pass over the
+ * bins computes the magnitudes and the sums behind all of them, 4 bins per instruction with SSE
+ * or NEON (scalar otherwise); only the rolloff needs a second, early-exit scan of the stored
+ * powers.
+ *
+ * Input arrives a block at a time into a ring buffer, so there is no per-sample call and no FIFO
+ * shift: each frame is windowed straight out of the ring. The features are smoothed per sample,
+ * and a frame's targets apply from the sample that completes it. Nothing allocates after
+ * prepare().
+ */
+class SpectralFeatureExtractor
+{
+public:
+    static constexpr int FFT_ORDER = 9;
+    static constexpr int FFT_SIZE = 1 << FFT_ORDER;
+    static constexpr int HOP_SIZE = FFT_SIZE / 2; // 50% overlap
+    static constexpr int NUM_BINS = FFT_SIZE / 2 + 1;
+    static constexpr float ROLLOFF_SHARE = 0.85f; // Share of the power below the rolloff
+
+    // One frame's features. Centroid and rolloff are relative to Nyquist (0 = dark, 1 = bright);
+    // flux (positive magnitude change since the last frame) and flatness (geometric over
+    // arithmetic mean power: 0 = tonal, 1 = noise) are 0 to 1; rms is linear.
+    struct Features
+    {
+        float centroid = 0.5f, flux = 0.0f, rolloff = 0.5f, flatness = 0.0f, rms = 0.0f;
+    };
+
+    SpectralFeatureExtractor();
+
+    void prepare(const juce::dsp::ProcessSpec& spec);
+    void reset();
+
+    // Mixes the block's channels to mono and analyses it. With transientOut, the smoothed
+    // transient value is written per sample (numSamples values), for sample-accurate onsets.
+    void process(const juce::dsp::AudioBlock<const float>& block, float* transientOut = nullptr) noexcept;
+
+    // Smoothed features, as of the last sample processed.
+    float getSpectralCentroid() const noexcept { return smoothedCentroid.getCurrentValue(); }
+    float getTransientValue() const noexcept { return smoothedFlux.getCurrentValue(); }
+    float getSpectralRolloff() const noexcept { return smoothedRolloff.getCurrentValue(); }
+    float getSpectralFlatness() const noexcept { return smoothedFlatness.getCurrentValue(); }
+    float getRms() const noexcept { return smoothedRms.getCurrentValue(); }
+
+    // Unsmoothed features of the most recent frame.
+    const Features& getFrameFeatures() const noexcept { return frameFeatures; }
+
+    // Latency of the analysis (one hop).
+    int getLatencyInSamples() const noexcept { return HOP_SIZE; }
+
+private:
+    void pushMono(const juce::dsp::AudioBlock<const float>& block, int start, int numSamples) noexcept;
+    void advanceSmoothers(int numSamples, float* transientOut) noexcept;
+    void processFrame() noexcept;
+    void computeFeatures() noexcept;
+
+    double sampleRate = 44100.0;
+    juce::dsp::FFT fft;
+
+    std::vector<float> windowTable; // Normalised Hann
+    float windowPower = 1.0f;       // Sum of the squared window, for the RMS
+    std::vector<float> ring;        // Last FFT_SIZE mono samples; the oldest is at writePosition
+    int writePosition = 0, samplesUntilFrame = FFT_SIZE;
+
+    std::vector<float> fftData;                     // 2 * FFT_SIZE, as JUCE's real-only transform needs
+    std::vector<float> magnitudes, lastMagnitudes;  // Swapped every frame, for the flux
+    std::vector<float> powers;                      // For the rolloff scan
+
+    Features frameFeatures;
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> smoothedCentroid, smoothedFlux,
+        smoothedRolloff, smoothedFlatness, smoothedRms;
+};
@@ -0,0 +1,289 @@
+//================================================================================
+// File: DSP_Helpers/SympatheticStringBank.cpp
+//================================================================================
+#include "SympatheticStringBank.h"
+#include <algorithm>
+#include <cmath>
+
+// juce_dsp includes the intrinsics headers whenever JUCE_USE_SIMD is on.
+#if JUCE_USE_SIMD && (defined(__SSE2__) || defined(_M_X64) || defined(__amd64__))
+ #define TESSERA_STRINGS_SSE 1
+#elif JUCE_USE_SIMD && (defined(__ARM_NEON__) || defined(__ARM_NEON))
+ #define TESSERA_STRINGS_NEON 1
+#endif
+
+namespace
+{
+    constexpr int lanesPerRegister = 4;
+
+#if TESSERA_STRINGS_SSE
+    inline float horizontalSum(__m128 v) noexcept
+    {
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, v);
+        return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+#elif TESSERA_STRINGS_NEON
+    inline float horizontalSum(float32x4_t v) noexcept
+    {
+        return (vgetq_lane_f32(v, 0) + vgetq_lane_f32(v, 1)) + (vgetq_lane_f32(v, 2) + vgetq_lane_f32(v, 3));
+    }
+#endif
+}
+
+void SympatheticStringBank::prepare(double newSampleRate, int maxDelaySamples)
+{
+    sampleRate = newSampleRate;
+    maxDelay = juce::jmax(1, maxDelaySamples);
+
+    // Two taps per read: the deepest one is maxDelay + 1 rows back.
+    const int numRows = juce::nextPowerOfTwo(maxDelay + 2);
+    rowMask = numRows - 1;
+    delayMemory.assign((size_t)(numRows * maxStrings), 0.0f);
+
+    for (auto* array : { &delay, &targetDelay, &stepDelay, &lowpassState, &feedback,
+                         &active, &weightLeft, &weightRight, &tap0, &tap1, &frac })
+        array->assign((size_t)maxStrings, 0.0f);
+
+    // Re-applies the string count (and its weights) to the fresh arrays.
+    const int strings = numStrings > 0 ? numStrings : 1;
+    numStrings = numLanes = 0;
+    setNumStrings(strings);
+    reset();
+}
+
+void SympatheticStringBank::reset() noexcept
+{
+    std::fill(delayMemory.begin(), delayMemory.end(), 0.0f);
+    for (auto* array : { &delay, &targetDelay, &stepDelay, &lowpassState, &feedback })
+        std::fill(array->begin(), array->end(), 0.0f);
+    writeRow = 0;
+    summedFeedback = 0.0f;
+    hasParameters = false; // The next setParameters() applies immediately
+    gliding = false;
+}
+
+void SympatheticStringBank::setNumStrings(int newNumStrings) noexcept
+{
+    newNumStrings = juce::jlimit(1, maxStrings, newNumStrings);
+    if (newNumStrings == numStrings)
+        return;
+
+    // Before prepare() the per-lane arrays are empty: only the count is kept, for prepare().
+    if (delayMemory.empty())
+    {
+        numStrings = newNumStrings;
+        return;
+    }
+
+    for (int s = 0; s < maxStrings; ++s)
+    {
+        const float isActive = s < newNumStrings ? 1.0f : 0.0f;
+        const float side = (s % 2 == 0 ? 1.0f : -1.0f) * stereoSpread;
+        active[(size_t)s] = isActive;
+        weightLeft[(size_t)s] = isActive * (1.0f + side);
+        weightRight[(size_t)s] = isActive * (1.0f - side);
+    }
+
+    // Strings switched on or off drop whatever they held.
+    clearStrings(juce::jmin(numStrings, newNumStrings), juce::jmax(numStrings, newNumStrings));
+    numStrings = newNumStrings;
+    numLanes = (numStrings + lanesPerRegister - 1) / lanesPerRegister * lanesPerRegister;
+}
+
+void SympatheticStringBank::clearStrings(int first, int last) noexcept
+{
+    if (delayMemory.empty())
+        return;
+
+    for (int row = 0; row <= rowMask; ++row)
+        std::fill_n(delayMemory.begin() + (std::ptrdiff_t)(row * maxStrings + first), last - first, 0.0f);
+
+    for (int s = first; s < last; ++s)
+    {
+        // A zero delay marks the string for a snap to its first target (real delays are >= 1).
+        delay[(size_t)s] = targetDelay[(size_t)s] = stepDelay[(size_t)s] = 0.0f;
+        lowpassState[(size_t)s] = feedback[(size_t)s] = 0.0f;
+    }
+}
+
+float SympatheticStringBank::computeG(float cutoffHz) const noexcept
+{
+    // As FirstOrderTPTFilter: g in double, G in float.
+    const float clampedCutoff = juce::jlimit(1.0f, (float)sampleRate * 0.499f, cutoffHz);
+    const auto g = (float)std::tan(juce::MathConstants<double>::pi * clampedCutoff / sampleRate);
+    return g / (1.0f + g);
+}
+
+void SympatheticStringBank::setParameters(const float* delaysSamples, float cutoffHz, float newFeedbackGain, float newCoupling) noexcept
+{
+    for (int s = 0; s < numStrings; ++s)
+    {
+        targetDelay[(size_t)s] = juce::jlimit(1.0f, (float)maxDelay, delaysSamples[s]);
+        if (!hasParameters || delay[(size_t)s] <= 0.0f)
+            delay[(size_t)s] = targetDelay[(size_t)s];
+    }
+
+    targetLowpassG = computeG(cutoffHz);
+    targetFeedbackGain = newFeedbackGain;
+    coupling = newCoupling;
+
+    if (!hasParameters)
+    {
+        lowpassG = targetLowpassG;
+        feedbackGain = targetFeedbackGain;
+        hasParameters = true;
+        gliding = false;
+    }
+    else
+    {
+        gliding = true;
+    }
+}
+
+void SympatheticStringBank::process(const float* input, float* outLeft, float* outRight, int numSamples) noexcept
+{
+    if (numSamples <= 0)
+        return;
+
+    if (!hasParameters || delayMemory.empty())
+    {
+        juce::FloatVectorOperations::clear(outLeft, numSamples);
+        if (outRight != nullptr) juce::FloatVectorOperations::clear(outRight, numSamples);
+        return;
+    }
+
+    if (gliding)
+    {
+        const float inverseLength = 1.0f / (float)numSamples;
+        for (size_t s = 0; s < (size_t)numLanes; ++s)
+            stepDelay[s] = (targetDelay[s] - delay[s]) * inverseLength;
+    }
+
+    if (outRight != nullptr)
+        processLanes<true>(input, outLeft, outRight, numSamples, gliding);
+    else
+        processLanes<false>(input, outLeft, nullptr, numSamples, gliding);
+
+    if (gliding)
+    {
+        // Land exactly on the targets (the steps accumulate rounding).
+        std::copy_n(targetDelay.begin(), numLanes, delay.begin());
+        lowpassG = targetLowpassG;
+        feedbackGain = targetFeedbackGain;
+        gliding = false;
+    }
+}
+
+template <bool stereo>
+void SympatheticStringBank::processLanes(const float* input, float* outLeft, float* outRight, int numSamples, bool glide) noexcept
+{
+    const float inverseLength = 1.0f / (float)numSamples;
+    const float stepG = glide ? (targetLowpassG - lowpassG) * inverseLength : 0.0f;
+    const float stepFeedbackGain = glide ? (targetFeedbackGain - feedbackGain) * inverseLength : 0.0f;
+    const float* outputWeights = stereo ? weightLeft.data() : active.data();
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        if (glide)
+        {
+            juce::FloatVectorOperations::add(delay.data(), stepDelay.data(), numLanes);
+            lowpassG += stepG;
+            feedbackGain += stepFeedbackGain;
+        }
+
+        // Gather both taps of every string's read (each lane has its own integer delay).
+        for (int s = 0; s < numLanes; ++s)
+        {
+            const float d = delay[(size_t)s];
+            const int whole = (int)d;
+            frac[(size_t)s] = d - (float)whole;
+            tap0[(size_t)s] = delayMemory[(size_t)(((writeRow - whole) & rowMask) * maxStrings + s)];
+            tap1[(size_t)s] = delayMemory[(size_t)(((writeRow - whole - 1) & rowMask) * maxStrings + s)];
+        }
+
+        const float drive = input[i] + coupling * summedFeedback;
+        float* row = delayMemory.data() + writeRow * maxStrings;
+        float feedbackSum = 0.0f, left = 0.0f, right = 0.0f;
+
+        int s = 0;
+#if TESSERA_STRINGS_SSE
+        {
+            const __m128 gv = _mm_set1_ps(lowpassG), feedbackGainV = _mm_set1_ps(feedbackGain), driveV = _mm_set1_ps(drive);
+            __m128 feedbackAcc = _mm_setzero_ps(), leftAcc = _mm_setzero_ps(), rightAcc = _mm_setzero_ps();
+            for (; s < numLanes; s += lanesPerRegister)
+            {
+                const __m128 t0 = _mm_loadu_ps(tap0.data() + s);
+                const __m128 delayed = _mm_add_ps(t0, _mm_mul_ps(_mm_loadu_ps(frac.data() + s), _mm_sub_ps(_mm_loadu_ps(tap1.data() + s), t0)));
+
+                const __m128 state = _mm_loadu_ps(lowpassState.data() + s);
+                const __m128 v = _mm_mul_ps(gv, _mm_sub_ps(delayed, state));
+                const __m128 y = _mm_add_ps(v, state);
+                _mm_storeu_ps(lowpassState.data() + s, _mm_add_ps(y, v));
+
+                const __m128 mask = _mm_loadu_ps(active.data() + s);
+                _mm_storeu_ps(row + s, _mm_mul_ps(_mm_add_ps(driveV, _mm_loadu_ps(feedback.data() + s)), mask));
+
+                const __m128 newFeedback = _mm_mul_ps(_mm_mul_ps(y, feedbackGainV), mask);
+                _mm_storeu_ps(feedback.data() + s, newFeedback);
+                feedbackAcc = _mm_add_ps(feedbackAcc, newFeedback);
+
+                leftAcc = _mm_add_ps(leftAcc, _mm_mul_ps(y, _mm_loadu_ps(outputWeights + s)));
+                if (stereo) rightAcc = _mm_add_ps(rightAcc, _mm_mul_ps(y, _mm_loadu_ps(weightRight.data() + s)));
+            }
+            feedbackSum = horizontalSum(feedbackAcc);
+            left = horizontalSum(leftAcc);
+            if (stereo) right = horizontalSum(rightAcc);
+        }
+#elif TESSERA_STRINGS_NEON
+        {
+            const float32x4_t gv = vdupq_n_f32(lowpassG), feedbackGainV = vdupq_n_f32(feedbackGain), driveV = vdupq_n_f32(drive);
+            float32x4_t feedbackAcc = vdupq_n_f32(0.0f), leftAcc = vdupq_n_f32(0.0f), rightAcc = vdupq_n_f32(0.0f);
+            for (; s < numLanes; s += lanesPerRegister)
+            {
+                const float32x4_t t0 = vld1q_f32(tap0.data() + s);
+                const float32x4_t delayed = vmlaq_f32(t0, vld1q_f32(frac.data() + s), vsubq_f32(vld1q_f32(tap1.data() + s), t0));
+
+                const float32x4_t state = vld1q_f32(lowpassState.data() + s);
+                const float32x4_t v = vmulq_f32(gv, vsubq_f32(delayed, state));
+                const float32x4_t y = vaddq_f32(v, state);
+                vst1q_f32(lowpassState.data() + s, vaddq_f32(y, v));
+
+                const float32x4_t mask = vld1q_f32(active.data() + s);
+                vst1q_f32(row + s, vmulq_f32(vaddq_f32(driveV, vld1q_f32(feedback.data() + s)), mask));
+
+                const float32x4_t newFeedback = vmulq_f32(vmulq_f32(y, feedbackGainV), mask);
+                vst1q_f32(feedback.data() + s, newFeedback);
+                feedbackAcc = vaddq_f32(feedbackAcc, newFeedback);
+
+                leftAcc = vmlaq_f32(leftAcc, y, vld1q_f32(outputWeights + s));
+                if (stereo) rightAcc = vmlaq_f32(rightAcc, y, vld1q_f32(weightRight.data() + s));
+            }
+            feedbackSum = horizontalSum(feedbackAcc);
+            left = horizontalSum(leftAcc);
+            if (stereo) right = horizontalSum(rightAcc);
+        }
+#endif
+        for (; s < numLanes; ++s)
+        {
+            const size_t lane = (size_t)s;
+            const float delayed = tap0[lane] + frac[lane] * (tap1[lane] - tap0[lane]);
+
+            const float v = lowpassG * (delayed - lowpassState[lane]);
+            const float y = v + lowpassState[lane];
+            lowpassState[lane] = y + v;
+
+            row[s] = (drive + feedback[lane]) * active[lane];
+            feedback[lane] = y * feedbackGain * active[lane];
+            feedbackSum += feedback[lane];
+
+            left += y * outputWeights[s];
+            if (stereo) right += y * weightRight[lane];
+        }
+
+        summedFeedback = feedbackSum;
+        outLeft[i] = left;
+        if (stereo) outRight[i] = right;
+        writeRow = (writeRow + 1) & rowMask;
+    }
+}
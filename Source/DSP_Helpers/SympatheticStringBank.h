@@ -0,0 +1,71 @@
+//================================================================================
+// File: DSP_Helpers/SympatheticStringBank.h
+//================================================================================
+#pragma once
+#include <juce_dsp/juce_dsp.h>
+#include <vector>
+
+/**
+ * Bank of coupled waveguide strings driven by one input, each string one SIMD lane.
+ *
+ * Every string is a fractional (linear) delay, a one-pole TPT low-pass for absorption, and a
+ * feedback gain. All strings also hear a share (the coupling) of the bank's summed feedback
+ * from the previous sample. This matches the per-string juce::dsp::DelayLine and
+ * FirstOrderTPTFilter chain the sympathetic resonator used to run.
+ *
+ * The delay memory is interleaved: row t holds sample t of every string, so one sample of the
+ * whole bank is written with a single vector store. The two taps of each string's fractional
+ * read are gathered per lane (SSE2 and NEON have no gather). Interpolation, filtering, feedback
+ * and output summing then run 4 strings per instruction, with SSE or NEON when available.
+ *
+ * setParameters() sets new targets. The next process() glides delays, cutoff and feedback
+ * linearly from the current values across its samples; the first call after reset() applies
+ * them immediately. Nothing allocates after prepare().
+ */
+class SympatheticStringBank
+{
+public:
+    static constexpr int maxStrings = 24;
+
+    void prepare(double sampleRate, int maxDelaySamples);
+    void reset() noexcept;
+
+    // Strings that become active start from silence. May be called before prepare().
+    void setNumStrings(int numStrings) noexcept;
+    int getNumStrings() const noexcept { return numStrings; }
+
+    // Delays are in samples, one per active string.
+    void setParameters(const float* delaysSamples, float cutoffHz, float feedbackGain, float coupling) noexcept;
+
+    // Mono in; outputs are replaced. With outRight, the strings alternate between the two sides
+    // (equal and opposite weights), so the pair is decorrelated but averages to the mono output.
+    void process(const float* input, float* outLeft, float* outRight, int numSamples) noexcept;
+
+private:
+    template <bool stereo>
+    void processLanes(const float* input, float* outLeft, float* outRight, int numSamples, bool glide) noexcept;
+    float computeG(float cutoffHz) const noexcept;
+    void clearStrings(int first, int last) noexcept;
+
+    static constexpr float stereoSpread = 0.6f; // Side weights are 1 +- spread
+
+    double sampleRate = 44100.0;
+    int numStrings = 0, numLanes = 0; // Lanes: strings rounded up to a multiple of 4
+    int maxDelay = 1;
+
+    // Interleaved delay memory, [row * maxStrings + string], with a power-of-two row count.
+    std::vector<float> delayMemory;
+    int rowMask = 0, writeRow = 0;
+
+    // Per lane, padded to maxStrings.
+    std::vector<float> delay, targetDelay, stepDelay;
+    std::vector<float> lowpassState, feedback;
+    std::vector<float> active, weightLeft, weightRight; // Mask and output weights (0 on padding)
+    std::vector<float> tap0, tap1, frac;                  // Per-sample gather scratch
+
+    float lowpassG = 0.0f, targetLowpassG = 0.0f;   // TPT low-pass G = g / (1 + g)
+    float feedbackGain = 0.0f, targetFeedbackGain = 0.0f;
+    float coupling = 0.0f;
+    float summedFeedback = 0.0f;                    // Previous sample's feedback, summed over strings
+    bool hasParameters = false, gliding = false;
+};
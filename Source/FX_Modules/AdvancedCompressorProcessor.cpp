@@ -7,13 +7,13 @@ AdvancedCompressorProcessor::AdvancedCompressorProcessor(juce::AudioProcessorVal
     mainApvts(apvts)
 {
     auto slotPrefix = "SLOT_" + juce::String(slotIndex + 1) + "_ADVCOMP_";
-    topologyParamId = slotPrefix + "TOPOLOGY";
-    detectorParamId = slotPrefix + "DETECTOR";
-    thresholdParamId = slotPrefix + "THRESHOLD";
-    ratioParamId = slotPrefix + "RATIO";
-    attackParamId = slotPrefix + "ATTACK";
-    releaseParamId = slotPrefix + "RELEASE";
-    makeupParamId = slotPrefix + "MAKEUP";
+    topologyParam = ParameterHandle(mainApvts, slotPrefix + "TOPOLOGY");
+    detectorParam = ParameterHandle(mainApvts, slotPrefix + "DETECTOR");
+    thresholdParam = ParameterHandle(mainApvts, slotPrefix + "THRESHOLD");
+    ratioParam = ParameterHandle(mainApvts, slotPrefix + "RATIO");
+    attackParam = ParameterHandle(mainApvts, slotPrefix + "ATTACK");
+    releaseParam = ParameterHandle(mainApvts, slotPrefix + "RELEASE");
+    makeupParam = ParameterHandle(mainApvts, slotPrefix + "MAKEUP");
 }
 
 void AdvancedCompressorProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
@@ -106,23 +106,14 @@ void AdvancedCompressorProcessor::processBlock(juce::AudioBuffer<float>& buffer,
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
-    // 1. Get parameters (Safety check omitted for brevity)
-    // Ensure parameters exist before accessing them
-    if (!mainApvts.getRawParameterValue(thresholdParamId) || !mainApvts.getRawParameterValue(ratioParamId) ||
-        !mainApvts.getRawParameterValue(attackParamId) || !mainApvts.getRawParameterValue(releaseParamId) ||
-        !mainApvts.getRawParameterValue(makeupParamId) || !mainApvts.getRawParameterValue(topologyParamId) ||
-        !mainApvts.getRawParameterValue(detectorParamId))
-    {
-        return;
-    }
-
-    float thresholdDb = mainApvts.getRawParameterValue(thresholdParamId)->load();
-    float ratio = mainApvts.getRawParameterValue(ratioParamId)->load();
-    float attackMs = mainApvts.getRawParameterValue(attackParamId)->load();
-    float releaseMs = mainApvts.getRawParameterValue(releaseParamId)->load();
-    float makeupDb = mainApvts.getRawParameterValue(makeupParamId)->load();
-    auto topology = static_cast<Topology>(static_cast<int>(mainApvts.getRawParameterValue(topologyParamId)->load()));
-    auto detectorMode = static_cast<DetectorMode>(static_cast<int>(mainApvts.getRawParameterValue(detectorParamId)->load()));
+    // 1. Get parameters (handles are resolved at construction)
+    float thresholdDb = thresholdParam.get();
+    float ratio = ratioParam.get();
+    float attackMs = attackParam.get();
+    float releaseMs = releaseParam.get();
+    float makeupDb = makeupParam.get();
+    auto topology = topologyParam.getChoice<Topology>();
+    auto detectorMode = detectorParam.getChoice<DetectorMode>();
 
     // 2. Configure based on topology
     configureTopology(topology, attackMs, releaseMs);
@@ -3,6 +3,7 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
 #include "../DSPUtils.h"
+#include "../ParameterHandle.h"
 
 class AdvancedCompressorProcessor : public juce::AudioProcessor
 {
@@ -60,5 +61,5 @@ private:
     void configureTopology(Topology topology, float attackMs, float releaseMs);
 
     juce::AudioProcessorValueTreeState& mainApvts;
-    juce::String topologyParamId, detectorParamId, thresholdParamId, ratioParamId, attackParamId, releaseParamId, makeupParamId;
+    ParameterHandle topologyParam, detectorParam, thresholdParam, ratioParam, attackParam, releaseParam, makeupParam;
 };
\ No newline at end of file
@@ -7,14 +7,15 @@ AdvancedDelayProcessor::AdvancedDelayProcessor(juce::AudioProcessorValueTreeStat
     mainApvts(apvts)
 {
     auto slotPrefix = "SLOT_" + juce::String(slotIndex + 1) + "_ADVDELAY_";
-    modeParamId = slotPrefix + "MODE";
-    timeParamId = slotPrefix + "TIME";
-    feedbackParamId = slotPrefix + "FEEDBACK";
-    mixParamId = slotPrefix + "MIX";
-    colorParamId = slotPrefix + "COLOR";
-    wowParamId = slotPrefix + "WOW";
-    flutterParamId = slotPrefix + "FLUTTER";
-    ageParamId = slotPrefix + "AGE";
+    modeParam = ParameterHandle(mainApvts, slotPrefix + "MODE");
+    timeParam = ParameterHandle(mainApvts, slotPrefix + "TIME");
+    feedbackParam = ParameterHandle(mainApvts, slotPrefix + "FEEDBACK");
+    mixParam = ParameterHandle(mainApvts, slotPrefix + "MIX");
+    colorParam = ParameterHandle(mainApvts, slotPrefix + "COLOR");
+    wowParam = ParameterHandle(mainApvts, slotPrefix + "WOW");
+    flutterParam = ParameterHandle(mainApvts, slotPrefix + "FLUTTER");
+    ageParam = ParameterHandle(mainApvts, slotPrefix + "AGE");
+    slotSeed = SlotSeed(mainApvts, slotIndex);
 
     // Configure tape saturator (Blueprint 2.2.2)
     tapeSaturator.functionToUse = [](float x) { return std::tanh(x * 1.5f) * 0.9f; };
@@ -23,6 +24,7 @@ AdvancedDelayProcessor::AdvancedDelayProcessor(juce::AudioProcessorValueTreeStat
 void AdvancedDelayProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
     currentSampleRate = sampleRate;
+    slotSeed.update();
     juce::dsp::ProcessSpec spec{ sampleRate, (juce::uint32)samplesPerBlock, (juce::uint32)getTotalNumInputChannels() };
 
     delayLine.prepare(spec);
@@ -47,14 +49,14 @@ void AdvancedDelayProcessor::prepareToPlay(double sampleRate, int samplesPerBloc
 
 void AdvancedDelayProcessor::reset()
 {
+    if (slotSeed.isDeterministic())
+        noiseSource.setSeed(slotSeed.get(0));
+
     delayLine.reset();
     wowLFO.reset();
     flutterLFO.reset();
     tapeFilters.reset();
-    if (mainApvts.getRawParameterValue(timeParamId))
-    {
-        smoothedTimeMs.setCurrentAndTargetValue(mainApvts.getRawParameterValue(timeParamId)->load());
-    }
+    smoothedTimeMs.setCurrentAndTargetValue(timeParam.get());
 }
 
 void AdvancedDelayProcessor::releaseResources() {}
@@ -68,12 +70,8 @@ void AdvancedDelayProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
-    // Safety check for parameters
-    if (!mainApvts.getRawParameterValue(modeParamId) || !mainApvts.getRawParameterValue(timeParamId))
-        return;
-
-    auto mode = static_cast<DelayMode>(static_cast<int>(mainApvts.getRawParameterValue(modeParamId)->load()));
-    smoothedTimeMs.setTargetValue(mainApvts.getRawParameterValue(timeParamId)->load());
+    auto mode = modeParam.getChoice<DelayMode>();
+    smoothedTimeMs.setTargetValue(timeParam.get());
 
     // Note: BBD mode (Blueprint 2.3) requires distinct filtering/companding.
     // For this implementation, Tape and BBD share the core logic in processTapeMode.
@@ -91,12 +89,12 @@ void AdvancedDelayProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
 void AdvancedDelayProcessor::processTapeMode(juce::AudioBuffer<float>& buffer)
 {
     // Get Parameters (Safety check omitted for brevity, but essential)
-    float feedback = mainApvts.getRawParameterValue(feedbackParamId)->load();
-    float mix = mainApvts.getRawParameterValue(mixParamId)->load();
-    float color = mainApvts.getRawParameterValue(colorParamId)->load();
-    float wowDepth = mainApvts.getRawParameterValue(wowParamId)->load();
-    float flutterDepth = mainApvts.getRawParameterValue(flutterParamId)->load();
-    float age = mainApvts.getRawParameterValue(ageParamId)->load();
+    float feedback = feedbackParam.get();
+    float mix = mixParam.get();
+    float color = colorParam.get();
+    float wowDepth = wowParam.get();
+    float flutterDepth = flutterParam.get();
+    float age = ageParam.get();
 
     // Configure Filters (Blueprint 2.2.2)
     tapeFilters.setType(juce::dsp::StateVariableTPTFilterType::lowpass);
@@ -3,6 +3,8 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
 #include "../DSPUtils.h"
+#include "../ParameterHandle.h"
+#include "../SlotSeed.h"
 
 class AdvancedDelayProcessor : public juce::AudioProcessor
 {
@@ -50,7 +52,8 @@ private:
 
     // --- Parameters ---
     juce::AudioProcessorValueTreeState& mainApvts;
-    juce::String modeParamId, timeParamId, feedbackParamId, mixParamId, colorParamId, wowParamId, flutterParamId, ageParamId;
+    ParameterHandle modeParam, timeParam, feedbackParam, mixParam, colorParam, wowParam, flutterParam, ageParam;
+    SlotSeed slotSeed;
 
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> smoothedTimeMs;
 };
\ No newline at end of file
@@ -2,6 +2,7 @@
 // File: FX_Modules/BBDGranularEngine.cpp
 //================================================================================
 #include "BBDGranularEngine.h"
+#include "../SlotSeed.h"
 
 BBDGranularEngine::BBDGranularEngine()
 {
@@ -34,6 +35,12 @@ void BBDGranularEngine::prepare(const juce::dsp::ProcessSpec& spec, const Config
     reset();
 }
 
+void BBDGranularEngine::setSeed(juce::uint32 seed)
+{
+    randomEngine.seed(SlotSeed::mix(seed, 0));
+    noiseGen.setSeed(SlotSeed::mix(seed, 1));
+}
+
 void BBDGranularEngine::reset()
 {
     captureBuffer.reset();
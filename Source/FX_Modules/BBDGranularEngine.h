@@ -30,6 +30,8 @@ public:
     BBDGranularEngine();
     void prepare(const juce::dsp::ProcessSpec& spec, const Config& newConfig, int maxBufferSizeSamples);
     void reset();
+    // Restarts grain scatter and noise from a fixed seed (deterministic renders). Call after reset().
+    void setSeed(juce::uint32 seed);
     void capture(const juce::dsp::AudioBlock<float>& inputBlock);
     void process(juce::dsp::AudioBlock<float>& outputBlock, float density, float timeMs, float spread, float age);
 
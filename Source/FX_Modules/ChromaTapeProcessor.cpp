@@ -11,28 +11,29 @@ ChromaTapeProcessor::ChromaTapeProcessor(juce::AudioProcessorValueTreeState& apv
 {
     // Parameter ID assignments (Unchanged)
     auto slotPrefix = "SLOT_" + juce::String(slotIndex + 1) + "_CT_";
-    saturationParamIds[0] = slotPrefix + "LOW_SATURATION";
-    saturationParamIds[1] = slotPrefix + "MID_SATURATION";
-    saturationParamIds[2] = slotPrefix + "HIGH_SATURATION";
+    saturationParams[0] = ParameterHandle(mainApvts, slotPrefix + "LOW_SATURATION");
+    saturationParams[1] = ParameterHandle(mainApvts, slotPrefix + "MID_SATURATION");
+    saturationParams[2] = ParameterHandle(mainApvts, slotPrefix + "HIGH_SATURATION");
 
-    wowParamIds[0] = slotPrefix + "LOW_WOW";
-    wowParamIds[1] = slotPrefix + "MID_WOW";
-    wowParamIds[2] = slotPrefix + "HIGH_WOW";
+    wowParams[0] = ParameterHandle(mainApvts, slotPrefix + "LOW_WOW");
+    wowParams[1] = ParameterHandle(mainApvts, slotPrefix + "MID_WOW");
+    wowParams[2] = ParameterHandle(mainApvts, slotPrefix + "HIGH_WOW");
 
-    flutterParamIds[0] = slotPrefix + "LOW_FLUTTER";
-    flutterParamIds[1] = slotPrefix + "MID_FLUTTER";
-    flutterParamIds[2] = slotPrefix + "HIGH_FLUTTER";
+    flutterParams[0] = ParameterHandle(mainApvts, slotPrefix + "LOW_FLUTTER");
+    flutterParams[1] = ParameterHandle(mainApvts, slotPrefix + "MID_FLUTTER");
+    flutterParams[2] = ParameterHandle(mainApvts, slotPrefix + "HIGH_FLUTTER");
 
-    lowMidCrossoverParamId = slotPrefix + "LOWMID_CROSS";
-    midHighCrossoverParamId = slotPrefix + "MIDHIGH_CROSS";
+    lowMidCrossoverParam = ParameterHandle(mainApvts, slotPrefix + "LOWMID_CROSS");
+    midHighCrossoverParam = ParameterHandle(mainApvts, slotPrefix + "MIDHIGH_CROSS");
 
     // NEW: Assign IDs for new parameters
-    scrapeParamId = slotPrefix + "SCRAPE_FLUTTER";
-    chaosParamId = slotPrefix + "CHAOS_AMOUNT";
-    hissParamId = slotPrefix + "HISS_LEVEL";
-    humParamId = slotPrefix + "HUM_LEVEL";
-    headBumpFreqParamId = slotPrefix + "HEADBUMP_FREQ";
-    headBumpGainParamId = slotPrefix + "HEADBUMP_GAIN";
+    scrapeParam = ParameterHandle(mainApvts, slotPrefix + "SCRAPE_FLUTTER");
+    chaosParam = ParameterHandle(mainApvts, slotPrefix + "CHAOS_AMOUNT");
+    hissParam = ParameterHandle(mainApvts, slotPrefix + "HISS_LEVEL");
+    humParam = ParameterHandle(mainApvts, slotPrefix + "HUM_LEVEL");
+    headBumpFreqParam = ParameterHandle(mainApvts, slotPrefix + "HEADBUMP_FREQ");
+    headBumpGainParam = ParameterHandle(mainApvts, slotPrefix + "HEADBUMP_GAIN");
+    slotSeed = SlotSeed(mainApvts, slotIndex);
 }
 
 ChromaTapeProcessor::~ChromaTapeProcessor()
@@ -42,6 +43,7 @@ ChromaTapeProcessor::~ChromaTapeProcessor()
 // Updated prepareToPlay
 void ChromaTapeProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    slotSeed.update();
     juce::dsp::ProcessSpec spec{ sampleRate, (juce::uint32)samplesPerBlock, (juce::uint32)getTotalNumInputChannels() };
     juce::dsp::ProcessSpec monoSpec = spec;
     monoSpec.numChannels = 1;
@@ -174,6 +176,13 @@ void ChromaTapeProcessor::reset()
     humOscillator.reset();
     humHarmonicOscillator.reset();
 
+    if (slotSeed.isDeterministic())
+    {
+        for (int i = 0; i < NUM_BANDS; ++i)
+            bands[i].noiseGen.setSeed(slotSeed.get((juce::uint32)i));
+        hissGenerator.setSeed(slotSeed.get((juce::uint32)NUM_BANDS));
+    }
+
     // OPTIMIZATION FIX: Reset Global Smoothers
     smoothedScrape.setCurrentAndTargetValue(smoothedScrape.getTargetValue());
     smoothedChaos.setCurrentAndTargetValue(smoothedChaos.getTargetValue());
@@ -198,44 +207,28 @@ static float calculateInternalDrive(float saturationDb)
 // Updated updateParameters
 void ChromaTapeProcessor::updateParameters()
 {
-    // Added safety checks for parameter existence
-    if (!mainApvts.getRawParameterValue(lowMidCrossoverParamId) || !mainApvts.getRawParameterValue(midHighCrossoverParamId)) return;
-
-    float lowMidCross = mainApvts.getRawParameterValue(lowMidCrossoverParamId)->load();
-    float midHighCross = mainApvts.getRawParameterValue(midHighCrossoverParamId)->load();
+    float lowMidCross = lowMidCrossoverParam.get();
+    float midHighCross = midHighCrossoverParam.get();
     crossover.setCrossoverFrequencies(lowMidCross, midHighCross);
 
     for (int i = 0; i < NUM_BANDS; ++i)
     {
-        // Added safety checks
-        if (mainApvts.getRawParameterValue(saturationParamIds[i]))
-            bands[i].smoothedSaturationDb.setTargetValue(mainApvts.getRawParameterValue(saturationParamIds[i])->load());
-        if (mainApvts.getRawParameterValue(wowParamIds[i]))
-            bands[i].smoothedWowDepth.setTargetValue(mainApvts.getRawParameterValue(wowParamIds[i])->load());
-        if (mainApvts.getRawParameterValue(flutterParamIds[i]))
-            bands[i].smoothedFlutterDepth.setTargetValue(mainApvts.getRawParameterValue(flutterParamIds[i])->load());
+        bands[i].smoothedSaturationDb.setTargetValue(saturationParams[i].get());
+        bands[i].smoothedWowDepth.setTargetValue(wowParams[i].get());
+        bands[i].smoothedFlutterDepth.setTargetValue(flutterParams[i].get());
     }
 
     // OPTIMIZATION FIX: Update Global Smoothers (Read APVTS once per block)
-    if (mainApvts.getRawParameterValue(scrapeParamId))
-        smoothedScrape.setTargetValue(mainApvts.getRawParameterValue(scrapeParamId)->load());
-    if (mainApvts.getRawParameterValue(chaosParamId))
-        smoothedChaos.setTargetValue(mainApvts.getRawParameterValue(chaosParamId)->load());
-
-    if (mainApvts.getRawParameterValue(hissParamId)) {
-        float hissDb = mainApvts.getRawParameterValue(hissParamId)->load();
-        smoothedHissLevel.setTargetValue(juce::Decibels::decibelsToGain(hissDb));
-    }
-    if (mainApvts.getRawParameterValue(humParamId)) {
-        float humDb = mainApvts.getRawParameterValue(humParamId)->load();
-        smoothedHumLevel.setTargetValue(juce::Decibels::decibelsToGain(humDb));
-    }
+    smoothedScrape.setTargetValue(scrapeParam.get());
+    smoothedChaos.setTargetValue(chaosParam.get());
+    smoothedHissLevel.setTargetValue(juce::Decibels::decibelsToGain(hissParam.get()));
+    smoothedHumLevel.setTargetValue(juce::Decibels::decibelsToGain(humParam.get()));
 
     // Check sample rate validity before calculating coefficients
-    if (!bands[LOW].headBumpFilters.empty() && getSampleRate() > 0 && mainApvts.getRawParameterValue(headBumpFreqParamId) && mainApvts.getRawParameterValue(headBumpGainParamId))
+    if (!bands[LOW].headBumpFilters.empty() && getSampleRate() > 0)
     {
-        float headBumpFreq = mainApvts.getRawParameterValue(headBumpFreqParamId)->load();
-        float headBumpGain = mainApvts.getRawParameterValue(headBumpGainParamId)->load();
+        float headBumpFreq = headBumpFreqParam.get();
+        float headBumpGain = headBumpGainParam.get();
         auto headBumpCoeffs = juce::dsp::IIR::Coefficients<float>::makePeakFilter(getSampleRate(), headBumpFreq, 0.7f, juce::Decibels::decibelsToGain(headBumpGain));
         for (auto& filter : bands[LOW].headBumpFilters) {
             *filter.coefficients = *headBumpCoeffs;
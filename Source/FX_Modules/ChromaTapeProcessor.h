@@ -6,6 +6,8 @@
 #include "../DSPUtils.h"
 // CHANGED: Include the optimized saturation model
 #include "TapeSaturation.h"
+#include "../ParameterHandle.h"
+#include "../SlotSeed.h"
 
 class ChromaTapeProcessor : public juce::AudioProcessor
 {
@@ -130,14 +132,15 @@ private:
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Multiplicative> smoothedHumLevel;
 
     juce::AudioProcessorValueTreeState& mainApvts;
-    std::array<juce::String, NUM_BANDS> saturationParamIds;
-    std::array<juce::String, NUM_BANDS> wowParamIds;
-    std::array<juce::String, NUM_BANDS> flutterParamIds;
-    juce::String lowMidCrossoverParamId, midHighCrossoverParamId;
+    std::array<ParameterHandle, NUM_BANDS> saturationParams;
+    std::array<ParameterHandle, NUM_BANDS> wowParams;
+    std::array<ParameterHandle, NUM_BANDS> flutterParams;
+    ParameterHandle lowMidCrossoverParam, midHighCrossoverParam;
 
     // NEW: Parameter IDs
-    juce::String scrapeParamId, chaosParamId, hissParamId, humParamId;
-    juce::String headBumpFreqParamId, headBumpGainParamId;
+    ParameterHandle scrapeParam, chaosParam, hissParam, humParam;
+    ParameterHandle headBumpFreqParam, headBumpGainParam;
+    SlotSeed slotSeed;
 
     // NEW: Helper methods for the refactored processing
     void updateParameters();
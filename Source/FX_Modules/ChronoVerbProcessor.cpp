@@ -84,7 +84,8 @@ void ChronoVerbProcessor::EarlyReflectionsGenerator::processBlock(const juce::Au
                 float modulatedDelayTime = baseDelayTime * (1.0f + modLFOValue);
                 float delaySamples = modulatedDelayTime * (float)sampleRate;
                 
-                float readPos = (float)multiTapDelay.getWritePosition() - delaySamples - (float)i;
+                // The whole block is already written, so sample i sits (numSamples - i) behind the write head.
+                float readPos = (float)(multiTapDelay.getWritePosition() - numSamples + i) - delaySamples;
                 float tapSample = multiTapDelay.read(ch, readPos);
                 
                 // Apply gain and proper stereo panning
@@ -129,7 +130,7 @@ void ChronoVerbProcessor::LateReflectionsGenerator::processBlock(const juce::Aud
                                                                 juce::AudioBuffer<float>& output, 
                                                                 float diffusion)
 {
-    output.makeCopyOf(input);
+    output.makeCopyOf(input, true);
     
     // Clean spectral diffusion - no unnecessary complexity
     diffuser.process(output, diffusion);
@@ -188,20 +189,23 @@ ChronoVerbProcessor::ChronoVerbProcessor(juce::AudioProcessorValueTreeState& apv
 {
     auto slotPrefix = "SLOT_" + juce::String(slotIndex + 1) + "_CHRONO_";
     
-    sizeParamId = slotPrefix + "SIZE";
-    decayParamId = slotPrefix + "DECAY";
-    balanceParamId = slotPrefix + "BALANCE";
-    freezeParamId = slotPrefix + "FREEZE";
-    diffusionParamId = slotPrefix + "DIFFUSION";
-    dampingParamId = slotPrefix + "DAMPING";
-    modulationParamId = slotPrefix + "MODULATION";
-    mixParamId = slotPrefix + "MIX";
+    sizeParam = ParameterHandle(mainApvts, slotPrefix + "SIZE");
+    decayParam = ParameterHandle(mainApvts, slotPrefix + "DECAY");
+    balanceParam = ParameterHandle(mainApvts, slotPrefix + "BALANCE");
+    freezeParam = ParameterHandle(mainApvts, slotPrefix + "FREEZE");
+    diffusionParam = ParameterHandle(mainApvts, slotPrefix + "DIFFUSION");
+    dampingParam = ParameterHandle(mainApvts, slotPrefix + "DAMPING");
+    modulationParam = ParameterHandle(mainApvts, slotPrefix + "MODULATION");
+    mixParam = ParameterHandle(mainApvts, slotPrefix + "MIX");
+    asyncFramesParam = ParameterHandle(mainApvts, "SPECTRAL_ASYNC");
+    slotSeed = SlotSeed(mainApvts, slotIndex);
 }
 
 void ChronoVerbProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
     this->sampleRate = sampleRate;
     this->maxBlockSize = samplesPerBlock;
+    slotSeed.update();
     
     juce::dsp::ProcessSpec spec{ sampleRate, (juce::uint32)samplesPerBlock, 
                                 (juce::uint32)std::max(getTotalNumInputChannels(), getTotalNumOutputChannels()) };
@@ -209,6 +213,7 @@ void ChronoVerbProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     
     // Prepare DSP modules
     earlyReflections.prepare(spec);
+    lateReflections.setAsyncFrames(asyncFramesParam.isOn());
     lateReflections.prepare(spec);
     feedbackPath.prepare(spec);
     
@@ -229,6 +234,10 @@ void ChronoVerbProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     lateReflectionsBuffer.setSize(numChannels, samplesPerBlock);
     wetBuffer.setSize(numChannels, samplesPerBlock);
     feedbackBuffer.setSize(numChannels, samplesPerBlock);
+
+    feedbackDelaySamples = juce::jmax(1, juce::roundToInt(sampleRate * feedbackDelayMs / 1000.0));
+    feedbackRing.setSize(numChannels, feedbackDelaySamples);
+    subBlockChannels.assign((size_t)numChannels, nullptr);
     
     // Initialize smoothed parameters with proper smoothing time
     double smoothTime = 0.08; // 80ms for smooth, musical parameter changes
@@ -252,6 +261,8 @@ void ChronoVerbProcessor::reset()
 {
     earlyReflections.reset();
     lateReflections.reset();
+    if (slotSeed.isDeterministic())
+        lateReflections.setSeed(slotSeed.get(0));
     feedbackPath.reset();
     preDelay.reset();
     latencyCompensationDelay.reset();
@@ -262,6 +273,8 @@ void ChronoVerbProcessor::reset()
     lateReflectionsBuffer.clear();
     wetBuffer.clear();
     feedbackBuffer.clear();
+    feedbackRing.clear();
+    feedbackRingPos = 0;
     
     updateParameters();
     
@@ -277,20 +290,14 @@ void ChronoVerbProcessor::reset()
 
 void ChronoVerbProcessor::updateParameters()
 {
-    auto getParam = [&](const juce::String& id, float defaultVal = 0.0f) {
-        if (auto* p = mainApvts.getRawParameterValue(id)) 
-            return p->load();
-        return defaultVal;
-    };
-    
-    params.size = getParam(sizeParamId, 0.5f);
-    params.decay = getParam(decayParamId, 0.6f);
-    params.balance = getParam(balanceParamId, 0.5f);
-    params.freeze = getParam(freezeParamId, 0.0f) > 0.5f;
-    params.diffusion = getParam(diffusionParamId, 0.7f);
-    params.damping = getParam(dampingParamId, 0.5f);
-    params.modulation = getParam(modulationParamId, 0.2f);
-    params.mix = getParam(mixParamId, 0.5f);
+    params.size = sizeParam.get();
+    params.decay = decayParam.get();
+    params.balance = balanceParam.get();
+    params.freeze = freezeParam.isOn();
+    params.diffusion = diffusionParam.get();
+    params.damping = dampingParam.get();
+    params.modulation = modulationParam.get();
+    params.mix = mixParam.get();
     
     // Update smoothed parameter targets
     smSize.setTargetValue(params.size);
@@ -319,37 +326,59 @@ void ChronoVerbProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::M
     
     updateParameters();
     
+    // The wet signal is fed back through a fixed feedbackDelaySamples delay, so it is processed in
+    // sub-blocks no longer than that; each sub-block then only reads feedback from earlier ones.
+    const int bufferChannels = juce::jmin(buffer.getNumChannels(), (int)subBlockChannels.size());
+    auto* const* channels = buffer.getArrayOfWritePointers();
+    for (int start = 0; start < numSamples; start += feedbackDelaySamples)
+    {
+        const int length = juce::jmin(feedbackDelaySamples, numSamples - start);
+        for (int ch = 0; ch < bufferChannels; ++ch)
+            subBlockChannels[(size_t)ch] = channels[ch] + start;
+        juce::AudioBuffer<float> subBlock(subBlockChannels.data(), bufferChannels, length);
+        processSubBlock(subBlock, numChannels, totalOut);
+    }
+}
+
+void ChronoVerbProcessor::processSubBlock(juce::AudioBuffer<float>& buffer, int numChannels, int totalOut)
+{
+    int numSamples = buffer.getNumSamples();
+    
     // Ensure buffers are the right size
     preDelayBuffer.setSize(numChannels, numSamples, false, false, true);
     earlyReflectionsBuffer.setSize(numChannels, numSamples, false, false, true);
     lateReflectionsBuffer.setSize(numChannels, numSamples, false, false, true);
     wetBuffer.setSize(numChannels, numSamples, false, false, true);
+    feedbackBuffer.setSize(numChannels, numSamples, false, false, true);
     
     preDelayBuffer.clear();
     earlyReflectionsBuffer.clear();
     lateReflectionsBuffer.clear();
     wetBuffer.clear();
     
-    // Process pre-delay with feedback injection
-    float decayGain = params.freeze ? 0.99f : smDecay.getNextValue() * 1.1f; // Allow >100% for infinite decay
+    // Process pre-delay with feedback injection. Block-rate smoothers advance by the block
+    // length so their ramps take the same time at any block size.
+    float decayGain = params.freeze ? 0.99f : smDecay.skip(numSamples) * 1.1f; // Allow >100% for infinite decay
     
     for (int i = 0; i < numSamples; ++i)
     {
+        float preDelayMs = smSize.getNextValue() * 100.0f; // 0-100ms pre-delay
+        float preDelaySamples = preDelayMs * (float)sampleRate / 1000.0f;
+        preDelay.setDelay(preDelaySamples);
+        
+        const int ringIndex = (feedbackRingPos + i) % feedbackDelaySamples;
+        
         for (int ch = 0; ch < numChannels; ++ch)
         {
             float inputSample = (ch < buffer.getNumChannels()) ? buffer.getSample(ch, i) : 0.0f;
-            float feedbackSample = (ch < feedbackBuffer.getNumChannels()) ? 
-                                   feedbackBuffer.getSample(ch, i) * decayGain : 0.0f;
+            float feedbackSample = (ch < feedbackRing.getNumChannels()) ? 
+                                   feedbackRing.getSample(ch, ringIndex) * decayGain : 0.0f;
             
             // Clean feedback injection
             float inputToEffect = params.freeze ? feedbackSample : (inputSample + feedbackSample);
             
             // Apply pre-delay
             preDelay.pushSample(ch, inputToEffect);
-            float preDelayMs = smSize.getNextValue() * 100.0f; // 0-100ms pre-delay
-            float preDelaySamples = preDelayMs * (float)sampleRate / 1000.0f;
-            preDelay.setDelay(preDelaySamples);
-            
             float preDelayedSample = preDelay.popSample(ch);
             preDelayBuffer.setSample(ch, i, preDelayedSample);
         }
@@ -358,11 +387,11 @@ void ChronoVerbProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::M
     // Path A: Process early reflections
     earlyReflections.processBlock(preDelayBuffer, earlyReflectionsBuffer, 
                                  smSize.getCurrentValue(),
-                                 smModulation.getNextValue());
+                                 smModulation.skip(numSamples));
     
     // Path B: Process late reflections
     lateReflections.processBlock(preDelayBuffer, lateReflectionsBuffer, 
-                                smDiffusion.getNextValue());
+                                smDiffusion.skip(numSamples));
     
     // Apply latency compensation to early reflections
     juce::dsp::AudioBlock<float> erBlock(earlyReflectionsBuffer);
@@ -370,30 +399,41 @@ void ChronoVerbProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::M
     latencyCompensationDelay.process(context);
     
     // Balance early and late reflections - Original simple mix
-    float balance = smBalance.getNextValue();
+    float balance = smBalance.skip(numSamples);
     float erGain = std::cos(balance * juce::MathConstants<float>::halfPi);
     float lrGain = std::sin(balance * juce::MathConstants<float>::halfPi);
     
     // Create wet signal
-    wetBuffer.makeCopyOf(lateReflectionsBuffer);
-    wetBuffer.applyGain(lrGain);
     for (int ch = 0; ch < numChannels; ++ch)
+    {
+        wetBuffer.copyFrom(ch, 0, lateReflectionsBuffer, ch, 0, numSamples, lrGain);
         wetBuffer.addFrom(ch, 0, earlyReflectionsBuffer, ch, 0, numSamples, erGain);
+    }
     
-    // Process feedback path
-    feedbackBuffer.makeCopyOf(wetBuffer);
-    feedbackPath.processBlock(feedbackBuffer, smDamping.getNextValue());
+    // Process feedback path, then queue it in the ring for the next feedbackDelaySamples
+    for (int ch = 0; ch < numChannels; ++ch)
+        feedbackBuffer.copyFrom(ch, 0, wetBuffer, ch, 0, numSamples);
+    feedbackPath.processBlock(feedbackBuffer, smDamping.skip(numSamples));
+    
+    for (int ch = 0; ch < numChannels && ch < feedbackRing.getNumChannels(); ++ch)
+    {
+        const float* fb = feedbackBuffer.getReadPointer(ch);
+        float* ring = feedbackRing.getWritePointer(ch);
+        for (int i = 0; i < numSamples; ++i)
+            ring[(feedbackRingPos + i) % feedbackDelaySamples] = fb[i];
+    }
+    feedbackRingPos = (feedbackRingPos + numSamples) % feedbackDelaySamples;
     
     // Final wet/dry mix - Original simple blend
-    float mix = smMix.getNextValue();
+    float mix = smMix.skip(numSamples);
     float wetGain = std::sin(mix * juce::MathConstants<float>::halfPi);
     float dryGain = std::cos(mix * juce::MathConstants<float>::halfPi);
     
-    for (int ch = 0; ch < totalOut; ++ch)
+    for (int ch = 0; ch < totalOut && ch < buffer.getNumChannels(); ++ch)
     {
         for (int i = 0; i < numSamples; ++i)
         {
-            float dry = (ch < buffer.getNumChannels()) ? buffer.getSample(ch, i) : 0.0f;
+            float dry = buffer.getSample(ch, i);
             float wet = (ch < wetBuffer.getNumChannels()) ? wetBuffer.getSample(ch, i) : 0.0f;
             
             float output = dry * dryGain + wet * wetGain;
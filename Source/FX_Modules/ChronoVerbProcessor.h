@@ -7,6 +7,8 @@
 #include "../../Source/DSPUtils.h"
 #include "../../Source/DSP_Helpers/InterpolatedCircularBuffer.h"
 #include "../../Source/FX_Modules/SpectralDiffuser.h"
+#include "../ParameterHandle.h"
+#include "../SlotSeed.h"
 
 class ChronoVerbProcessor : public juce::AudioProcessor
 {
@@ -75,6 +77,8 @@ private:
         void processBlock(const juce::AudioBuffer<float>& input, juce::AudioBuffer<float>& output, 
                          float diffusion);
         int getLatencySamples() const { return diffuser.getLatencyInSamples(); }
+        void setAsyncFrames(bool shouldBeAsync) { diffuser.setAsyncFrames(shouldBeAsync); }
+        void setSeed(juce::uint32 seed) { diffuser.setSeed(seed); }
 
     private:
         SpectralDiffuser diffuser;
@@ -99,6 +103,7 @@ private:
 
     //==============================================================================
     void updateParameters();
+    void processSubBlock(juce::AudioBuffer<float>& buffer, int numChannels, int totalOut);
 
     //==============================================================================
     // DSP Modules - Clean architecture
@@ -115,6 +120,13 @@ private:
     juce::AudioBuffer<float> lateReflectionsBuffer;
     juce::AudioBuffer<float> wetBuffer;
     juce::AudioBuffer<float> feedbackBuffer;
+    
+    // Feedback loop delay: fixed in time, so the decay does not depend on the host block size
+    static constexpr double feedbackDelayMs = 10.0;
+    juce::AudioBuffer<float> feedbackRing;
+    int feedbackRingPos = 0;
+    int feedbackDelaySamples = 1;
+    std::vector<float*> subBlockChannels;
 
     // Parameters - Original simple set
     struct ChronoVerbParameters
@@ -135,8 +147,10 @@ private:
                                smDamping, smModulation, smMix;
 
     // Parameter IDs
-    juce::String sizeParamId, decayParamId, balanceParamId, freezeParamId,
-                 diffusionParamId, dampingParamId, modulationParamId, mixParamId;
+    ParameterHandle sizeParam, decayParam, balanceParam, freezeParam,
+                    diffusionParam, dampingParam, modulationParam, mixParam;
+    ParameterHandle asyncFramesParam; // Global SPECTRAL_ASYNC, read when prepared
+    SlotSeed slotSeed;
 
     // Member variables
     juce::AudioProcessorValueTreeState& mainApvts;
@@ -10,11 +10,11 @@ DistortionProcessor::DistortionProcessor(juce::AudioProcessorValueTreeState& apv
     mainApvts(apvts)
 {
     auto slotPrefix = "SLOT_" + juce::String(slotIndex + 1) + "_";
-    driveParamId = slotPrefix + "DISTORTION_DRIVE";
-    levelParamId = slotPrefix + "DISTORTION_LEVEL";
-    typeParamId = slotPrefix + "DISTORTION_TYPE";
-    biasParamId = slotPrefix + "DISTORTION_BIAS";
-    characterParamId = slotPrefix + "DISTORTION_CHARACTER";
+    driveParam = ParameterHandle(mainApvts, slotPrefix + "DISTORTION_DRIVE");
+    levelParam = ParameterHandle(mainApvts, slotPrefix + "DISTORTION_LEVEL");
+    typeParam = ParameterHandle(mainApvts, slotPrefix + "DISTORTION_TYPE");
+    biasParam = ParameterHandle(mainApvts, slotPrefix + "DISTORTION_BIAS");
+    characterParam = ParameterHandle(mainApvts, slotPrefix + "DISTORTION_CHARACTER");
 }
 
 void DistortionProcessor::prepareToPlay(double sampleRate, int samplesPerBlock) {
@@ -94,11 +94,11 @@ void DistortionProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::M
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
-    auto type = static_cast<Algo>(static_cast<int>(mainApvts.getRawParameterValue(typeParamId)->load()));
-    preGain.setGainDecibels(mainApvts.getRawParameterValue(driveParamId)->load());
-    postGain.setGainDecibels(mainApvts.getRawParameterValue(levelParamId)->load());
-    smoothedBias.setTargetValue(mainApvts.getRawParameterValue(biasParamId)->load());
-    smoothedCharacter.setTargetValue(mainApvts.getRawParameterValue(characterParamId)->load());
+    auto type = typeParam.getChoice<Algo>();
+    preGain.setGainDecibels(driveParam.get());
+    postGain.setGainDecibels(levelParam.get());
+    smoothedBias.setTargetValue(biasParam.get());
+    smoothedCharacter.setTargetValue(characterParam.get());
 
     juce::dsp::AudioBlock<float> block(buffer);
     juce::dsp::ProcessContextReplacing<float> context(block);
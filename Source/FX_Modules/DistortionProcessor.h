@@ -2,6 +2,7 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
 #include "../DSPUtils.h" // adjust if build system expects different relative path
+#include "../ParameterHandle.h"
 
 class DistortionProcessor : public juce::AudioProcessor
 {
@@ -47,7 +48,7 @@ private:
     float processGermanium(float x, float stability);
 
     juce::AudioProcessorValueTreeState& mainApvts;
-    juce::String driveParamId, levelParamId, typeParamId, biasParamId, characterParamId;
+    ParameterHandle driveParam, levelParam, typeParam, biasParam, characterParam;
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> smoothedBias;
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> smoothedCharacter;
 };
\ No newline at end of file
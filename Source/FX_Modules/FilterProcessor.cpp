@@ -6,11 +6,11 @@ FilterProcessor::FilterProcessor(juce::AudioProcessorValueTreeState& apvts, int
     mainApvts(apvts)
 {
     auto slotPrefix = "SLOT_" + juce::String(slotIndex + 1) + "_";
-    cutoffParamId = slotPrefix + "FILTER_CUTOFF";
-    resonanceParamId = slotPrefix + "FILTER_RESONANCE";
-    driveParamId = slotPrefix + "FILTER_DRIVE";
-    typeParamId = slotPrefix + "FILTER_TYPE";
-    profileParamId = slotPrefix + "FILTER_PROFILE";
+    cutoffParam = ParameterHandle(mainApvts, slotPrefix + "FILTER_CUTOFF");
+    resonanceParam = ParameterHandle(mainApvts, slotPrefix + "FILTER_RESONANCE");
+    driveParam = ParameterHandle(mainApvts, slotPrefix + "FILTER_DRIVE");
+    typeParam = ParameterHandle(mainApvts, slotPrefix + "FILTER_TYPE");
+    profileParam = ParameterHandle(mainApvts, slotPrefix + "FILTER_PROFILE");
 }
 
 void FilterProcessor::prepareToPlay(double sampleRate, int samplesPerBlock) {
@@ -41,44 +41,44 @@ void FilterProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiB
         buffer.clear(i, 0, buffer.getNumSamples());
     // ========================================
 
-    auto profile = static_cast<Profile>(static_cast<int>(mainApvts.getRawParameterValue(profileParamId)->load()));
+    auto profile = profileParam.getChoice<Profile>();
     juce::dsp::AudioBlock<float> block(buffer);
     juce::dsp::ProcessContextReplacing<float> context(block);
 
-    float rawResonance = mainApvts.getRawParameterValue(resonanceParamId)->load();
+    float rawResonance = resonanceParam.get();
 
     switch (profile)
     {
     case svfProfile:
-        svfFilter.setCutoffFrequency(mainApvts.getRawParameterValue(cutoffParamId)->load());
+        svfFilter.setCutoffFrequency(cutoffParam.get());
         svfFilter.setResonance(rawResonance);
-        svfFilter.setType(static_cast<juce::dsp::StateVariableTPTFilterType>(static_cast<int>(mainApvts.getRawParameterValue(typeParamId)->load())));
+        svfFilter.setType(typeParam.getChoice<juce::dsp::StateVariableTPTFilterType>());
         svfFilter.process(context);
         break;
 
     case transistorLadder:
     {
         ladderFilter.setMode(juce::dsp::LadderFilterMode::LPF24);
-        ladderFilter.setCutoffFrequencyHz(mainApvts.getRawParameterValue(cutoffParamId)->load());
+        ladderFilter.setCutoffFrequencyHz(cutoffParam.get());
         float ladderResonance = juce::jlimit(0.0f, 1.0f, rawResonance / 10.0f);
         ladderFilter.setResonance(ladderResonance);
-        ladderFilter.setDrive(mainApvts.getRawParameterValue(driveParamId)->load());
+        ladderFilter.setDrive(driveParam.get());
         ladderFilter.process(context);
         break;
     }
     case diodeLadder:
     {
         ladderFilter.setMode(juce::dsp::LadderFilterMode::LPF12);
-        ladderFilter.setCutoffFrequencyHz(mainApvts.getRawParameterValue(cutoffParamId)->load());
+        ladderFilter.setCutoffFrequencyHz(cutoffParam.get());
         float ladderResonanceDiode = juce::jlimit(0.0f, 1.0f, rawResonance / 10.0f);
         ladderFilter.setResonance(ladderResonanceDiode);
-        ladderFilter.setDrive(mainApvts.getRawParameterValue(driveParamId)->load());
+        ladderFilter.setDrive(driveParam.get());
         ladderFilter.process(context);
         break;
     }
     case ota:
         svfFilter.setType(juce::dsp::StateVariableTPTFilterType::lowpass);
-        svfFilter.setCutoffFrequency(mainApvts.getRawParameterValue(cutoffParamId)->load());
+        svfFilter.setCutoffFrequency(cutoffParam.get());
         svfFilter.setResonance(rawResonance);
         svfFilter.process(context);
         break;
@@ -1,6 +1,7 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "../ParameterHandle.h"
 
 class FilterProcessor : public juce::AudioProcessor
 {
@@ -34,5 +35,5 @@ private:
     juce::dsp::LadderFilter<float> ladderFilter;
 
     juce::AudioProcessorValueTreeState& mainApvts;
-    juce::String cutoffParamId, resonanceParamId, driveParamId, typeParamId, profileParamId;
+    ParameterHandle cutoffParam, resonanceParam, driveParam, typeParam, profileParam;
 };
\ No newline at end of file
@@ -9,12 +9,12 @@ HelicalDelayProcessor::HelicalDelayProcessor(juce::AudioProcessorValueTreeState&
     mainApvts(apvts)
 {
     auto slotPrefix = "SLOT_" + juce::String(slotIndex + 1) + "_";
-    timeParamId = slotPrefix + "HELICAL_TIME";
-    pitchParamId = slotPrefix + "HELICAL_PITCH";
-    feedbackParamId = slotPrefix + "HELICAL_FEEDBACK";
-    degradeParamId = slotPrefix + "HELICAL_DEGRADE";
-    textureParamId = slotPrefix + "HELICAL_TEXTURE";
-    mixParamId = slotPrefix + "HELICAL_MIX";
+    timeParam = ParameterHandle(mainApvts, slotPrefix + "HELICAL_TIME");
+    pitchParam = ParameterHandle(mainApvts, slotPrefix + "HELICAL_PITCH");
+    feedbackParam = ParameterHandle(mainApvts, slotPrefix + "HELICAL_FEEDBACK");
+    degradeParam = ParameterHandle(mainApvts, slotPrefix + "HELICAL_DEGRADE");
+    textureParam = ParameterHandle(mainApvts, slotPrefix + "HELICAL_TEXTURE");
+    mixParam = ParameterHandle(mainApvts, slotPrefix + "HELICAL_MIX");
 }
 
 void HelicalDelayProcessor::prepareToPlay(double sampleRate, int samplesPerBlock) {
@@ -53,12 +53,12 @@ void HelicalDelayProcessor::reset() {
     degradeFilter.reset();
     textureLFO.reset();
 
-    if (auto* p = mainApvts.getRawParameterValue(timeParamId))    smoothedTimeMs.setCurrentAndTargetValue(p->load());
-    if (auto* p = mainApvts.getRawParameterValue(pitchParamId))   smoothedPitch.setCurrentAndTargetValue(p->load());
-    if (auto* p = mainApvts.getRawParameterValue(feedbackParamId))smoothedFeedback.setCurrentAndTargetValue(p->load());
-    if (auto* p = mainApvts.getRawParameterValue(degradeParamId)) smoothedDegrade.setCurrentAndTargetValue(p->load());
-    if (auto* p = mainApvts.getRawParameterValue(textureParamId)) smoothedTexture.setCurrentAndTargetValue(p->load());
-    if (auto* p = mainApvts.getRawParameterValue(mixParamId))     smoothedMix.setCurrentAndTargetValue(p->load());
+    smoothedTimeMs.setCurrentAndTargetValue(timeParam.get());
+    smoothedPitch.setCurrentAndTargetValue(pitchParam.get());
+    smoothedFeedback.setCurrentAndTargetValue(feedbackParam.get());
+    smoothedDegrade.setCurrentAndTargetValue(degradeParam.get());
+    smoothedTexture.setCurrentAndTargetValue(textureParam.get());
+    smoothedMix.setCurrentAndTargetValue(mixParam.get());
 
     std::fill(readPositions.begin(), readPositions.end(), 0.0);
 }
@@ -72,20 +72,22 @@ void HelicalDelayProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, numSamples);
 
-    smoothedTimeMs.setTargetValue(mainApvts.getRawParameterValue(timeParamId)->load());
-    smoothedPitch.setTargetValue(mainApvts.getRawParameterValue(pitchParamId)->load());
-    smoothedFeedback.setTargetValue(mainApvts.getRawParameterValue(feedbackParamId)->load());
-    smoothedDegrade.setTargetValue(mainApvts.getRawParameterValue(degradeParamId)->load());
-    smoothedTexture.setTargetValue(mainApvts.getRawParameterValue(textureParamId)->load());
-    smoothedMix.setTargetValue(mainApvts.getRawParameterValue(mixParamId)->load());
+    smoothedTimeMs.setTargetValue(timeParam.get());
+    smoothedPitch.setTargetValue(pitchParam.get());
+    smoothedFeedback.setTargetValue(feedbackParam.get());
+    smoothedDegrade.setTargetValue(degradeParam.get());
+    smoothedTexture.setTargetValue(textureParam.get());
+    smoothedMix.setTargetValue(mixParam.get());
 
-    int writePosition = delayBuffer.getWritePosition();
     const int bufferSize = delayBuffer.getSize();
 
-    auto textureMod = textureLFO.getNextStereoSample();
-
+    // The write head and texture LFO advance every sample, so the result does not depend on
+    // how the host splits the stream into blocks.
     for (int i = 0; i < numSamples; ++i)
     {
+        const int writePosition = delayBuffer.getWritePosition();
+        const auto textureMod = textureLFO.getNextStereoSample();
+
         float timeMs        = smoothedTimeMs.getNextValue();
         float pitchSemis    = smoothedPitch.getNextValue();
         float feedback      = smoothedFeedback.getNextValue();
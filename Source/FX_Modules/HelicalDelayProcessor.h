@@ -9,6 +9,7 @@
 // (Build copy resides at Builds/VisualStudio2022/Source/FX_Modules/...)
 #include "../DSPUtils.h"
 #include "../DSP_Helpers/InterpolatedCircularBuffer.h"
+#include "../ParameterHandle.h"
 
 class HelicalDelayProcessor : public juce::AudioProcessor
 {
@@ -42,7 +43,7 @@ private:
     DSPUtils::LFO textureLFO;
 
     juce::AudioProcessorValueTreeState& mainApvts;
-    juce::String timeParamId, pitchParamId, feedbackParamId, degradeParamId, textureParamId, mixParamId;
+    ParameterHandle timeParam, pitchParam, feedbackParam, degradeParam, textureParam, mixParam;
 
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Multiplicative> smoothedTimeMs;
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Multiplicative> smoothedPitch;
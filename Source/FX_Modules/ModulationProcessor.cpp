@@ -6,11 +6,11 @@ ModulationProcessor::ModulationProcessor(juce::AudioProcessorValueTreeState& apv
     mainApvts(apvts)
 {
     auto slotPrefix = "SLOT_" + juce::String(slotIndex + 1) + "_";
-    modeParamId = slotPrefix + "MODULATION_MODE";
-    rateParamId = slotPrefix + "MODULATION_RATE";
-    depthParamId = slotPrefix + "MODULATION_DEPTH";
-    feedbackParamId = slotPrefix + "MODULATION_FEEDBACK";
-    mixParamId = slotPrefix + "MODULATION_MIX";
+    modeParam = ParameterHandle(mainApvts, slotPrefix + "MODULATION_MODE");
+    rateParam = ParameterHandle(mainApvts, slotPrefix + "MODULATION_RATE");
+    depthParam = ParameterHandle(mainApvts, slotPrefix + "MODULATION_DEPTH");
+    feedbackParam = ParameterHandle(mainApvts, slotPrefix + "MODULATION_FEEDBACK");
+    mixParam = ParameterHandle(mainApvts, slotPrefix + "MODULATION_MIX");
 }
 
 void ModulationProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
@@ -45,11 +45,11 @@ void ModulationProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::M
         buffer.clear(i, 0, buffer.getNumSamples());
     // ========================================
 
-    auto mode = static_cast<ModType>(static_cast<int>(mainApvts.getRawParameterValue(modeParamId)->load()));
-    float rate = mainApvts.getRawParameterValue(rateParamId)->load();
-    float depth = mainApvts.getRawParameterValue(depthParamId)->load();
-    float feedback = mainApvts.getRawParameterValue(feedbackParamId)->load();
-    float mix = mainApvts.getRawParameterValue(mixParamId)->load();
+    auto mode = modeParam.getChoice<ModType>();
+    float rate = rateParam.get();
+    float depth = depthParam.get();
+    float feedback = feedbackParam.get();
+    float mix = mixParam.get();
 
     juce::dsp::AudioBlock<float> block(buffer);
     juce::dsp::ProcessContextReplacing<float> context(block);
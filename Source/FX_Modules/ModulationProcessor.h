@@ -1,6 +1,7 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "../ParameterHandle.h"
 
 class ModulationProcessor : public juce::AudioProcessor
 {
@@ -34,5 +35,5 @@ private:
     enum ModType { Chorus, Flanger, Vibrato, Phaser };
 
     juce::AudioProcessorValueTreeState& mainApvts;
-    juce::String modeParamId, rateParamId, depthParamId, feedbackParamId, mixParamId;
+    ParameterHandle modeParam, rateParam, depthParam, feedbackParam, mixParam;
 };
\ No newline at end of file
@@ -7,21 +7,19 @@ MorphoCompProcessor::MorphoCompProcessor(juce::AudioProcessorValueTreeState& apv
     mainApvts(apvts)
 {
     auto slotPrefix = "SLOT_" + juce::String(slotIndex + 1) + "_";
-    amountParamId = slotPrefix + "MORPHO_AMOUNT";
-    responseParamId = slotPrefix + "MORPHO_RESPONSE";
-    modeParamId = slotPrefix + "MORPHO_MODE";
-    morphXParamId = slotPrefix + "MORPHO_X";
-    morphYParamId = slotPrefix + "MORPHO_Y";
-    mixParamId = slotPrefix + "MORPHO_MIX";
+    amountParam = ParameterHandle(mainApvts, slotPrefix + "MORPHO_AMOUNT");
+    responseParam = ParameterHandle(mainApvts, slotPrefix + "MORPHO_RESPONSE");
+    modeParam = ParameterHandle(mainApvts, slotPrefix + "MORPHO_MODE");
+    morphXParam = ParameterHandle(mainApvts, slotPrefix + "MORPHO_X");
+    morphYParam = ParameterHandle(mainApvts, slotPrefix + "MORPHO_Y");
+    mixParam = ParameterHandle(mainApvts, slotPrefix + "MORPHO_MIX");
 }
 
 void MorphoCompProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
     juce::dsp::ProcessSpec spec{ sampleRate, (juce::uint32)samplesPerBlock, (juce::uint32)getTotalNumInputChannels() };
 
-    // UPDATED: Prepare the new analyzers
-    spectralAnalyzer.prepare(spec);
-    transientDetector.prepare(spec);
+    featureExtractor.prepare(spec);
 
     compressor.prepare(spec);
     saturator.prepare(spec);
@@ -30,9 +28,9 @@ void MorphoCompProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     morphXSmoother.reset(sampleRate, 0.1);
     morphYSmoother.reset(sampleRate, 0.1);
 
-    // NEW: Report latency introduced by the analyzers.
-    // The latency is determined by the hop size of the analyzers (e.g., 256 samples).
-    setLatencySamples(transientDetector.getLatencyInSamples());
+    // NEW: Report latency introduced by the analysis.
+    // The latency is determined by the hop size of the analysis (e.g., 256 samples).
+    setLatencySamples(featureExtractor.getLatencyInSamples());
 
     reset();
 }
@@ -42,9 +40,7 @@ void MorphoCompProcessor::releaseResources() {
 }
 
 void MorphoCompProcessor::reset() {
-    // UPDATED: Reset the new analyzers
-    spectralAnalyzer.reset();
-    transientDetector.reset();
+    featureExtractor.reset();
 
     compressor.reset();
     saturator.reset();
@@ -102,44 +98,29 @@ void MorphoCompProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::M
     int numSamples = buffer.getNumSamples();
     int numChannels = totalNumInputChannels;
 
-    // 1. Run Analysis (Sample-by-sample)
-    // We must run the analysis sample-by-sample to update the analyzer states correctly over time.
-    for (int i = 0; i < numSamples; ++i)
-    {
-        // Calculate mono sum
-        float monoSample = 0.0f;
-        for (int ch = 0; ch < numChannels; ++ch)
-        {
-            monoSample += buffer.getSample(ch, i);
-        }
-        if (numChannels > 0)
-            monoSample /= (float)numChannels;
-
-        // Process analysis using the refactored sample-based interface
-        spectralAnalyzer.processSample(monoSample);
-        transientDetector.processSample(monoSample);
-    }
+    // 1. Run Analysis (one STFT per hop of the mono mix feeds both the transient and centroid features)
+    featureExtractor.process(juce::dsp::AudioBlock<const float>(buffer.getArrayOfReadPointers(), (size_t)numChannels, (size_t)numSamples));
 
 
     // 2. Get Parameters and Analysis Results
-    float amount = mainApvts.getRawParameterValue(amountParamId)->load();
-    float response = mainApvts.getRawParameterValue(responseParamId)->load();
-    bool autoMorph = mainApvts.getRawParameterValue(modeParamId)->load() > 0.5f; // 0=Auto, 1=Manual - Corrected logic
-    float mix = mainApvts.getRawParameterValue(mixParamId)->load();
+    float amount = amountParam.get();
+    float response = responseParam.get();
+    bool autoMorph = modeParam.isOn(); // 0=Auto, 1=Manual - Corrected logic
+    float mix = mixParam.get();
 
     float targetX, targetY;
     if (autoMorph)
     {
         // Get analysis results. Since we ran them through the whole block,
         // these return the state at the END of the block (which is fine for setting the target).
-        targetX = transientDetector.getTransientValue();
+        targetX = featureExtractor.getTransientValue();
         // Invert centroid (Low centroid = High Y, more 'Opto/VariMu')
-        targetY = 1.0f - spectralAnalyzer.getSpectralCentroid();
+        targetY = 1.0f - featureExtractor.getSpectralCentroid();
     }
     else
     {
-        targetX = mainApvts.getRawParameterValue(morphXParamId)->load();
-        targetY = mainApvts.getRawParameterValue(morphYParamId)->load();
+        targetX = morphXParam.get();
+        targetY = morphYParam.get();
     }
 
     // 3. Configure Smoothing
@@ -3,8 +3,8 @@
 #include <juce_dsp/juce_dsp.h>
 #include "../DSPUtils.h"
 // NEW: Include the robust analysis helpers
-#include "../DSP_Helpers/SpectralAnalyzer.h"
-#include "../DSP_Helpers/TransientDetector.h"
+#include "../DSP_Helpers/SpectralFeatureExtractor.h"
+#include "../ParameterHandle.h"
 
 // REMOVED: Internal flawed SignalAnalyzer class definition.
 
@@ -64,8 +64,7 @@ private:
 
     // UPDATED: Use the robust analysis helpers instead of the internal analyzer
     // SignalAnalyzer analyzer; // REMOVED
-    SpectralAnalyzer spectralAnalyzer;
-    TransientDetector transientDetector;
+    SpectralFeatureExtractor featureExtractor;
 
     juce::dsp::Compressor<float> compressor;
     juce::dsp::WaveShaper<float> saturator;
@@ -75,5 +74,5 @@ private:
     float currentSaturationDrive = 1.0f;
 
     juce::AudioProcessorValueTreeState& mainApvts;
-    juce::String amountParamId, responseParamId, modeParamId, morphXParamId, morphYParamId, mixParamId;
+    ParameterHandle amountParam, responseParam, modeParam, morphXParam, morphYParam, mixParam;
 };
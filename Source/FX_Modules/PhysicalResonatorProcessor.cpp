@@ -28,6 +28,7 @@ void InternalExciter::reset()
 {
     envelope.reset();
     colorFilter.reset();
+    numScheduledTriggers = 0;
 }
 
 void InternalExciter::trigger()
@@ -35,6 +36,12 @@ void InternalExciter::trigger()
     envelope.noteOn();
 }
 
+void InternalExciter::scheduleTrigger(int sampleOffset)
+{
+    if (numScheduledTriggers < maxScheduledTriggers)
+        scheduledTriggers[(size_t)numScheduledTriggers++] = sampleOffset;
+}
+
 void InternalExciter::process(juce::dsp::AudioBlock<float>& outputBlock, float brightness, int noiseType)
 {
     noiseGen.setType(noiseType == 1 ? DSPUtils::NoiseGenerator::NoiseType::Pink : DSPUtils::NoiseGenerator::NoiseType::White);
@@ -50,8 +57,12 @@ void InternalExciter::process(juce::dsp::AudioBlock<float>& outputBlock, float b
     int numSamples = (int)outputBlock.getNumSamples();
     int numChannels = (int)outputBlock.getNumChannels();
 
+    int nextTrigger = 0;
     for (int i = 0; i < numSamples; ++i)
     {
+        for (; nextTrigger < numScheduledTriggers && scheduledTriggers[(size_t)nextTrigger] <= i; ++nextTrigger)
+            envelope.noteOn();
+
         float env = envelope.getNextSample();
         if (env < 1e-6f)
         {
@@ -68,6 +79,11 @@ void InternalExciter::process(juce::dsp::AudioBlock<float>& outputBlock, float b
             outputBlock.setSample(ch, i, filteredNoise * env);
         }
     }
+
+    // Offsets past the block fire at the start of the next one.
+    if (nextTrigger < numScheduledTriggers)
+        envelope.noteOn();
+    numScheduledTriggers = 0;
 }
 
 // ===================== ExcitationManager Implementation =====================
@@ -75,7 +91,8 @@ void InternalExciter::process(juce::dsp::AudioBlock<float>& outputBlock, float b
 void ExcitationManager::prepare(const juce::dsp::ProcessSpec& spec)
 {
     internalExciter.prepare(spec);
-    transientDetector.prepare(spec);
+    featureExtractor.prepare(spec);
+    transientValues.assign(juce::jmax((size_t)1, (size_t)spec.maximumBlockSize), 0.0f);
     rmsDetector.prepare(spec);
     rmsDetector.setAttackTime(10.0f);
     rmsDetector.setReleaseTime(100.0f);
@@ -85,8 +102,10 @@ void ExcitationManager::prepare(const juce::dsp::ProcessSpec& spec)
 void ExcitationManager::reset()
 {
     internalExciter.reset();
-    transientDetector.reset();
+    featureExtractor.reset();
     rmsDetector.reset();
+    onsetArmed = true;
+    onsetSample = -1;
 }
 
 // Implements the smart normalization logic.
@@ -109,9 +128,13 @@ void ExcitationManager::process(const juce::dsp::AudioBlock<float>& inputBlock,
     }
 
     bool inputIsActive = (totalRms / (float)(numSamples * numChannels)) > kInputThreshold;
+    onsetSample = -1;
 
     if (inputIsActive)
     {
+        if (detectOnsets)
+            detectTransients(inputBlock, false);
+
         // If input is active, use the external audio as the excitation source.
         outputExcitationBlock.copyFrom(inputBlock);
         outputExcitationBlock.multiplyBy(sensitivity);
@@ -119,22 +142,41 @@ void ExcitationManager::process(const juce::dsp::AudioBlock<float>& inputBlock,
     else
     {
         // If input is inactive, check for triggers (transients/gates on the input) to fire the internal exciter.
-        for (int i = 0; i < numSamples; ++i)
-        {
-            float monoSample = 0.0f;
-            for (int ch = 0; ch < numChannels; ++ch)
-                monoSample += inputBlock.getSample(ch, i);
+        detectTransients(inputBlock, true);
+
+        // Process the internal exciter into the output buffer.
+        internalExciter.process(outputExcitationBlock, brightness, noiseType);
+    }
+}
+
+void ExcitationManager::detectTransients(const juce::dsp::AudioBlock<float>& inputBlock, bool triggerExciter)
+{
+    int numSamples = (int)inputBlock.getNumSamples();
+    int maxChunk = (int)transientValues.size();
+
+    // The extractor mixes to mono and reports the transient value of every sample.
+    for (int start = 0; start < numSamples && maxChunk > 0; start += maxChunk)
+    {
+        int length = juce::jmin(maxChunk, numSamples - start);
+        featureExtractor.process(juce::dsp::AudioBlock<const float>(inputBlock.getSubBlock((size_t)start, (size_t)length)), transientValues.data());
 
-            if (numChannels > 0) monoSample /= (float)numChannels;
+        for (int i = 0; i < length; ++i)
+        {
+            const float transient = transientValues[(size_t)i];
+            if (transient > kTriggerThreshold)
+            {
+                if (triggerExciter)
+                    internalExciter.trigger();
 
-            transientDetector.processSample(monoSample);
-            if (transientDetector.getTransientValue() > 0.8f) // High threshold for sharp triggers
+                if (onsetArmed && onsetSample < 0)
+                    onsetSample = start + i;
+                onsetArmed = false;
+            }
+            else if (transient < kRearmThreshold)
             {
-                internalExciter.trigger();
+                onsetArmed = true;
             }
         }
-        // Process the internal exciter into the output buffer.
-        internalExciter.process(outputExcitationBlock, brightness, noiseType);
     }
 }
 
@@ -144,27 +186,12 @@ void ModalResonator::prepare(const juce::dsp::ProcessSpec& spec)
 {
     sampleRate = spec.sampleRate;
     initializeMaterialTables();
-
-    if (channelFilters.size() != spec.numChannels)
-        channelFilters.resize(spec.numChannels);
-
-    // Filters operate independently per channel, prepare with mono spec.
-    juce::dsp::ProcessSpec monoSpec = spec;
-    monoSpec.numChannels = 1;
-
-    for (auto& bank : channelFilters)
-    {
-        for (auto& f : bank)
-        {
-            f.prepare(monoSpec);
-        }
-    }
+    bank.prepare(sampleRate, (int)spec.numChannels, MAX_MODES);
 }
 
 void ModalResonator::reset()
 {
-    for (auto& bank : channelFilters)
-        for (auto& f : bank) f.reset();
+    bank.reset();
 }
 
 // Initialize material tables with musically plausible ratios.
@@ -173,7 +200,7 @@ void ModalResonator::initializeMaterialTables()
     if (tablesInitialized) return;
 
     // Wood (Harmonic series: 1, 2, 3, 4...)
-    for (int i = 0; i < NUM_MODES; ++i)
+    for (int i = 0; i < MAX_MODES; ++i)
     {
         float n = (float)i + 1.0f;
         woodData.ratios[i] = n;
@@ -182,7 +209,7 @@ void ModalResonator::initializeMaterialTables()
     }
 
     // Metal (Vibraphone-like, slightly stretched harmonics)
-    for (int i = 0; i < NUM_MODES; ++i)
+    for (int i = 0; i < MAX_MODES; ++i)
     {
         float n = (float)i + 1.0f;
         const float stretchFactor = 0.01f;
@@ -192,7 +219,7 @@ void ModalResonator::initializeMaterialTables()
     }
 
     // Glass/Bell (Inharmonic, approximation of Chladni plate modes)
-    for (int i = 0; i < NUM_MODES; ++i)
+    for (int i = 0; i < MAX_MODES; ++i)
     {
         float n = (float)i + 1.0f;
         // Scaled down to keep frequencies manageable
@@ -208,8 +235,15 @@ void ModalResonator::computeModeParams(float tuneHz, float structure, float brig
     // Structure: 0.0 Wood -> 0.5 Metal -> 1.0 Glass.
     auto lerp = [](float a, float b, float t) { return a + (b - a) * t; };
     const float split = 0.5f;
+    const float globalGain = 0.1f; // Gain staging for the reference 60 partials (extra partials are quiet)
+
+    // Per-mode factors that only depend on the mode number are built up incrementally:
+    // brightness tilt = base^(0.05 m), and the damping scale is the same for every mode.
+    const float brightStep = std::pow(juce::jmap(brightness, 0.1f, 1.0f), 0.05f);
+    float brightAtten = 1.0f;
+    const float baseDampingScale = std::pow(10.0f, juce::jmap(damping, 0.0f, 1.0f, 1.0f, -2.0f));
 
-    for (int m = 0; m < NUM_MODES; ++m)
+    for (int m = 0; m < numModes; ++m, brightAtten *= brightStep)
     {
         float r, g, q;
 
@@ -231,16 +265,15 @@ void ModalResonator::computeModeParams(float tuneHz, float structure, float brig
             q = lerp(metalData.qs[m], glassData.qs[m], t);
         }
 
-        // 2. Apply Brightness (Spectral Tilt)
-        float brightAtten = std::pow(juce::jmap(brightness, 0.1f, 1.0f), (float)m * 0.05f);
+        // 2. Apply Brightness (Spectral Tilt): brightAtten, see above
 
         // 3. Apply Damping
         // Scales Q. Exponential mapping for wider control range.
-        float dampingScale = std::pow(10.0f, juce::jmap(damping, 0.0f, 1.0f, 1.0f, -2.0f));
+        float dampingScale = baseDampingScale;
 
         // Frequency-dependent damping (coupled with Brightness).
         // Low brightness causes high frequencies to damp faster (higher damping factor).
-        float freqDependentDamping = 1.0f + (1.0f - brightness) * ((float)m / (float)NUM_MODES) * 5.0f;
+        float freqDependentDamping = 1.0f + (1.0f - brightness) * ((float)m / (float)REFERENCE_MODES) * 5.0f;
         dampingScale /= freqDependentDamping;
 
 
@@ -257,11 +290,13 @@ void ModalResonator::computeModeParams(float tuneHz, float structure, float brig
 
         // Final assignments
         modeFreqs[m] = tuneHz * r;
-        modeGains[m] = g * brightAtten * posShape;
+        modeGains[m] = g * brightAtten * posShape * globalGain;
         modeQs[m] = q * dampingScale;
 
         // Safety clamping
-        modeFreqs[m] = juce::jlimit(20.0f, (float)sampleRate * 0.49f, modeFreqs[m]);
+        // Modes above Nyquist are not clamped (which stacked them into identical near-Nyquist
+        // resonators); the bank drops them.
+        modeFreqs[m] = juce::jmax(20.0f, modeFreqs[m]);
         modeQs[m] = juce::jlimit(10.0f, 20000.0f, modeQs[m]);
     }
 }
@@ -270,49 +305,12 @@ void ModalResonator::process(const juce::dsp::AudioBlock<float>& excitationBlock
     juce::dsp::AudioBlock<float>& outputBlock,
     float tune, float structure, float brightness, float damping, float position)
 {
-    if (channelFilters.empty()) return;
-
     float tuneHz = tuneToHz(tune);
     computeModeParams(tuneHz, structure, brightness, damping, position);
 
-    int numChannels = (int)outputBlock.getNumChannels();
-    int numSamples = (int)outputBlock.getNumSamples();
-
-    // Update filter coefficients
-    for (int ch = 0; ch < numChannels; ++ch)
-    {
-        if ((size_t)ch >= channelFilters.size()) continue;
-        auto& bank = channelFilters[(size_t)ch];
-
-        for (int m = 0; m < NUM_MODES; ++m)
-        {
-            *bank[m].coefficients = *juce::dsp::IIR::Coefficients<float>::makeBandPass(sampleRate, modeFreqs[m], modeQs[m]);
-        }
-    }
-
-    // Process audio
-    for (int i = 0; i < numSamples; ++i)
-    {
-        for (int ch = 0; ch < numChannels; ++ch)
-        {
-            if ((size_t)ch >= channelFilters.size()) continue;
-
-            float in = excitationBlock.getSample(ch, i);
-            float acc = 0.0f;
-            auto& bank = channelFilters[(size_t)ch];
-
-            // Parallel filter bank processing
-            for (int m = 0; m < NUM_MODES; ++m)
-            {
-                // IIR::Filter::processSample does not take channel index when prepared with monoSpec.
-                float filtered = bank[m].processSample(in);
-                acc += filtered * modeGains[m];
-            }
-
-            const float globalGain = 0.1f; // Gain staging for 60 partials
-            outputBlock.setSample(ch, i, acc * globalGain);
-        }
-    }
+    // The bank glides from the previous parameters to these across the block.
+    bank.setModes(modeFreqs.data(), modeQs.data(), modeGains.data(), numModes);
+    bank.process(juce::dsp::AudioBlock<const float>(excitationBlock), outputBlock);
 }
 
 // ===================== SympatheticStringResonator Implementation =====================
@@ -322,58 +320,67 @@ void SympatheticStringResonator::prepare(const juce::dsp::ProcessSpec& spec)
     sampleRate = spec.sampleRate;
     maxDelaySamples = (int)(sampleRate / 20.0) + 100; // Max delay for 20Hz fundamental
 
-    channelDelays.resize(spec.numChannels);
-    channelFilters.resize(spec.numChannels);
-    feedbackGains.resize(spec.numChannels);
-    summedFeedbackState.resize(spec.numChannels, 0.0f);
-
-    juce::dsp::ProcessSpec monoSpec = spec;
-    monoSpec.numChannels = 1;
-
-    for (size_t ch = 0; ch < spec.numChannels; ++ch)
+    banks.resize(spec.numChannels);
+    for (auto& bank : banks)
     {
-        for (int s = 0; s < NUM_STRINGS; ++s)
-        {
-            channelDelays[ch][s].setMaximumDelayInSamples(maxDelaySamples);
-            channelDelays[ch][s].prepare(spec);
-            channelFilters[ch][s].prepare(monoSpec);
-        }
+        bank.setNumStrings(numStrings);
+        bank.prepare(sampleRate, maxDelaySamples);
     }
+    linkedInput.assign(spec.maximumBlockSize, 0.0f);
     reset();
 }
 
 void SympatheticStringResonator::reset()
 {
-    for (auto& bank : channelDelays) for (auto& d : bank) d.reset();
-    for (auto& bank : channelFilters) for (auto& f : bank) f.reset();
-    for (auto& bank : feedbackGains) std::fill(bank.begin(), bank.end(), 0.0f);
-    std::fill(summedFeedbackState.begin(), summedFeedbackState.end(), 0.0f);
+    for (auto& bank : banks) bank.reset();
+}
+
+void SympatheticStringResonator::setNumStrings(int newNumStrings)
+{
+    numStrings = juce::jlimit(1, MAX_STRINGS, newNumStrings);
+    for (auto& bank : banks) bank.setNumStrings(numStrings);
+}
+
+void SympatheticStringResonator::setStereoLinked(bool shouldBeLinked)
+{
+    if (shouldBeLinked == stereoLinked) return;
+    stereoLinked = shouldBeLinked;
+    reset(); // The banks' states belong to the other layout
 }
 
 void SympatheticStringResonator::updateTunings(float structure)
 {
     // Smoothly interpolate between musical interval sets.
-    const std::array<float, 6> unison = { 1.0f, 2.0f, 0.5f, 4.0f, 1.01f, 0.99f };
-    const std::array<float, 6> fifths = { 1.0f, 1.5f, 2.0f, 3.0f, 0.5f, 0.75f };
-    const std::array<float, 6> major = { 1.0f, 1.25f, 1.5f, 2.0f, 2.5f, 3.0f };
-    const std::array<float, 6> minor = { 1.0f, 1.189f, 1.5f, 2.0f, 2.378f, 3.0f }; // Approx minor third
+    const std::array<float, NUM_BASE_STRINGS> unison = { 1.0f, 2.0f, 0.5f, 4.0f, 1.01f, 0.99f };
+    const std::array<float, NUM_BASE_STRINGS> fifths = { 1.0f, 1.5f, 2.0f, 3.0f, 0.5f, 0.75f };
+    const std::array<float, NUM_BASE_STRINGS> major = { 1.0f, 1.25f, 1.5f, 2.0f, 2.5f, 3.0f };
+    const std::array<float, NUM_BASE_STRINGS> minor = { 1.0f, 1.189f, 1.5f, 2.0f, 2.378f, 3.0f }; // Approx minor third
 
     auto lerp = [](float a, float b, float t) { return a + (b - a) * t; };
 
     if (structure < 0.33f)
     {
         float t = structure / 0.33f;
-        for (int i = 0; i < NUM_STRINGS; ++i) currentRatios[i] = lerp(unison[i], fifths[i], t);
+        for (int i = 0; i < NUM_BASE_STRINGS; ++i) currentRatios[i] = lerp(unison[i], fifths[i], t);
     }
     else if (structure < 0.66f)
     {
         float t = (structure - 0.33f) / 0.33f;
-        for (int i = 0; i < NUM_STRINGS; ++i) currentRatios[i] = lerp(fifths[i], major[i], t);
+        for (int i = 0; i < NUM_BASE_STRINGS; ++i) currentRatios[i] = lerp(fifths[i], major[i], t);
     }
     else
     {
         float t = (structure - 0.66f) / 0.34f;
-        for (int i = 0; i < NUM_STRINGS; ++i) currentRatios[i] = lerp(major[i], minor[i], t);
+        for (int i = 0; i < NUM_BASE_STRINGS; ++i) currentRatios[i] = lerp(major[i], minor[i], t);
+    }
+
+    // Further sets of six: an octave up, an octave down, two octaves up; slightly detuned so
+    // unison sets beat against each other like a real harp's neighbouring courses.
+    const std::array<float, MAX_STRINGS / NUM_BASE_STRINGS> setScales = { 1.0f, 2.0f, 0.5f, 4.0f };
+    for (int i = NUM_BASE_STRINGS; i < MAX_STRINGS; ++i)
+    {
+        const int set = i / NUM_BASE_STRINGS;
+        currentRatios[i] = currentRatios[i % NUM_BASE_STRINGS] * setScales[set] * (1.0f + 0.002f * (float)set);
     }
 }
 
@@ -388,62 +395,45 @@ void SympatheticStringResonator::process(const juce::dsp::AudioBlock<float>& exc
     float feedbackGain = std::pow(damping, 0.3f) * 0.998f;
     float brightnessCutoff = juce::jmap(brightness, 500.0f, (float)sampleRate * 0.45f);
 
-    int numChannels = (int)outputBlock.getNumChannels();
-    int numSamples = (int)outputBlock.getNumSamples();
+    // Coupling and output level were set for six strings; more strings share them so the
+    // summed feedback (and loudness) stays where it was.
+    // The coupling subtracts: with every string feeding back in phase the loop gain is
+    // feedbackGain * (1 + N * coupling), which a positive share pushed above one (the bank grew
+    // without bound for any damping above ~0.2). Within [-2/N, 0] the mixing is passive.
+    const float stringScale = (float)NUM_BASE_STRINGS / (float)numStrings;
+    const float couplingFactor = -0.1f * stringScale;
+    const float outputGain = 0.25f * std::sqrt(stringScale);
 
-    // Update Delays and Filters
-    for (int ch = 0; ch < numChannels; ++ch)
-    {
-        if ((size_t)ch >= channelDelays.size()) continue;
+    const int numChannels = juce::jmin((int)outputBlock.getNumChannels(), (int)banks.size());
+    const int numSamples = (int)outputBlock.getNumSamples();
 
-        for (int s = 0; s < NUM_STRINGS; ++s)
-        {
-            float freq = tuneHz * currentRatios[s];
-            float delayTimeSamples = (float)sampleRate / juce::jlimit(20.0f, (float)sampleRate * 0.45f, freq);
-            channelDelays[ch][s].setDelay(delayTimeSamples);
-            channelFilters[ch][s].setCutoffFrequency(brightnessCutoff);
-        }
+    for (int s = 0; s < numStrings; ++s)
+    {
+        float freq = tuneHz * currentRatios[s];
+        delaySamples[s] = (float)sampleRate / juce::jlimit(20.0f, (float)sampleRate * 0.45f, freq);
     }
 
-    // Process Audio with Coupling (All-to-all mixing)
-    for (int i = 0; i < numSamples; ++i)
+    if (stereoLinked && numChannels >= 2 && numSamples <= (int)linkedInput.size())
     {
-        for (int ch = 0; ch < numChannels; ++ch)
-        {
-            if ((size_t)ch >= channelDelays.size()) continue;
-
-            float in = excitationBlock.getSample(ch, i);
-            float acc = 0.0f;
-            float currentSummedFeedback = 0.0f;
-
-            // Process each string
-            for (int s = 0; s < NUM_STRINGS; ++s)
-            {
-                float delayedSample = channelDelays[ch][s].popSample(ch);
-
-                // Apply damping filter. FirstOrderTPTFilter prepared with monoSpec uses channel 0.
-                float dampedSample = channelFilters[ch][s].processSample(0, delayedSample);
-
-                // Calculate input to the delay line: Excitation + Feedback + Coupling term.
-                const float couplingFactor = 0.1f;
-                // summedFeedbackState[ch] holds the value from the previous sample iteration (i-1).
-                float newSample = in + feedbackGains[ch][s] + summedFeedbackState[ch] * couplingFactor;
-
-                channelDelays[ch][s].pushSample(ch, newSample);
-
-                // Update feedback gain storage for the next sample
-                feedbackGains[ch][s] = dampedSample * feedbackGain;
-
-                currentSummedFeedback += feedbackGains[ch][s];
-                acc += dampedSample;
-            }
-
-            // Update the state for the next iteration (i+1)
-            summedFeedbackState[ch] = currentSummedFeedback;
+        // One bank on the average of the first two channels, decorrelated across them.
+        juce::FloatVectorOperations::add(linkedInput.data(), excitationBlock.getChannelPointer(0), excitationBlock.getChannelPointer(1), numSamples);
+        juce::FloatVectorOperations::multiply(linkedInput.data(), 0.5f, numSamples);
+
+        banks[0].setParameters(delaySamples.data(), brightnessCutoff, feedbackGain, couplingFactor);
+        banks[0].process(linkedInput.data(), outputBlock.getChannelPointer(0), outputBlock.getChannelPointer(1), numSamples);
+
+        for (int ch = 0; ch < 2; ++ch)
+            juce::FloatVectorOperations::multiply(outputBlock.getChannelPointer((size_t)ch), outputGain, numSamples);
+        for (int ch = 2; ch < (int)outputBlock.getNumChannels(); ++ch)
+            juce::FloatVectorOperations::clear(outputBlock.getChannelPointer((size_t)ch), numSamples);
+        return;
+    }
 
-            // Write final output (scaled down)
-            outputBlock.setSample(ch, i, acc * 0.25f);
-        }
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        banks[(size_t)ch].setParameters(delaySamples.data(), brightnessCutoff, feedbackGain, couplingFactor);
+        banks[(size_t)ch].process(excitationBlock.getChannelPointer((size_t)ch), outputBlock.getChannelPointer((size_t)ch), nullptr, numSamples);
+        juce::FloatVectorOperations::multiply(outputBlock.getChannelPointer((size_t)ch), outputGain, numSamples);
     }
 }
 
@@ -452,35 +442,26 @@ void SympatheticStringResonator::process(const juce::dsp::AudioBlock<float>& exc
 void StringResonator::prepare(const juce::dsp::ProcessSpec& spec)
 {
     sampleRate = spec.sampleRate;
-    maxDelaySamples = (int)(sampleRate / 20.0) + 100;
-
-    channelDelays.resize(spec.numChannels);
-    channelDampingFilters.resize(spec.numChannels);
-    channelDispersionFilters1.resize(spec.numChannels);
-    channelDispersionFilters2.resize(spec.numChannels);
-    feedback.resize(spec.numChannels, 0.0f);
-
-    juce::dsp::ProcessSpec monoSpec = spec;
-    monoSpec.numChannels = 1;
-
-    for (size_t ch = 0; ch < spec.numChannels; ++ch)
-    {
-        channelDelays[ch].setMaximumDelayInSamples(maxDelaySamples);
-        channelDelays[ch].prepare(spec);
-        channelDampingFilters[ch].prepare(monoSpec);
-        channelDispersionFilters1[ch].prepare(monoSpec);
-        channelDispersionFilters2[ch].prepare(monoSpec);
-    }
+    const int maxDelaySamples = (int)(sampleRate / 20.0) + 100;
+    voicePool.prepare(sampleRate, (int)spec.numChannels, maxDelaySamples);
     reset();
 }
 
 void StringResonator::reset()
 {
-    for (auto& d : channelDelays) d.reset();
-    for (auto& f : channelDampingFilters) f.reset();
-    for (auto& f : channelDispersionFilters1) f.reset();
-    for (auto& f : channelDispersionFilters2) f.reset();
-    std::fill(feedback.begin(), feedback.end(), 0.0f);
+    voicePool.reset();
+    pendingPluck = false;
+}
+
+void StringResonator::setTriggerMode(TriggerMode newMode)
+{
+    if (newMode == triggerMode) return;
+
+    // Strings from the previous mode ring out.
+    if (triggerMode == TriggerMode::Continuous) voicePool.stopDrone();
+    if (triggerMode == TriggerMode::Midi) voicePool.allNotesOff();
+    triggerMode = newMode;
+    pendingPluck = false;
 }
 
 void StringResonator::process(const juce::dsp::AudioBlock<float>& excitationBlock,
@@ -489,81 +470,21 @@ void StringResonator::process(const juce::dsp::AudioBlock<float>& excitationBloc
 {
     juce::ignoreUnused(position); // unused param warning fix
     float tuneHz = tuneToHz(tune);
-    float baseDelayTimeSamples = (float)sampleRate / juce::jlimit(20.0f, (float)sampleRate * 0.45f, tuneHz);
 
     float feedbackGain = std::pow(damping, 0.4f) * 0.999f;
     float brightnessCutoff = juce::jmap(brightness, 800.0f, (float)sampleRate * 0.48f);
     float dispersionAmount = juce::jmap(structure, 0.0f, 0.5f); // Structure controls inharmonicity
 
-    int numChannels = (int)outputBlock.getNumChannels();
-    int numSamples = (int)outputBlock.getNumSamples();
-
-    // Configure Filters and Delay Compensation
-    for (int ch = 0; ch < numChannels; ++ch)
-    {
-        if ((size_t)ch >= channelDelays.size()) continue;
-
-        // 1. Configure absorption filter (one-pole LPF)
-        channelDampingFilters[ch].setCutoffFrequency(brightnessCutoff);
-
-        // 2. Configure dispersion filters (two cascaded all-pass filters)
-        float f1 = juce::jmap(dispersionAmount, 0.25f, 0.5f) * (float)sampleRate;
-        float f2 = juce::jmap(dispersionAmount, 0.1f, 0.25f) * (float)sampleRate;
+    // Filter coefficients and the pitch compensation are only recomputed when these change.
+    voicePool.setParameters(brightnessCutoff, dispersionAmount, feedbackGain);
 
-        *channelDispersionFilters1[ch].coefficients = *juce::dsp::IIR::Coefficients<float>::makeAllPass(sampleRate, f1);
-        *channelDispersionFilters2[ch].coefficients = *juce::dsp::IIR::Coefficients<float>::makeAllPass(sampleRate, f2);
+    if (triggerMode == TriggerMode::Continuous)
+        voicePool.setDrone(tuneHz);
+    else if (triggerMode == TriggerMode::Transients && pendingPluck)
+        voicePool.noteOn(-1, tuneHz, 1.0f);
+    pendingPluck = false;
 
-        // 3. Delay Compensation (Crucial for pitch stability)
-        // Improved approximation for the phase delay of the filters.
-
-        // Approximation for the one-pole LPF phase delay
-        float dampingPhaseDelay = 0.0f;
-        if (brightnessCutoff < (float)sampleRate * 0.5f)
-        {
-            // Phase delay estimation based on cutoff frequency relative to Nyquist
-            dampingPhaseDelay = std::atan(brightnessCutoff / ((float)sampleRate * 0.5f)) / juce::MathConstants<float>::pi;
-        }
-
-        // Heuristic approximation for the all-pass filters
-        float dispersionPhaseDelay = dispersionAmount * 4.0f;
-
-        float totalPhaseDelay = dampingPhaseDelay + dispersionPhaseDelay;
-
-        // Apply compensated delay time
-        float compensatedDelay = baseDelayTimeSamples - totalPhaseDelay;
-        channelDelays[ch].setDelay(juce::jmax(1.0f, compensatedDelay));
-    }
-
-    // Process Audio (Extended Karplus-Strong Loop)
-    for (int i = 0; i < numSamples; ++i)
-    {
-        for (int ch = 0; ch < numChannels; ++ch)
-        {
-            if ((size_t)ch >= channelDelays.size()) continue;
-
-            float in = excitationBlock.getSample(ch, i);
-            float delayedSample = channelDelays[ch].popSample(ch);
-
-            // Feedback loop processing (The "String")
-
-            // 1. Absorption (Damping). TPT filters prepared with monoSpec use channel 0.
-            float dampedSample = channelDampingFilters[ch].processSample(0, delayedSample);
-
-            // 2. Dispersion (Inharmonicity). IIR filters (monoSpec) do not use channel index.
-            float dispersedSample1 = channelDispersionFilters1[ch].processSample(dampedSample);
-            float dispersedSample2 = channelDispersionFilters2[ch].processSample(dispersedSample1);
-
-            // Calculate input to the delay line (Excitation + Feedback)
-            float newSample = in + feedback[ch];
-            channelDelays[ch].pushSample(ch, newSample);
-
-            // Update feedback storage
-            feedback[ch] = dispersedSample2 * feedbackGain;
-
-            // Output the result
-            outputBlock.setSample(ch, i, dispersedSample2 * 0.8f);
-        }
-    }
+    voicePool.process(juce::dsp::AudioBlock<const float>(excitationBlock), outputBlock);
 }
 
 // ===================== PhysicalResonatorProcessor Implementation =====================
@@ -575,19 +496,25 @@ PhysicalResonatorProcessor::PhysicalResonatorProcessor(juce::AudioProcessorValue
 {
     // Initialize parameter IDs based on the plugin's naming scheme
     auto slotPrefix = "SLOT_" + juce::String(slotIndex + 1) + "_PHYSRES_";
-    modelParamId = slotPrefix + "MODEL";
-    tuneParamId = slotPrefix + "TUNE";
-    structureParamId = slotPrefix + "STRUCTURE";
-    brightnessParamId = slotPrefix + "BRIGHTNESS";
-    dampingParamId = slotPrefix + "DAMPING";
-    positionParamId = slotPrefix + "POSITION";
-    sensitivityParamId = slotPrefix + "SENSITIVITY";
-    mixParamId = slotPrefix + "MIX";
-    noiseTypeParamId = slotPrefix + "NOISE_TYPE";
+    modelParam = ParameterHandle(mainApvts, slotPrefix + "MODEL");
+    tuneParam = ParameterHandle(mainApvts, slotPrefix + "TUNE");
+    structureParam = ParameterHandle(mainApvts, slotPrefix + "STRUCTURE");
+    brightnessParam = ParameterHandle(mainApvts, slotPrefix + "BRIGHTNESS");
+    dampingParam = ParameterHandle(mainApvts, slotPrefix + "DAMPING");
+    positionParam = ParameterHandle(mainApvts, slotPrefix + "POSITION");
+    sensitivityParam = ParameterHandle(mainApvts, slotPrefix + "SENSITIVITY");
+    mixParam = ParameterHandle(mainApvts, slotPrefix + "MIX");
+    noiseTypeParam = ParameterHandle(mainApvts, slotPrefix + "NOISE_TYPE");
+    partialsParam = ParameterHandle(mainApvts, slotPrefix + "PARTIALS");
+    stringsParam = ParameterHandle(mainApvts, slotPrefix + "STRINGS");
+    stereoLinkParam = ParameterHandle(mainApvts, slotPrefix + "STEREO_LINK");
+    stringTriggerParam = ParameterHandle(mainApvts, slotPrefix + "STRING_TRIGGER");
+    slotSeed = SlotSeed(mainApvts, slotIndex);
 }
 
 void PhysicalResonatorProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    slotSeed.update();
     juce::uint32 numChannels = (juce::uint32)std::max(getTotalNumInputChannels(), getTotalNumOutputChannels());
     if (numChannels == 0) numChannels = 2;
 
@@ -613,7 +540,7 @@ void PhysicalResonatorProcessor::prepareToPlay(double sampleRate, int samplesPer
     smoothedPosition.reset(sampleRate, smoothingTime);
     smoothedMix.reset(sampleRate, smoothingTime);
 
-    updateResonatorCore((int)mainApvts.getRawParameterValue(modelParamId)->load());
+    updateResonatorCore(modelParam.getIndex());
     reset();
 }
 
@@ -624,6 +551,9 @@ void PhysicalResonatorProcessor::releaseResources()
 
 void PhysicalResonatorProcessor::reset()
 {
+    if (slotSeed.isDeterministic())
+        excitationManager.setSeed(slotSeed.get(0));
+
     excitationManager.reset();
     modalResonator.reset();
     sympatheticResonator.reset();
@@ -648,6 +578,13 @@ void PhysicalResonatorProcessor::updateResonatorCore(int newModelIndex)
     }
 }
 
+int PhysicalResonatorProcessor::getNumPartials(int choiceIndex)
+{
+    // Matches the PARTIALS choices: 16, 32, 60, 120, 240.
+    static constexpr int counts[] = { 16, 32, ModalResonator::REFERENCE_MODES, 120, ModalResonator::MAX_MODES };
+    return counts[juce::jlimit(0, (int)std::size(counts) - 1, choiceIndex)];
+}
+
 bool PhysicalResonatorProcessor::checkAndHandleInstability(float sampleValue)
 {
     // Check for NaN, Inf, or excessively large values which indicate DSP instability.
@@ -664,7 +601,17 @@ bool PhysicalResonatorProcessor::checkAndHandleInstability(float sampleValue)
     return false;
 }
 
-void PhysicalResonatorProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
+void PhysicalResonatorProcessor::handleStringMidi(const juce::MidiMessage& message)
+{
+    if (message.isNoteOn())
+        stringResonator.noteOn(message.getNoteNumber(), message.getFloatVelocity());
+    else if (message.isNoteOff())
+        stringResonator.noteOff(message.getNoteNumber());
+    else if (message.isAllNotesOff() || message.isAllSoundOff())
+        stringResonator.allNotesOff();
+}
+
+void PhysicalResonatorProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
     auto totalIn = getTotalNumInputChannels();
@@ -681,24 +628,28 @@ void PhysicalResonatorProcessor::processBlock(juce::AudioBuffer<float>& buffer,
     instabilityFlag = false;
 
     // Handle Model Switching
-    int modelIndex = (int)mainApvts.getRawParameterValue(modelParamId)->load();
+    int modelIndex = modelParam.getIndex();
     updateResonatorCore(modelIndex);
+    modalResonator.setNumPartials(getNumPartials(partialsParam.getIndex()));
+    sympatheticResonator.setNumStrings((stringsParam.getIndex() + 1) * SympatheticStringResonator::NUM_BASE_STRINGS);
+    sympatheticResonator.setStereoLinked(stereoLinkParam.isOn());
 
-    if (!activeResonator) return;
+    using TriggerMode = StringResonator::TriggerMode;
+    const bool stringModel = activeResonator == &stringResonator;
+    const auto triggerMode = stringTriggerParam.getChoice<TriggerMode>();
+    stringResonator.setTriggerMode(triggerMode);
+    excitationManager.setDetectOnsets(stringModel && triggerMode == TriggerMode::Transients);
+    const bool playsNotes = stringModel && triggerMode == TriggerMode::Midi;
 
-    // Parameter Handling
-    auto getParam = [&](const juce::String& id) {
-        if (auto* p = mainApvts.getRawParameterValue(id)) return p->load();
-        return 0.0f;
-        };
+    if (!activeResonator) return;
 
     // Update smoothed parameter targets
-    smoothedTune.setTargetValue(getParam(tuneParamId));
-    smoothedStructure.setTargetValue(getParam(structureParamId));
-    smoothedBrightness.setTargetValue(getParam(brightnessParamId));
-    smoothedDamping.setTargetValue(getParam(dampingParamId));
-    smoothedPosition.setTargetValue(getParam(positionParamId));
-    smoothedMix.setTargetValue(getParam(mixParamId));
+    smoothedTune.setTargetValue(tuneParam.get());
+    smoothedStructure.setTargetValue(structureParam.get());
+    smoothedBrightness.setTargetValue(brightnessParam.get());
+    smoothedDamping.setTargetValue(dampingParam.get());
+    smoothedPosition.setTargetValue(positionParam.get());
+    smoothedMix.setTargetValue(mixParam.get());
 
     // Ensure buffers are correctly sized
     if (excitationBuffer.getNumSamples() < numSamples || excitationBuffer.getNumChannels() < numChannels)
@@ -712,26 +663,43 @@ void PhysicalResonatorProcessor::processBlock(juce::AudioBuffer<float>& buffer,
     juce::dsp::AudioBlock<float> excitationBlock(excitationBuffer);
     juce::dsp::AudioBlock<float> wetBlock(wetOutputBuffer);
 
-    // 1. Generate Excitation Signal
-    excitationManager.process(mainBlock, excitationBlock,
-        getParam(brightnessParamId), // Brightness affects internal exciter
-        getParam(sensitivityParamId),
-        (int)getParam(noiseTypeParamId));
+    // 1. Generate Excitation Signal (every note strikes the internal exciter at its own sample,
+    // inside the sub-block that starts its voice; heard without input)
+    if (playsNotes)
+        for (const auto metadata : midiMessages)
+            if (metadata.getMessage().isNoteOn())
+                excitationManager.scheduleTrigger(metadata.samplePosition);
 
-    // 2. Process through Resonator (Sample by sample for smoothing)
-    for (int i = 0; i < numSamples; ++i)
+    excitationManager.process(mainBlock, excitationBlock,
+        brightnessParam.get(), // Brightness affects internal exciter
+        sensitivityParam.get(),
+        noiseTypeParam.getIndex());
+    const int onsetSample = stringModel ? excitationManager.getOnsetSample() : -1;
+    auto nextMidiEvent = midiMessages.cbegin();
+
+    // 2. Process through Resonator, at the core's control rate (sample by sample unless it glides)
+    const int controlInterval = juce::jmax(1, activeResonator->getControlInterval());
+    for (int i = 0; i < numSamples; i += controlInterval)
     {
-        float tune = smoothedTune.getNextValue();
-        float structure = smoothedStructure.getNextValue();
-        float brightness = smoothedBrightness.getNextValue();
-        float damping = smoothedDamping.getNextValue();
-        float position = smoothedPosition.getNextValue();
+        const int length = juce::jmin(controlInterval, numSamples - i);
+
+        // Parameters as they stand at the end of the sub-block
+        float tune = smoothedTune.skip(length);
+        float structure = smoothedStructure.skip(length);
+        float brightness = smoothedBrightness.skip(length);
+        float damping = smoothedDamping.skip(length);
+        float position = smoothedPosition.skip(length);
+
+        // Onsets and notes start strings at the sub-block they fall in.
+        if (onsetSample >= i && onsetSample < i + length)
+            stringResonator.pluck();
+        for (; playsNotes && nextMidiEvent != midiMessages.cend() && (*nextMidiEvent).samplePosition < i + length; ++nextMidiEvent)
+            handleStringMidi((*nextMidiEvent).getMessage());
 
-        // Get single-sample sub-blocks
-        auto exciteSample = excitationBlock.getSubBlock((size_t)i, 1);
-        auto wetSample = wetBlock.getSubBlock((size_t)i, 1);
+        auto exciteSub = excitationBlock.getSubBlock((size_t)i, (size_t)length);
+        auto wetSub = wetBlock.getSubBlock((size_t)i, (size_t)length);
 
-        activeResonator->process(exciteSample, wetSample, tune, structure, brightness, damping, position);
+        activeResonator->process(exciteSub, wetSub, tune, structure, brightness, damping, position);
     }
 
     // 3. Safety Checks and Limiting
@@ -13,7 +13,12 @@
 
 // Assuming these utility classes exist in the project structure
 #include "../DSPUtils.h"
-#include "../DSP_Helpers/TransientDetector.h"
+#include "../DSP_Helpers/SpectralFeatureExtractor.h"
+#include "../DSP_Helpers/ModalFilterBank.h"
+#include "../DSP_Helpers/SympatheticStringBank.h"
+#include "../DSP_Helpers/KarplusStrongVoicePool.h"
+#include "../ParameterHandle.h"
+#include "../SlotSeed.h"
 
 // ===================== InternalExciter =====================
 // Generates a discrete, percussive burst of filtered noise when triggered.
@@ -23,10 +28,17 @@ public:
     InternalExciter();
     void prepare(const juce::dsp::ProcessSpec&);
     void reset();
+    void setSeed(juce::uint32 seed) { noiseGen.setSeed(seed); }
     void trigger();
+    // Fires at that sample of the next process() block. Offsets must come in time order.
+    void scheduleTrigger(int sampleOffset);
     void process(juce::dsp::AudioBlock<float>& outputBlock, float brightness, int noiseType);
 
 private:
+    static constexpr int maxScheduledTriggers = 32; // Per block; later ones are dropped
+    std::array<int, maxScheduledTriggers> scheduledTriggers{};
+    int numScheduledTriggers = 0;
+
     double sampleRate = 44100.0;
     DSPUtils::NoiseGenerator noiseGen;
     juce::dsp::StateVariableTPTFilter<float> colorFilter;
@@ -41,15 +53,34 @@ class ExcitationManager
 public:
     void prepare(const juce::dsp::ProcessSpec&);
     void reset();
+    void setSeed(juce::uint32 seed) { internalExciter.setSeed(seed); }
     void process(const juce::dsp::AudioBlock<float>& inputBlock,
         juce::dsp::AudioBlock<float>& outputExcitationBlock,
         float brightness, float sensitivity, int noiseType);
 
+    // Fires the internal exciter (heard while the input is inactive) at a sample of the next
+    // process() block, e.g. for a MIDI note. Offsets must come in time order.
+    void scheduleTrigger(int sampleOffset) { internalExciter.scheduleTrigger(sampleOffset); }
+
+    // With onset detection on, transients are tracked on active input too, and the first onset
+    // of each block is reported (as a sample index, or -1) by getOnsetSample().
+    void setDetectOnsets(bool shouldDetect) { detectOnsets = shouldDetect; }
+    int getOnsetSample() const { return onsetSample; }
+
 private:
+    void detectTransients(const juce::dsp::AudioBlock<float>& inputBlock, bool triggerExciter);
+
     InternalExciter internalExciter;
-    TransientDetector transientDetector;
+    SpectralFeatureExtractor featureExtractor;
+    std::vector<float> transientValues; // Per-sample transient value, for onset positions
     juce::dsp::BallisticsFilter<float> rmsDetector;
     static constexpr float kInputThreshold = 0.01f;
+    static constexpr float kTriggerThreshold = 0.8f; // High threshold for sharp triggers
+    static constexpr float kRearmThreshold = 0.5f;   // An onset must fall below this before the next
+
+    bool detectOnsets = false;
+    bool onsetArmed = true;
+    int onsetSample = -1;
 };
 
 // ===================== ResonatorCore (Abstract Base Class) =====================
@@ -63,6 +94,10 @@ public:
         juce::dsp::AudioBlock<float>& outputBlock,
         float tune, float structure, float brightness, float damping, float position) = 0;
 
+    // Samples per process() call. Cores that handle parameter changes inside a block (by gliding
+    // their coefficients) run at this control rate; the rest are driven one sample at a time.
+    virtual int getControlInterval() const { return 1; }
+
 protected:
     double sampleRate = 44100.0;
     // Logarithmic mapping from 30 Hz to 8000 Hz
@@ -76,14 +111,16 @@ protected:
 class ModalResonator : public ResonatorCore
 {
 public:
-    // Increased to 60 partials for authentic spectral density.
-    static constexpr int NUM_MODES = 60;
+    // Up to 240 partials; the PARTIALS parameter picks how many are used (60 by default).
+    // Partials above Nyquist or below the bank's gain floor cost nothing (see ModalFilterBank).
+    static constexpr int MAX_MODES = 240;
+    static constexpr int REFERENCE_MODES = 60; // The count the material curves were voiced for
 
     struct MaterialData
     {
-        std::array<float, NUM_MODES> ratios;
-        std::array<float, NUM_MODES> gains;
-        std::array<float, NUM_MODES> qs;
+        std::array<float, MAX_MODES> ratios;
+        std::array<float, MAX_MODES> gains;
+        std::array<float, MAX_MODES> qs;
     };
 
     void prepare(const juce::dsp::ProcessSpec&) override;
@@ -91,16 +128,20 @@ public:
     void process(const juce::dsp::AudioBlock<float>& excitationBlock,
         juce::dsp::AudioBlock<float>& outputBlock,
         float tune, float structure, float brightness, float damping, float position) override;
+    int getControlInterval() const override { return 32; } // The bank glides between updates
+
+    void setNumPartials(int numPartials) { numModes = juce::jlimit(1, MAX_MODES, numPartials); }
+    int getNumActiveModes() const { return bank.getNumActiveModes(); }
 
 private:
     void initializeMaterialTables();
     void computeModeParams(float tuneHz, float structure, float brightness, float damping, float position);
 
-    using Filter = juce::dsp::IIR::Filter<float>;
-    std::vector<std::array<Filter, NUM_MODES>> channelFilters;
-    std::array<float, NUM_MODES> modeFreqs{};
-    std::array<float, NUM_MODES> modeGains{};
-    std::array<float, NUM_MODES> modeQs{};
+    ModalFilterBank bank;
+    std::array<float, MAX_MODES> modeFreqs{};
+    std::array<float, MAX_MODES> modeGains{};
+    std::array<float, MAX_MODES> modeQs{};
+    int numModes = REFERENCE_MODES;
 
     bool tablesInitialized = false;
     MaterialData woodData{}, metalData{}, glassData{};
@@ -110,53 +151,63 @@ private:
 class SympatheticStringResonator : public ResonatorCore
 {
 public:
-    static constexpr int NUM_STRINGS = 6;
+    // Six strings tuned to the interval sets; extra sets of six repeat them in other octaves.
+    static constexpr int NUM_BASE_STRINGS = 6;
+    static constexpr int MAX_STRINGS = SympatheticStringBank::maxStrings;
+
     void prepare(const juce::dsp::ProcessSpec& spec) override;
     void reset() override;
     void process(const juce::dsp::AudioBlock<float>& excitationBlock,
         juce::dsp::AudioBlock<float>& outputBlock,
         float tune, float structure, float brightness, float damping, float position) override;
+    int getControlInterval() const override { return 32; } // The banks glide between updates
+
+    void setNumStrings(int numStrings);
+    // Linked: one bank on the summed input, spread across the first two outputs.
+    void setStereoLinked(bool shouldBeLinked);
 
 private:
     void updateTunings(float structure);
 
-    using Delay = juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Linear>;
-    using LPFilter = juce::dsp::FirstOrderTPTFilter<float>;
-
-    std::vector<std::array<Delay, NUM_STRINGS>> channelDelays;
-    std::vector<std::array<LPFilter, NUM_STRINGS>> channelFilters;
-    std::vector<std::array<float, NUM_STRINGS>> feedbackGains;
-    std::array<float, NUM_STRINGS> currentRatios;
-
-    // Stores the summed feedback state for coupling across samples and blocks
-    std::vector<float> summedFeedbackState;
+    std::vector<SympatheticStringBank> banks; // One per channel; only the first when linked
+    std::array<float, MAX_STRINGS> currentRatios{};
+    std::array<float, MAX_STRINGS> delaySamples{};
+    std::vector<float> linkedInput;
 
+    int numStrings = NUM_BASE_STRINGS;
+    bool stereoLinked = false;
     int maxDelaySamples = 0;
 };
 
 // ===================== StringResonator (Extended Karplus-Strong) (Model 2) =====================
+// A pool of strings (see KarplusStrongVoicePool). What starts them depends on the trigger mode:
+// Continuous holds one string at Tune, fed by the excitation (the original behaviour); Transients
+// plucks a string at Tune on every input onset; MIDI plays a string per note at the note's pitch.
 class StringResonator : public ResonatorCore
 {
 public:
+    enum class TriggerMode { Continuous, Transients, Midi };
+
     void prepare(const juce::dsp::ProcessSpec& spec) override;
     void reset() override;
     void process(const juce::dsp::AudioBlock<float>& excitationBlock,
         juce::dsp::AudioBlock<float>& outputBlock,
         float tune, float structure, float brightness, float damping, float position) override;
+    int getControlInterval() const override { return 32; } // Voices glide between updates
+
+    void setTriggerMode(TriggerMode newMode);
+    TriggerMode getTriggerMode() const { return triggerMode; }
+
+    // Take effect at the next process() call.
+    void pluck() { pendingPluck = true; }
+    void noteOn(int noteNumber, float velocity) { voicePool.noteOn(noteNumber, (float)juce::MidiMessage::getMidiNoteInHertz(noteNumber), velocity); }
+    void noteOff(int noteNumber) { voicePool.noteOff(noteNumber); }
+    void allNotesOff() { voicePool.allNotesOff(); }
 
 private:
-    // Using Lagrange3rd for better quality in Karplus-Strong
-    using Delay = juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Lagrange3rd>;
-    using DampingFilter = juce::dsp::FirstOrderTPTFilter<float>;
-    using DispersionFilter = juce::dsp::IIR::Filter<float>;
-
-    std::vector<Delay> channelDelays;
-    std::vector<DampingFilter> channelDampingFilters;
-    // Chain of two all-pass filters for rich dispersion.
-    std::vector<DispersionFilter> channelDispersionFilters1;
-    std::vector<DispersionFilter> channelDispersionFilters2;
-    std::vector<float> feedback;
-    int maxDelaySamples = 0;
+    KarplusStrongVoicePool voicePool;
+    TriggerMode triggerMode = TriggerMode::Continuous;
+    bool pendingPluck = false;
 };
 
 // ===================== PhysicalResonatorProcessor (Main Processor) =====================
@@ -176,7 +227,7 @@ public:
     // Boilerplate methods...
     juce::AudioProcessorEditor* createEditor() override { return nullptr; }
     bool hasEditor() const override { return false; }
-    bool acceptsMidi() const override { return false; }
+    bool acceptsMidi() const override { return true; } // Notes play the String model's voices
     bool producesMidi() const override { return false; }
     double getTailLengthSeconds() const override { return 8.0; } // Increased for long decays
     int getNumPrograms() override { return 1; }
@@ -189,6 +240,8 @@ public:
 
 private:
     void updateResonatorCore(int newModelIndex);
+    static int getNumPartials(int choiceIndex); // PARTIALS choice -> mode count
+    void handleStringMidi(const juce::MidiMessage& message);
     bool checkAndHandleInstability(float sampleValue);
 
     ExcitationManager excitationManager;
@@ -200,8 +253,9 @@ private:
     juce::AudioBuffer<float> excitationBuffer, wetOutputBuffer;
 
     juce::AudioProcessorValueTreeState& mainApvts;
-    juce::String modelParamId, tuneParamId, structureParamId, brightnessParamId, dampingParamId, positionParamId;
-    juce::String sensitivityParamId, mixParamId, noiseTypeParamId;
+    ParameterHandle modelParam, tuneParam, structureParam, brightnessParam, dampingParam, positionParam;
+    ParameterHandle sensitivityParam, mixParam, noiseTypeParam, partialsParam, stringsParam, stereoLinkParam, stringTriggerParam;
+    SlotSeed slotSeed;
 
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> smoothedTune, smoothedStructure, smoothedBrightness, smoothedDamping, smoothedPosition, smoothedMix;
 
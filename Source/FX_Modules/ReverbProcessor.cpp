@@ -6,10 +6,10 @@ ReverbProcessor::ReverbProcessor(juce::AudioProcessorValueTreeState& apvts, int
     mainApvts(apvts)
 {
     auto slotPrefix = "SLOT_" + juce::String(slotIndex + 1) + "_";
-    roomSizeParamId = slotPrefix + "REVERB_ROOM_SIZE";
-    dampingParamId = slotPrefix + "REVERB_DAMPING";
-    mixParamId = slotPrefix + "REVERB_MIX";
-    widthParamId = slotPrefix + "REVERB_WIDTH";
+    roomSizeParam = ParameterHandle(mainApvts, slotPrefix + "REVERB_ROOM_SIZE");
+    dampingParam = ParameterHandle(mainApvts, slotPrefix + "REVERB_DAMPING");
+    mixParam = ParameterHandle(mainApvts, slotPrefix + "REVERB_MIX");
+    widthParam = ParameterHandle(mainApvts, slotPrefix + "REVERB_WIDTH");
 }
 
 void ReverbProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
@@ -43,11 +43,11 @@ void ReverbProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiB
     // ========================================
 
     juce::dsp::Reverb::Parameters reverbParams;
-    reverbParams.roomSize = mainApvts.getRawParameterValue(roomSizeParamId)->load();
-    reverbParams.damping = mainApvts.getRawParameterValue(dampingParamId)->load();
-    reverbParams.wetLevel = mainApvts.getRawParameterValue(mixParamId)->load();
+    reverbParams.roomSize = roomSizeParam.get();
+    reverbParams.damping = dampingParam.get();
+    reverbParams.wetLevel = mixParam.get();
     reverbParams.dryLevel = 1.0f - reverbParams.wetLevel;
-    reverbParams.width = mainApvts.getRawParameterValue(widthParamId)->load();
+    reverbParams.width = widthParam.get();
     reverb.setParameters(reverbParams);
 
     juce::dsp::AudioBlock<float> block(buffer);
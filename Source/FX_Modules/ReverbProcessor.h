@@ -1,6 +1,7 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "../ParameterHandle.h"
 
 class ReverbProcessor : public juce::AudioProcessor
 {
@@ -32,5 +33,5 @@ private:
     juce::dsp::Reverb reverb;
 
     juce::AudioProcessorValueTreeState& mainApvts;
-    juce::String roomSizeParamId, dampingParamId, mixParamId, widthParamId;
+    ParameterHandle roomSizeParam, dampingParam, mixParam, widthParam;
 };
\ No newline at end of file
@@ -2,6 +2,7 @@
 // File: FX_Modules/SpectralAnimatorEngine.cpp
 //================================================================================
 #include "SpectralAnimatorEngine.h"
+#include "../TraceRecorder.h"
 
 SpectralAnimatorEngine::SpectralAnimatorEngine()
     : forwardFFT(FFT_ORDER),
@@ -10,6 +11,7 @@ SpectralAnimatorEngine::SpectralAnimatorEngine()
 {
     harmonicMask.resize(NUM_BINS, 0.0f);
     formantMask.resize(NUM_BINS, 0.0f);
+    frameMask.resize(NUM_BINS, 0.0f);
 }
 
 // Helper function for Vowel Space Interpolation (Formant Mode)
@@ -41,6 +43,10 @@ SpectralAnimatorEngine::FormantProfile SpectralAnimatorEngine::getVowel(float x,
 
 void SpectralAnimatorEngine::prepare(const juce::dsp::ProcessSpec& spec)
 {
+    // The worker may still be transforming a frame from the previous configuration.
+    frameJob.finish();
+    framePending = false;
+
     sampleRate = spec.sampleRate;
     numChannels = (int)spec.numChannels;
 
@@ -94,10 +100,15 @@ void SpectralAnimatorEngine::prepare(const juce::dsp::ProcessSpec& spec)
 
 void SpectralAnimatorEngine::reset()
 {
+    frameJob.finish();
+    framePending = false;
+
     inputFIFO.clear();
     outputBuffer.clear();
     fifoIndex = 0;
-    outputBufferWritePos = 0;
+    // The first frame completes once FFT_SIZE samples have been read; writing it at the next read
+    // position makes the actual latency FFT_SIZE, as reported (it used to be twice that).
+    outputBufferWritePos = FFT_SIZE;
     outputBufferReadPos = 0;
 
     for (auto& detector : transientDetectors)
@@ -198,13 +209,37 @@ void SpectralAnimatorEngine::process(juce::AudioBuffer<float>& buffer)
         // Process the frame if ready
         if (frameReady)
         {
+            // Async: the frame queued one hop ago lands at the current write position, so it is
+            // output exactly HOP_SIZE samples later than it would have been inline.
+            if (framePending)
+            {
+                frameJob.finish();
+                overlapAddFrames();
+                framePending = false;
+            }
+
             for (int ch = 0; ch < numChannels; ++ch)
             {
                 // Copy data from FIFO to processing buffer (channelTimeDomain)
                 // The data corresponding to the current frame is at the start of the FIFO before shifting.
                 std::copy(inputFIFO.getReadPointer(ch), inputFIFO.getReadPointer(ch) + FFT_SIZE, channelTimeDomain[ch].begin());
+            }
 
-                processFrame(ch);
+            // FIX: Get the current morph value for this frame
+            frameChannels = numChannels;
+            frameMorph = smoothedMorph.getCurrentValue();
+            const std::vector<float>& mask = (currentMode == Mode::Pitch) ? harmonicMask : formantMask;
+            std::copy(mask.begin(), mask.end(), frameMask.begin());
+
+            if (asyncFrames)
+            {
+                frameJob.submit();
+                framePending = true;
+            }
+            else
+            {
+                transformFrames();
+                overlapAddFrames();
             }
 
             // Shift input FIFO by hopSize for all channels (Efficient FIFO management)
@@ -222,12 +257,18 @@ void SpectralAnimatorEngine::process(juce::AudioBuffer<float>& buffer)
     }
 }
 
-// STFT core: FFT -> Modification -> IFFT -> OLA
-void SpectralAnimatorEngine::processFrame(int channel)
+void SpectralAnimatorEngine::transformFrames()
+{
+    TESSERA_TRACE_SCOPE("spectral animator frame", "fft");
+    for (int ch = 0; ch < frameChannels; ++ch)
+        transformFrame(ch);
+}
+
+// STFT core: FFT -> Modification -> IFFT (the OLA is done by overlapAddFrames)
+void SpectralAnimatorEngine::transformFrame(int channel)
 {
     auto& timeDomain = channelTimeDomain[channel];
     auto& freqDomain = channelFreqDomain[channel];
-    int outputBufferSize = outputBuffer.getNumSamples();
 
     // 1. Windowing (Analysis window)
     window.multiplyWithWindowingTable(timeDomain.data(), FFT_SIZE);
@@ -237,11 +278,9 @@ void SpectralAnimatorEngine::processFrame(int channel)
     std::copy(timeDomain.begin(), timeDomain.end(), freqDomain.begin());
     forwardFFT.performRealOnlyForwardTransform(freqDomain.data());
 
-    // 3. Spectral Modification
-    const std::vector<float>& mask = (currentMode == Mode::Pitch) ? harmonicMask : formantMask;
-
-    // FIX: Get the current morph value for this frame
-    float currentMorph = smoothedMorph.getCurrentValue();
+    // 3. Spectral Modification (mask and morph were captured when the frame was queued)
+    const std::vector<float>& mask = frameMask;
+    const float currentMorph = frameMorph;
 
 
     // Iterate over bins (including DC and Nyquist)
@@ -278,17 +317,27 @@ void SpectralAnimatorEngine::processFrame(int channel)
     // Note: JUCE FFT handles normalization internally.
     forwardFFT.performRealOnlyInverseTransform(freqDomain.data());
 
-    // 6. Window (Synthesis window) and overlap-add
+    // 6. Window (Synthesis window)
     // Copy result back to time domain buffer for synthesis windowing
     std::copy(freqDomain.begin(), freqDomain.begin() + FFT_SIZE, timeDomain.begin());
     window.multiplyWithWindowingTable(timeDomain.data(), FFT_SIZE);
+}
 
-    // Overlap-Add into the output buffer starting at the current write position
-    for (int i = 0; i < FFT_SIZE; ++i)
+void SpectralAnimatorEngine::overlapAddFrames()
+{
+    int outputBufferSize = outputBuffer.getNumSamples();
+
+    for (int channel = 0; channel < frameChannels; ++channel)
     {
-        int index = (outputBufferWritePos + i) % outputBufferSize;
-        // Add the windowed frame to the accumulation buffer
-        outputBuffer.addSample(channel, index, timeDomain[i]);
+        const auto& timeDomain = channelTimeDomain[channel];
+
+        // Overlap-Add into the output buffer starting at the current write position
+        for (int i = 0; i < FFT_SIZE; ++i)
+        {
+            int index = (outputBufferWritePos + i) % outputBufferSize;
+            // Add the windowed frame to the accumulation buffer
+            outputBuffer.addSample(channel, index, timeDomain[i]);
+        }
     }
 }
 
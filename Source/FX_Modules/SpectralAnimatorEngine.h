@@ -3,6 +3,7 @@
 //================================================================================
 #pragma once
 #include <juce_dsp/juce_dsp.h>
+#include "../DSP_Helpers/FrameWorker.h"
 #include <vector>
 #include <array>
 #include <complex>
@@ -24,13 +25,20 @@ public:
     void reset();
     void process(juce::AudioBuffer<float>& buffer);
 
+    // Transform frames on the shared FrameWorker and overlap-add them one hop later, which keeps
+    // the FFT work out of the callback that completes a frame. Call before prepare().
+    void setAsyncFrames(bool shouldBeAsync) { asyncFrames = shouldBeAsync; }
+    int getLatencyInSamples() const { return FFT_SIZE + (asyncFrames ? HOP_SIZE : 0); }
+
     void setMode(Mode newMode);
     void setPitch(float newPitchHz);
     void setFormant(float x, float y);
     void setMorph(float amount);
     void setTransientPreservation(float amount);
 private:
-    void processFrame(int channel);
+    void transformFrames();          // Runs on whichever thread executes frameJob
+    void transformFrame(int channel);
+    void overlapAddFrames();
     void updateMasks();
 
     struct FormantProfile { float f1, f2; };
@@ -79,4 +87,14 @@ private:
     std::vector<float> harmonicMask;
     std::vector<float> formantMask;
     bool masksNeedUpdate = true;
+
+    // --- Frame hand-off ---
+    // Everything transformFrames() reads is captured here when a frame is queued, so the worker
+    // never sees the live masks or smoothers.
+    bool asyncFrames = false;
+    bool framePending = false;
+    int frameChannels = 0;
+    float frameMorph = 1.0f;
+    std::vector<float> frameMask;
+    FrameWorker::Job frameJob{ [](void* engine) { static_cast<SpectralAnimatorEngine*>(engine)->transformFrames(); }, this };
 };
@@ -10,21 +10,23 @@ SpectralAnimatorProcessor::SpectralAnimatorProcessor(juce::AudioProcessorValueTr
 {
     // Define Parameter IDs (Using a distinct prefix SPECANIM_)
     auto slotPrefix = "SLOT_" + juce::String(slotIndex + 1) + "_SPECANIM_";
-    modeParamId = slotPrefix + "MODE";
-    pitchParamId = slotPrefix + "PITCH";
-    formantXParamId = slotPrefix + "FORMANT_X";
-    formantYParamId = slotPrefix + "FORMANT_Y";
-    morphParamId = slotPrefix + "MORPH";
-    transientParamId = slotPrefix + "TRANSIENT_PRESERVE";
+    modeParam = ParameterHandle(mainApvts, slotPrefix + "MODE");
+    pitchParam = ParameterHandle(mainApvts, slotPrefix + "PITCH");
+    formantXParam = ParameterHandle(mainApvts, slotPrefix + "FORMANT_X");
+    formantYParam = ParameterHandle(mainApvts, slotPrefix + "FORMANT_Y");
+    morphParam = ParameterHandle(mainApvts, slotPrefix + "MORPH");
+    transientParam = ParameterHandle(mainApvts, slotPrefix + "TRANSIENT_PRESERVE");
+    asyncFramesParam = ParameterHandle(mainApvts, "SPECTRAL_ASYNC");
 }
 
 void SpectralAnimatorProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
     juce::dsp::ProcessSpec spec{ sampleRate, (juce::uint32)samplesPerBlock, (juce::uint32)getTotalNumInputChannels() };
+    engine.setAsyncFrames(asyncFramesParam.isOn());
     engine.prepare(spec);
 
-    // Report the latency introduced by the STFT process (equal to the FFT Size).
-    setLatencySamples(SpectralAnimatorEngine::FFT_SIZE);
+    // Report the latency introduced by the STFT process (the FFT size, plus one hop when async).
+    setLatencySamples(engine.getLatencyInSamples());
 }
 
 void SpectralAnimatorProcessor::releaseResources()
@@ -46,21 +48,13 @@ void SpectralAnimatorProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
-    // Update Parameters (Ensure parameters exist before accessing)
-    if (!mainApvts.getRawParameterValue(modeParamId) || !mainApvts.getRawParameterValue(pitchParamId) ||
-        !mainApvts.getRawParameterValue(formantXParamId) || !mainApvts.getRawParameterValue(formantYParamId) ||
-        !mainApvts.getRawParameterValue(morphParamId) || !mainApvts.getRawParameterValue(transientParamId))
-    {
-        return;
-    }
-
     // Load parameters and update the engine
-    auto mode = static_cast<SpectralAnimatorEngine::Mode>(static_cast<int>(mainApvts.getRawParameterValue(modeParamId)->load()));
-    float pitch = mainApvts.getRawParameterValue(pitchParamId)->load();
-    float formantX = mainApvts.getRawParameterValue(formantXParamId)->load();
-    float formantY = mainApvts.getRawParameterValue(formantYParamId)->load();
-    float morph = mainApvts.getRawParameterValue(morphParamId)->load();
-    float transient = mainApvts.getRawParameterValue(transientParamId)->load();
+    auto mode = modeParam.getChoice<SpectralAnimatorEngine::Mode>();
+    float pitch = pitchParam.get();
+    float formantX = formantXParam.get();
+    float formantY = formantYParam.get();
+    float morph = morphParam.get();
+    float transient = transientParam.get();
 
     engine.setMode(mode);
     engine.setPitch(pitch);
@@ -4,6 +4,7 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include "SpectralAnimatorEngine.h"
+#include "../ParameterHandle.h"
 
 class SpectralAnimatorProcessor : public juce::AudioProcessor
 {
@@ -38,5 +39,6 @@ private:
 
     juce::AudioProcessorValueTreeState& mainApvts;
     // Parameter IDs
-    juce::String modeParamId, pitchParamId, formantXParamId, formantYParamId, morphParamId, transientParamId;
+    ParameterHandle modeParam, pitchParam, formantXParam, formantYParam, morphParam, transientParam;
+    ParameterHandle asyncFramesParam; // Global SPECTRAL_ASYNC, read when prepared
 };
\ No newline at end of file
@@ -2,8 +2,7 @@
 // File: FX_Modules/SpectralDiffuser.cpp
 //================================================================================
 #include "SpectralDiffuser.h"
-
-namespace { static std::vector<std::vector<float>> accumulatedPhase; }
+#include "../TraceRecorder.h"
 
 SpectralDiffuser::SpectralDiffuser()
     : fft(FFT_ORDER),
@@ -15,6 +14,9 @@ SpectralDiffuser::SpectralDiffuser()
 
 void SpectralDiffuser::prepare(const juce::dsp::ProcessSpec& spec)
 {
+    frameJob.finish();
+    framePending = false;
+
     int numChannels = (int)spec.numChannels;
     inputFIFO.setSize(numChannels, FFT_SIZE);
     outputFIFO.setSize(numChannels, FFT_SIZE);
@@ -29,6 +31,9 @@ void SpectralDiffuser::prepare(const juce::dsp::ProcessSpec& spec)
 
 void SpectralDiffuser::reset()
 {
+    frameJob.finish();
+    framePending = false;
+
     fifoIndex = 0;
     inputFIFO.clear();
     outputFIFO.clear();
@@ -58,23 +63,52 @@ void SpectralDiffuser::process(juce::AudioBuffer<float>& buffer, float diffusion
         if (fifoIndex == FFT_SIZE)
         {
             prevDiffusion = 0.85f * prevDiffusion + 0.15f * target;
-            for (int ch = 0; ch < numChannels; ++ch)
+
+            // Async: the frame queued one hop ago is added now, so it plays one hop later.
+            if (framePending)
+            {
+                frameJob.finish();
+                addFramesToOutput();
+                framePending = false;
+            }
+
+            frameChannels = juce::jmin(numChannels, (int)fftData.size());
+            frameDiffusion = prevDiffusion;
+            for (int ch = 0; ch < frameChannels; ++ch)
+                std::copy(inputFIFO.getReadPointer(ch),
+                          inputFIFO.getReadPointer(ch) + FFT_SIZE,
+                          fftData[ch].begin());
+
+            if (asyncFrames)
+            {
+                frameJob.submit();
+                framePending = true;
+            }
+            else
             {
-                processFrame(ch, prevDiffusion);
+                transformFrames();
+                addFramesToOutput();
+            }
+
+            for (int ch = 0; ch < numChannels; ++ch)
                 for (int j = 0; j < HOP_SIZE; ++j)
                     inputFIFO.setSample(ch, j, inputFIFO.getSample(ch, j + HOP_SIZE));
-            }
             fifoIndex = HOP_SIZE;
         }
     }
 }
 
-void SpectralDiffuser::processFrame(int channel, float diffusionAmount)
+void SpectralDiffuser::transformFrames()
+{
+    TESSERA_TRACE_SCOPE("spectral diffuser frame", "fft");
+    for (int ch = 0; ch < frameChannels; ++ch)
+        transformFrame(ch);
+}
+
+void SpectralDiffuser::transformFrame(int channel)
 {
     auto& data = fftData[channel];
-    std::copy(inputFIFO.getReadPointer(channel),
-              inputFIFO.getReadPointer(channel) + FFT_SIZE,
-              data.begin());
+    const float diffusionAmount = frameDiffusion;
 
     window.multiplyWithWindowingTable(data.data(), FFT_SIZE);
     fft.performRealOnlyForwardTransform(data.data());
@@ -128,7 +162,11 @@ void SpectralDiffuser::processFrame(int channel, float diffusionAmount)
             for (int i = 0; i < FFT_SIZE; ++i) data[i] *= g;
         }
     }
+}
 
-    for (int i = 0; i < FFT_SIZE; ++i)
-        outputFIFO.addSample(channel, i, data[i]);
+void SpectralDiffuser::addFramesToOutput()
+{
+    for (int ch = 0; ch < frameChannels; ++ch)
+        for (int i = 0; i < FFT_SIZE; ++i)
+            outputFIFO.addSample(ch, i, fftData[ch][i]);
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #pragma once
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_dsp/juce_dsp.h>
+#include "../DSP_Helpers/FrameWorker.h"
 #include <random>
 #include <vector>
 
@@ -18,18 +19,27 @@ public:
     void prepare(const juce::dsp::ProcessSpec& spec);
     void reset();
     void process(juce::AudioBuffer<float>& buffer, float diffusionAmount);
-    int  getLatencyInSamples() const { return HOP_SIZE; }
+    int  getLatencyInSamples() const { return asyncFrames ? 2 * HOP_SIZE : HOP_SIZE; }
+
+    // Transform frames on the shared FrameWorker and collect them one hop later. Call before prepare().
+    void setAsyncFrames(bool shouldBeAsync) { asyncFrames = shouldBeAsync; }
 
     void setPhaseDriftScale(float s) { phaseDriftScale = juce::jlimit(0.0f, 4.0f, s); }
     void setNormalizeOutput(bool b) { normalizeOutput = b; }
 
+    // Restarts the phase scatter from a fixed seed (deterministic renders). Call from reset().
+    void setSeed(juce::uint32 seed) { frameJob.finish(); randomEngine.seed(seed); }
+
 private:
-    void processFrame(int channel, float diffusionAmount);
+    void transformFrames();          // Runs on whichever thread executes frameJob
+    void transformFrame(int channel);
+    void addFramesToOutput();
 
     juce::dsp::FFT fft;
     juce::dsp::WindowingFunction<float> window;
     juce::AudioBuffer<float> inputFIFO, outputFIFO;
     std::vector<std::vector<float>> fftData;
+    std::vector<std::vector<float>> accumulatedPhase;
     int fifoIndex = 0;
 
     std::minstd_rand randomEngine;
@@ -38,4 +48,11 @@ private:
     float phaseDriftScale = 1.0f;
     float prevDiffusion   = 0.0f;
     bool  normalizeOutput = true;
+
+    // Frame hand-off; the diffusion amount and channel count are captured when a frame is queued.
+    bool  asyncFrames = false;
+    bool  framePending = false;
+    int   frameChannels = 0;
+    float frameDiffusion = 0.0f;
+    FrameWorker::Job frameJob{ [](void* diffuser) { static_cast<SpectralDiffuser*>(diffuser)->transformFrames(); }, this };
 };
\ No newline at end of file
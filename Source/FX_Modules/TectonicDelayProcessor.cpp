@@ -68,18 +68,19 @@ TectonicDelayProcessor::TectonicDelayProcessor(juce::AudioProcessorValueTreeStat
       mainApvts(apvts)
 {
     auto slotPrefix = "SLOT_" + juce::String(slotIndex + 1) + "_TECTONIC_";
-    lowTimeParamId          = slotPrefix + "LOW_TIME";
-    midTimeParamId          = slotPrefix + "MID_TIME";
-    highTimeParamId         = slotPrefix + "HIGH_TIME";
-    feedbackParamId         = slotPrefix + "FEEDBACK";
-    lowMidCrossoverParamId  = slotPrefix + "LOMID_CROSS";
-    midHighCrossoverParamId = slotPrefix + "MIDHIGH_CROSS";
-    decayDriveParamId       = slotPrefix + "DECAY_DRIVE";
-    decayTextureParamId     = slotPrefix + "DECAY_TEXTURE";
-    decayDensityParamId     = slotPrefix + "DECAY_DENSITY";
-    decayPitchParamId       = slotPrefix + "DECAY_PITCH";
-    linkParamId             = slotPrefix + "LINK";
-    mixParamId              = slotPrefix + "MIX";
+    lowTimeParam          = ParameterHandle(mainApvts, slotPrefix + "LOW_TIME");
+    midTimeParam          = ParameterHandle(mainApvts, slotPrefix + "MID_TIME");
+    highTimeParam         = ParameterHandle(mainApvts, slotPrefix + "HIGH_TIME");
+    feedbackParam         = ParameterHandle(mainApvts, slotPrefix + "FEEDBACK");
+    lowMidCrossoverParam  = ParameterHandle(mainApvts, slotPrefix + "LOMID_CROSS");
+    midHighCrossoverParam = ParameterHandle(mainApvts, slotPrefix + "MIDHIGH_CROSS");
+    decayDriveParam       = ParameterHandle(mainApvts, slotPrefix + "DECAY_DRIVE");
+    decayTextureParam     = ParameterHandle(mainApvts, slotPrefix + "DECAY_TEXTURE");
+    decayDensityParam     = ParameterHandle(mainApvts, slotPrefix + "DECAY_DENSITY");
+    decayPitchParam       = ParameterHandle(mainApvts, slotPrefix + "DECAY_PITCH");
+    linkParam             = ParameterHandle(mainApvts, slotPrefix + "LINK");
+    mixParam              = ParameterHandle(mainApvts, slotPrefix + "MIX");
+    slotSeed              = SlotSeed(mainApvts, slotIndex);
 }
 
 //==============================================================================
@@ -87,6 +88,7 @@ void TectonicDelayProcessor::prepareToPlay(double sampleRate, int samplesPerBloc
 {
     this->sampleRate = sampleRate;
     this->maxBlockSize = samplesPerBlock;
+    slotSeed.update();
 
     int channels = juce::jmax(getTotalNumInputChannels(), getTotalNumOutputChannels());
     if (channels == 0) channels = 2;
@@ -97,6 +99,7 @@ void TectonicDelayProcessor::prepareToPlay(double sampleRate, int samplesPerBloc
 
     for (auto& band : delayBands)
         band.prepare(spec, sampleRate, samplesPerBlock);
+    applySlotSeeds(); // Tubes seed themselves randomly when prepared
 
     dryBuffer.setSize(channels, samplesPerBlock);
     wetBuffer.setSize(channels, samplesPerBlock);
@@ -129,28 +132,32 @@ void TectonicDelayProcessor::reset()
 {
     crossover.reset();
     for (auto& b : delayBands) b.reset();
+    applySlotSeeds();
     updateParameters();
 }
 
+void TectonicDelayProcessor::applySlotSeeds()
+{
+    if (!slotSeed.isDeterministic()) return;
+    for (int b = 0; b < (int)delayBands.size(); ++b)
+        delayBands[(size_t)b].tube.setSeeds(slotSeed.get((juce::uint32)(2 * b)), slotSeed.get((juce::uint32)(2 * b + 1)));
+}
+
 //==============================================================================
 void TectonicDelayProcessor::updateParameters()
 {
-    auto getParam = [&](const juce::String& id, float def) {
-        if (auto* p = mainApvts.getRawParameterValue(id)) return p->load();
-        return def;
-    };
-    params.lowTime          = getParam(lowTimeParamId, 100.0f);
-    params.midTime          = getParam(midTimeParamId, 200.0f);
-    params.highTime         = getParam(highTimeParamId,150.0f);
-    params.feedback         = getParam(feedbackParamId, 0.3f);
-    params.lowMidCrossover  = getParam(lowMidCrossoverParamId, 400.0f);
-    params.midHighCrossover = getParam(midHighCrossoverParamId, 2500.0f);
-    params.decayDrive       = getParam(decayDriveParamId, 6.0f);
-    params.decayTexture     = getParam(decayTextureParamId, 0.5f);
-    params.decayDensity     = getParam(decayDensityParamId, 0.5f);
-    params.decayPitch       = getParam(decayPitchParamId, 0.0f);
-    params.linked           = getParam(linkParamId, 1.0f) > 0.5f;
-    params.mix              = getParam(mixParamId, 0.5f);
+    params.lowTime          = lowTimeParam.get();
+    params.midTime          = midTimeParam.get();
+    params.highTime         = highTimeParam.get();
+    params.feedback         = feedbackParam.get();
+    params.lowMidCrossover  = lowMidCrossoverParam.get();
+    params.midHighCrossover = midHighCrossoverParam.get();
+    params.decayDrive       = decayDriveParam.get();
+    params.decayTexture     = decayTextureParam.get();
+    params.decayDensity     = decayDensityParam.get();
+    params.decayPitch       = decayPitchParam.get();
+    params.linked           = linkParam.isOn();
+    params.mix              = mixParam.get();
 
     crossover.setCrossoverFrequencies(params.lowMidCrossover, params.midHighCrossover);
 
@@ -180,7 +187,7 @@ void TectonicDelayProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
     updateParameters();
 
     dryBuffer.setSize(channels, numSamples, false, false, true);
-    dryBuffer.makeCopyOf(buffer);
+    dryBuffer.makeCopyOf(buffer, true);
     wetBuffer.setSize(channels, numSamples, false, false, true);
     wetBuffer.clear();
 
@@ -193,11 +200,13 @@ void TectonicDelayProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
     std::array<juce::AudioBuffer<float>*, 3> bands{ &lowBand, &midBand, &highBand };
     std::array<float, 3> times{ params.lowTime, params.midTime, params.highTime };
 
-    float fb      = smoothedFeedback.getNextValue();
-    float drive   = smoothedDecayDrive.getNextValue();
-    float texture = smoothedDecayTexture.getNextValue();
-    float density = smoothedDecayDensity.getNextValue();
-    float pitch   = smoothedDecayPitch.getNextValue();
+    // Smoothers step once per block, so advance them by the block length to keep their ramp
+    // times independent of the block size.
+    float fb      = smoothedFeedback.skip(numSamples);
+    float drive   = smoothedDecayDrive.skip(numSamples);
+    float texture = smoothedDecayTexture.skip(numSamples);
+    float density = smoothedDecayDensity.skip(numSamples);
+    float pitch   = smoothedDecayPitch.skip(numSamples);
 
     for (int b = 0; b < 3; ++b)
     {
@@ -213,7 +222,7 @@ void TectonicDelayProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
     }
 
     // 4. Mix
-    float mix = smoothedMix.getNextValue();
+    float mix = smoothedMix.skip(numSamples);
     float dryGain = 1.0f - mix;
     float wetGain = mix;
     for (int ch = 0; ch < totalOut; ++ch)
@@ -7,6 +7,8 @@
 #include <JuceHeader.h>
 #include "../DSPUtils.h"
 #include "../DSP_Helpers/InterpolatedCircularBuffer.h"
+#include "../ParameterHandle.h"
+#include "../SlotSeed.h"
 
 class TectonicDelayProcessor : public juce::AudioProcessor
 {
@@ -48,6 +50,7 @@ private:
     {
         void prepare(double sr, int channels, int /*maxBlock*/) { sampleRate = sr; numCh = channels; noise.setSeedRandomly(); rng.setSeedRandomly(); }
         void reset() { lastSat = lastOut = pitchFrac = 0.0f; }
+        void setSeeds(juce::uint32 noiseSeed, juce::uint32 crackleSeed) { noise.setSeed((juce::int64)noiseSeed); rng.setSeed((juce::int64)crackleSeed); }
         void process(juce::AudioBuffer<float>& buffer, float driveDb, float texture, float density, float pitch)
         {
             int numSamples = buffer.getNumSamples(); int chs = juce::jmin(buffer.getNumChannels(), numCh);
@@ -91,8 +94,10 @@ private:
     };
 
     void updateParameters();
+    void applySlotSeeds();
     CrossoverNetwork crossover; std::array<DelayBand, 3> delayBands; juce::AudioBuffer<float> dryBuffer, wetBuffer; juce::AudioProcessorValueTreeState& mainApvts;
-    juce::String lowTimeParamId, midTimeParamId, highTimeParamId, feedbackParamId, lowMidCrossoverParamId, midHighCrossoverParamId, decayDriveParamId, decayTextureParamId, decayDensityParamId, decayPitchParamId, linkParamId, mixParamId;
+    ParameterHandle lowTimeParam, midTimeParam, highTimeParam, feedbackParam, lowMidCrossoverParam, midHighCrossoverParam, decayDriveParam, decayTextureParam, decayDensityParam, decayPitchParam, linkParam, mixParam;
+    SlotSeed slotSeed;
     struct TectonicParameters { float lowTime = 100.0f, midTime = 200.0f, highTime = 150.0f, feedback = 0.3f, lowMidCrossover = 400.0f, midHighCrossover = 2500.0f, decayDrive = 6.0f, decayTexture = 0.5f, decayDensity = 0.5f, decayPitch = 0.0f; bool linked = true; float mix = 0.5f; } params;
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> smoothedFeedback, smoothedDecayDrive, smoothedDecayTexture, smoothedDecayDensity, smoothedDecayPitch, smoothedMix; double sampleRate = 44100.0; int maxBlockSize = 512;
 };
\ No newline at end of file
@@ -0,0 +1,27 @@
+//================================================================================
+// File: HostedModule.cpp
+//================================================================================
+#include "HostedModule.h"
+
+std::unique_ptr<HostedModule> HostedModule::create(int choice, juce::AudioProcessorValueTreeState& apvts, int slotIndex)
+{
+    auto hosted = std::make_unique<HostedModule>();
+    switch (choice)
+    {
+    case 1:  hosted->module = std::make_unique<DistortionProcessor>(apvts, slotIndex); break;
+    case 2:  hosted->module = std::make_unique<FilterProcessor>(apvts, slotIndex); break;
+    case 3:  hosted->module = std::make_unique<ModulationProcessor>(apvts, slotIndex); break;
+    case 4:  hosted->module = std::make_unique<AdvancedDelayProcessor>(apvts, slotIndex); break;
+    case 5:  hosted->module = std::make_unique<ReverbProcessor>(apvts, slotIndex); break;
+    case 6:  hosted->module = std::make_unique<AdvancedCompressorProcessor>(apvts, slotIndex); break;
+    case 7:  hosted->module = std::make_unique<ChromaTapeProcessor>(apvts, slotIndex); break;
+    case 8:  hosted->module = std::make_unique<MorphoCompProcessor>(apvts, slotIndex); break;
+    case 9:  hosted->module = std::make_unique<PhysicalResonatorProcessor>(apvts, slotIndex); break;
+    case 10: hosted->module = std::make_unique<SpectralAnimatorProcessor>(apvts, slotIndex); break;
+    case 11: hosted->module = std::make_unique<HelicalDelayProcessor>(apvts, slotIndex); break;
+    case 12: hosted->module = std::make_unique<ChronoVerbProcessor>(apvts, slotIndex); break;
+    case 13: hosted->module = std::make_unique<TectonicDelayProcessor>(apvts, slotIndex); break;
+    default: break; // Already the empty pass-through
+    }
+    return hosted;
+}
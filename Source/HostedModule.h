@@ -0,0 +1,109 @@
+//================================================================================
+// File: HostedModule.h
+//================================================================================
+#pragma once
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <variant>
+
+#include "FX_Modules/DistortionProcessor.h"
+#include "FX_Modules/FilterProcessor.h"
+#include "FX_Modules/ModulationProcessor.h"
+#include "FX_Modules/AdvancedDelayProcessor.h"
+#include "FX_Modules/ReverbProcessor.h"
+#include "FX_Modules/AdvancedCompressorProcessor.h"
+#include "FX_Modules/ChromaTapeProcessor.h"
+#include "FX_Modules/MorphoCompProcessor.h"
+#include "FX_Modules/PhysicalResonatorProcessor.h"
+#include "FX_Modules/SpectralAnimatorProcessor.h"
+#include "FX_Modules/HelicalDelayProcessor.h"
+#include "FX_Modules/ChronoVerbProcessor.h"
+#include "FX_Modules/TectonicDelayProcessor.h"
+
+// A simple processor to pass audio through when no other module is loaded.
+class PassThroughProcessor final : public juce::AudioProcessor
+{
+public:
+    PassThroughProcessor()
+        : AudioProcessor(BusesProperties().withInput("Input", juce::AudioChannelSet::stereo(), true)
+            .withOutput("Output", juce::AudioChannelSet::stereo(), true)) {
+    }
+
+    void prepareToPlay(double, int) override {}
+    void releaseResources() override {}
+    void reset() override {}
+    void processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi) override
+    {
+        juce::ignoreUnused(midi);
+        juce::ScopedNoDenormals noDenormals;
+        for (auto ch = getTotalNumInputChannels(); ch < getTotalNumOutputChannels(); ++ch)
+            buffer.clear(ch, 0, buffer.getNumSamples());
+    }
+    const juce::String getName() const override { return "PassThrough"; }
+    bool hasEditor() const override { return false; }
+    juce::AudioProcessorEditor* createEditor() override { return nullptr; }
+    bool acceptsMidi() const override { return false; }
+    bool producesMidi() const override { return false; }
+    double getTailLengthSeconds() const override { return 0.0; }
+    int getNumPrograms() override { return 1; }
+    int getCurrentProgram() override { return 0; }
+    void setCurrentProgram(int) override {}
+    const juce::String getProgramName(int) override { return {}; }
+    void changeProgramName(int, const juce::String&) override {}
+    void getStateInformation(juce::MemoryBlock&) override {}
+    void setStateInformation(const void*, int) override {}
+private:
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PassThroughProcessor)
+};
+
+/**
+ * One slot's module, held by concrete type. The variant index matches the SLOT_n_CHOICE value
+ * (0 = empty), so process() dispatches at compile time instead of through AudioProcessor's vtable.
+ */
+struct HostedModule
+{
+    using Variant = std::variant<
+        std::unique_ptr<PassThroughProcessor>,          // 0  Empty
+        std::unique_ptr<DistortionProcessor>,           // 1
+        std::unique_ptr<FilterProcessor>,               // 2
+        std::unique_ptr<ModulationProcessor>,           // 3
+        std::unique_ptr<AdvancedDelayProcessor>,        // 4
+        std::unique_ptr<ReverbProcessor>,               // 5
+        std::unique_ptr<AdvancedCompressorProcessor>,   // 6
+        std::unique_ptr<ChromaTapeProcessor>,           // 7
+        std::unique_ptr<MorphoCompProcessor>,           // 8
+        std::unique_ptr<PhysicalResonatorProcessor>,    // 9
+        std::unique_ptr<SpectralAnimatorProcessor>,     // 10
+        std::unique_ptr<HelicalDelayProcessor>,         // 11
+        std::unique_ptr<ChronoVerbProcessor>,           // 12
+        std::unique_ptr<TectonicDelayProcessor>>;       // 13
+
+    static constexpr int numChoices = (int)std::variant_size_v<Variant>;
+
+    static std::unique_ptr<HostedModule> create(int choice, juce::AudioProcessorValueTreeState& apvts, int slotIndex);
+
+    // Modules with nonlinear stages (Distortion, ChromaTape saturation, MorphoComp saturation,
+    // Tectonic tube) are the only ones that gain anything from running oversampled.
+    static bool benefitsFromOversampling(int choice) noexcept
+    {
+        return choice == 1 || choice == 7 || choice == 8 || choice == 13;
+    }
+
+    int getChoice() const noexcept { return (int)module.index(); }
+    bool isEmpty() const noexcept { return module.index() == 0; }
+
+    juce::AudioProcessor& get() const
+    {
+        return std::visit([](const auto& m) -> juce::AudioProcessor& { return *m; }, module);
+    }
+
+    void process(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
+    {
+        std::visit([&](auto& m)
+            {
+                using Module = typename std::decay_t<decltype(m)>::element_type;
+                m->Module::processBlock(buffer, midi); // Qualified call: no virtual dispatch.
+            }, module);
+    }
+
+    Variant module { std::make_unique<PassThroughProcessor>() }; // Empty, never null
+};
@@ -0,0 +1,41 @@
+//================================================================================
+// File: ParameterHandle.h
+//================================================================================
+#pragma once
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <atomic>
+
+/**
+ * A parameter's raw value pointer, resolved once from the APVTS when the owner is constructed.
+ * Reading it on the audio thread is a single relaxed atomic load: no juce::String, no map lookup.
+ * An unknown ID asserts in debug builds and reads as 0 instead of crashing.
+ */
+class ParameterHandle
+{
+public:
+    ParameterHandle() = default;
+
+    ParameterHandle(juce::AudioProcessorValueTreeState& apvts, const juce::String& parameterID)
+        : value(apvts.getRawParameterValue(parameterID))
+    {
+        jassert(value != nullptr); // Parameter ID not in the layout
+        if (value == nullptr)
+            value = &missingValue();
+    }
+
+    float get() const noexcept { return value->load(std::memory_order_relaxed); }
+    int getIndex() const noexcept { return (int)value->load(std::memory_order_relaxed); }
+    bool isOn() const noexcept { return value->load(std::memory_order_relaxed) > 0.5f; }
+
+    template <typename Enum>
+    Enum getChoice() const noexcept { return static_cast<Enum>(getIndex()); }
+
+private:
+    static std::atomic<float>& missingValue() noexcept
+    {
+        static std::atomic<float> zero{ 0.0f };
+        return zero;
+    }
+
+    std::atomic<float>* value = &missingValue();
+};
@@ -46,8 +46,35 @@ ModularMultiFxAudioProcessorEditor::ModularMultiFxAudioProcessorEditor(ModularMu
         oversamplingRateAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(processorRef.apvts, "OVERSAMPLING_RATE", oversamplingRateBox);
     }
 
+    addAndMakeVisible(routingBox);
+    if (auto* routingParam = processorRef.apvts.getParameter("ROUTING")) {
+        routingBox.addItemList(routingParam->getAllValueStrings(), 1);
+        routingAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(processorRef.apvts, "ROUTING", routingBox);
+    }
+    routingBox.setTooltip("Parallel modes run rows of slots side by side and merge them before the next row");
+    addAndMakeVisible(routingMergeBox);
+    if (auto* mergeParam = processorRef.apvts.getParameter("ROUTING_MERGE")) {
+        routingMergeBox.addItemList(mergeParam->getAllValueStrings(), 1);
+        routingMergeAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(processorRef.apvts, "ROUTING_MERGE", routingMergeBox);
+    }
+    addAndMakeVisible(pipelineBox);
+    if (auto* pipelineParam = processorRef.apvts.getParameter("PIPELINE_STAGES")) {
+        pipelineBox.addItemList(pipelineParam->getAllValueStrings(), 1);
+        pipelineAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(processorRef.apvts, "PIPELINE_STAGES", pipelineBox);
+    }
+    pipelineBox.setTooltip("Runs the chain as stages on several cores; each extra stage adds one block of latency");
+    addAndMakeVisible(spectralAsyncButton); spectralAsyncButton.setButtonText("Async FFT"); spectralAsyncAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(processorRef.apvts, "SPECTRAL_ASYNC", spectralAsyncButton);
+    spectralAsyncButton.setTooltip("Spectral modules transform their frames on a background thread; adds one hop of latency");
+    addAndMakeVisible(deterministicSeedsButton); deterministicSeedsButton.setButtonText("Fixed Seeds"); deterministicSeedsAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(processorRef.apvts, "DETERMINISTIC_SEEDS", deterministicSeedsButton);
+    deterministicSeedsButton.setTooltip("Noise, grain scatter and crackle restart from each slot's saved seed, so repeated renders are identical");
+
     addAndMakeVisible(osLockWarningLabel); osLockWarningLabel.setFont(juce::FontOptions(11.0f).withStyle("Italic")); osLockWarningLabel.setColour(juce::Label::textColourId, juce::Colours::orange); osLockWarningLabel.setJustificationType(juce::Justification::centredLeft); osLockWarningLabel.setVisible(false);
 
+    addAndMakeVisible(traceButton); traceButton.onClick = [this] { toggleTraceCapture(); };
+    traceButton.setTooltip("Records a timeline of the audio thread as Chrome trace JSON (chrome://tracing, ui.perfetto.dev)");
+    traceButton.setToggleState(processorRef.getTraceRecorder().isCapturing(), juce::dontSendNotification);
+    if (traceButton.getToggleState()) traceButton.setButtonText("Stop Trace");
+
     addAndMakeVisible(autoGainButton); autoGainButton.setButtonText("Auto-Gain"); autoGainAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(processorRef.apvts, "SAG_ENABLE", autoGainButton);
 
     addAndMakeVisible(inputGainFader); addAndMakeVisible(outputGainFader); addAndMakeVisible(responseTimeKnob);
@@ -124,7 +151,7 @@ void ModularMultiFxAudioProcessorEditor::updateSlotsAndResize() {
     int slotsToShow = processorRef.getVisibleSlotCount();
     if (moduleSlots.size() < (size_t) slotsToShow) {
         for (int i = (int) moduleSlots.size(); i < slotsToShow; ++i) {
-            moduleSlots.push_back(std::make_unique<ModuleSlot>(processorRef.apvts, i));
+            moduleSlots.push_back(std::make_unique<ModuleSlot>(processorRef.apvts, i, &processorRef.getSlotCpuMeter()));
             addAndMakeVisible(*moduleSlots.back());
         }
     } else if (moduleSlots.size() > (size_t) slotsToShow) {
@@ -177,6 +204,12 @@ void ModularMultiFxAudioProcessorEditor::resized() {
     auto osArea = headerTop.removeFromLeft(250).reduced(0, 8);
     oversamplingAlgoBox.setBounds(osArea.removeFromLeft(140)); osArea.removeFromLeft(10); oversamplingRateBox.setBounds(osArea);
     autoGainButton.setBounds(headerTop.removeFromRight(120).reduced(0, 8));
+    traceButton.setBounds(headerTop.removeFromRight(80).reduced(0, 14));
+    deterministicSeedsButton.setBounds(headerTop.removeFromRight(100).reduced(0, 14));
+    auto routingArea = headerBottom.removeFromLeft(250).reduced(0, 8);
+    routingBox.setBounds(routingArea.removeFromLeft(140)); routingArea.removeFromLeft(10); routingMergeBox.setBounds(routingArea);
+    auto pipelineArea = headerBottom.removeFromRight(250).reduced(0, 8);
+    pipelineBox.setBounds(pipelineArea.removeFromRight(140)); pipelineArea.removeFromRight(10); spectralAsyncButton.setBounds(pipelineArea);
     auto titleBounds = headerTop; titleLabel.setBounds(titleBounds.removeFromTop(24)); subtitleLabel.setBounds(titleBounds);
     juce::FlexBox fb; fb.justifyContent = juce::FlexBox::JustifyContent::center; fb.alignItems = juce::FlexBox::AlignItems::center; float knobSize = (float) headerBottom.getHeight(); fb.items.add(juce::FlexItem(responseTimeKnob).withWidth(knobSize).withHeight(knobSize)); fb.performLayout(headerBottom);
 
@@ -223,4 +256,28 @@ void ModularMultiFxAudioProcessorEditor::refreshPresetBar(){
     }
 }
 
+void ModularMultiFxAudioProcessorEditor::toggleTraceCapture()
+{
+    auto& recorder = processorRef.getTraceRecorder();
+    if (recorder.isCapturing())
+    {
+        recorder.stopCapture();
+        traceButton.setButtonText("Trace");
+        traceButton.setToggleState(false, juce::dontSendNotification);
+        traceButton.setTooltip("Last capture: " + recorder.getCaptureFile().getFullPathName()
+                               + (recorder.getNumDroppedEvents() > 0 ? " (" + juce::String(recorder.getNumDroppedEvents()) + " spans dropped)" : juce::String()));
+        return;
+    }
+
+    auto file = juce::File::getSpecialLocation(juce::File::userDocumentsDirectory)
+                    .getChildFile("Tessera Traces")
+                    .getChildFile("Tessera " + juce::Time::getCurrentTime().formatted("%Y-%m-%d %H-%M-%S") + ".json");
+    if (recorder.startCapture(file))
+    {
+        traceButton.setButtonText("Stop Trace");
+        traceButton.setToggleState(true, juce::dontSendNotification);
+        traceButton.setTooltip("Recording to " + file.getFullPathName());
+    }
+}
+
 // EOF
\ No newline at end of file
@@ -29,6 +29,7 @@ private:
     // NEW: Helper function to update the state of OS controls
     void updateOversamplingControlsState();
     void refreshPresetBar();
+    void toggleTraceCapture();
 
     ModularMultiFxAudioProcessor& processorRef;
     CustomLookAndFeel customLookAndFeel;
@@ -46,11 +47,17 @@ private:
     // juce::ComboBox oversamplingBox; // REMOVED
     juce::ComboBox oversamplingAlgoBox;
     juce::ComboBox oversamplingRateBox;
+    juce::ComboBox routingBox;
+    juce::ComboBox routingMergeBox;
+    juce::ComboBox pipelineBox;
+    juce::ToggleButton spectralAsyncButton;
+    juce::ToggleButton deterministicSeedsButton;
 
     // NEW: Label for OS Lock Warning
     juce::Label osLockWarningLabel;
 
     juce::ToggleButton autoGainButton;
+    juce::TextButton traceButton{ "Trace" };
     // UPDATED: Input/Output Gain Faders and Response Knob
     // These components manage their own attachments internally (see ParameterUIs.h).
     VerticalFaderWithAttachment inputGainFader;  // Changed from RotaryKnobWithLabels
@@ -66,8 +73,13 @@ private:
     // std::unique_ptr<...> oversamplingAttachment; // REMOVED
     std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> oversamplingAlgoAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> oversamplingRateAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> routingAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> routingMergeAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> pipelineAttachment;
 
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> autoGainAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> spectralAsyncAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> deterministicSeedsAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> masterMixAttachment;
 
     // Preset bar
@@ -4,58 +4,6 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 
-// Include all FX module headers
-#include "FX_Modules/DistortionProcessor.h"
-#include "FX_Modules/FilterProcessor.h"
-#include "FX_Modules/ModulationProcessor.h"
-#include "FX_Modules/AdvancedDelayProcessor.h"
-#include "FX_Modules/ReverbProcessor.h"
-#include "FX_Modules/AdvancedCompressorProcessor.h"
-#include "FX_Modules/ChromaTapeProcessor.h"
-#include "FX_Modules/MorphoCompProcessor.h"
-#include "FX_Modules/PhysicalResonatorProcessor.h"
-#include "FX_Modules/SpectralAnimatorProcessor.h"
-#include "FX_Modules/HelicalDelayProcessor.h"
-#include "FX_Modules/ChronoVerbProcessor.h"
-#include "FX_Modules/TectonicDelayProcessor.h"
-
-// A simple processor to pass audio through when no other module is loaded.
-class PassThroughProcessor : public juce::AudioProcessor
-{
-public:
-    PassThroughProcessor()
-        : AudioProcessor(BusesProperties().withInput("Input", juce::AudioChannelSet::stereo(), true)
-            .withOutput("Output", juce::AudioChannelSet::stereo(), true)) {
-    }
-
-    void prepareToPlay(double, int) override {}
-    void releaseResources() override {}
-    void reset() override {}
-    void processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi) override
-    {
-        juce::ignoreUnused(midi);
-        juce::ScopedNoDenormals noDenormals;
-        for (auto ch = getTotalNumInputChannels(); ch < getTotalNumOutputChannels(); ++ch)
-            buffer.clear(ch, 0, buffer.getNumSamples());
-    }
-    const juce::String getName() const override { return "PassThrough"; }
-    bool hasEditor() const override { return false; }
-    juce::AudioProcessorEditor* createEditor() override { return nullptr; }
-    bool acceptsMidi() const override { return false; }
-    bool producesMidi() const override { return false; }
-    double getTailLengthSeconds() const override { return 0.0; }
-    int getNumPrograms() override { return 1; }
-    int getCurrentProgram() override { return 0; }
-    void setCurrentProgram(int) override {}
-    const juce::String getProgramName(int) override { return {}; }
-    void changeProgramName(int, const juce::String&) override {}
-    void getStateInformation(juce::MemoryBlock&) override {}
-    void setStateInformation(const void*, int) override {}
-private:
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PassThroughProcessor)
-};
-
-
 ModularMultiFxAudioProcessor::ModularMultiFxAudioProcessor()
     : AudioProcessor(BusesProperties().withInput("Input", juce::AudioChannelSet::stereo(), true)
         .withOutput("Output", juce::AudioChannelSet::stereo(), true))
@@ -63,18 +11,36 @@ ModularMultiFxAudioProcessor::ModularMultiFxAudioProcessor()
     presetManager = std::make_unique<PresetManager>(apvts, *this, "Tessera");
     activeContext = std::make_unique<ProcessingContextWrapper>();
 
-    auto defaultAlgo = apvts.getRawParameterValue("OVERSAMPLING_ALGO")->load();
-    auto defaultRate = apvts.getRawParameterValue("OVERSAMPLING_RATE")->load();
-    auto initialAlgo = static_cast<OversamplingAlgorithm>((int)defaultAlgo);
-    auto initialRate = static_cast<OversamplingRate>((int)defaultRate);
+    for (int i = 0; i < maxSlots; ++i)
+    {
+        slotChoiceParams[(size_t)i] = ParameterHandle(apvts, "SLOT_" + juce::String(i + 1) + "_CHOICE");
+        slotOSModeParams[(size_t)i] = ParameterHandle(apvts, "SLOT_" + juce::String(i + 1) + "_OS_MODE");
+        slotSeedParams[(size_t)i] = ParameterHandle(apvts, "SLOT_" + juce::String(i + 1) + "_SEED");
+    }
+    masterMixParam = ParameterHandle(apvts, "MASTER_MIX");
+    inputGainParam = ParameterHandle(apvts, "INPUT_GAIN");
+    outputGainParam = ParameterHandle(apvts, "OUTPUT_GAIN");
+    sagEnableParam = ParameterHandle(apvts, "SAG_ENABLE");
+    sagResponseParam = ParameterHandle(apvts, "SAG_RESPONSE");
+    routingParam = ParameterHandle(apvts, "ROUTING");
+    branchMergeParam = ParameterHandle(apvts, "ROUTING_MERGE");
+    pipelineStagesParam = ParameterHandle(apvts, "PIPELINE_STAGES");
+    spectralAsyncParam = ParameterHandle(apvts, "SPECTRAL_ASYNC");
+    deterministicSeedsParam = ParameterHandle(apvts, "DETERMINISTIC_SEEDS");
+
+    auto initialAlgo = ParameterHandle(apvts, "OVERSAMPLING_ALGO").getChoice<OversamplingAlgorithm>();
+    auto initialRate = ParameterHandle(apvts, "OVERSAMPLING_RATE").getChoice<OversamplingRate>();
     pendingOSAlgo.store(initialAlgo);
     pendingOSRate.store(initialRate);
     effectiveOSAlgo.store(initialAlgo);
     effectiveOSRate.store(initialRate);
 
-    fxSlotNodes.resize(maxSlots);
     for (int i = 0; i < maxSlots; ++i)
+    {
         apvts.addParameterListener("SLOT_" + juce::String(i + 1) + "_CHOICE", this);
+        apvts.addParameterListener("SLOT_" + juce::String(i + 1) + "_OS_MODE", this);
+        apvts.addParameterListener("SLOT_" + juce::String(i + 1) + "_SEED", this);
+    }
 
     apvts.addParameterListener("OVERSAMPLING_ALGO", this);
     apvts.addParameterListener("OVERSAMPLING_RATE", this);
@@ -82,12 +48,29 @@ ModularMultiFxAudioProcessor::ModularMultiFxAudioProcessor()
     apvts.addParameterListener("INPUT_GAIN", this);
     apvts.addParameterListener("OUTPUT_GAIN", this);
     apvts.addParameterListener("SAG_RESPONSE", this);
+    apvts.addParameterListener("ROUTING", this);
+    apvts.addParameterListener("ROUTING_MERGE", this);
+    apvts.addParameterListener("PIPELINE_STAGES", this);
+    apvts.addParameterListener("SPECTRAL_ASYNC", this);
+    apvts.addParameterListener("DETERMINISTIC_SEEDS", this);
+
+    contextBuilder.startThread(juce::Thread::Priority::low);
 }
 
 ModularMultiFxAudioProcessor::~ModularMultiFxAudioProcessor()
 {
+    contextBuilder.stopThread(2000);
+    workerPool.stop();
+    recycleRetiredContexts();
+    contextPool.clear();
+    delete pendingContext.exchange(nullptr);
+
     for (int i = 0; i < maxSlots; ++i)
+    {
         apvts.removeParameterListener("SLOT_" + juce::String(i + 1) + "_CHOICE", this);
+        apvts.removeParameterListener("SLOT_" + juce::String(i + 1) + "_OS_MODE", this);
+        apvts.removeParameterListener("SLOT_" + juce::String(i + 1) + "_SEED", this);
+    }
 
     apvts.removeParameterListener("OVERSAMPLING_ALGO", this);
     apvts.removeParameterListener("OVERSAMPLING_RATE", this);
@@ -95,12 +78,21 @@ ModularMultiFxAudioProcessor::~ModularMultiFxAudioProcessor()
     apvts.removeParameterListener("INPUT_GAIN", this);
     apvts.removeParameterListener("OUTPUT_GAIN", this);
     apvts.removeParameterListener("SAG_RESPONSE", this);
+    apvts.removeParameterListener("ROUTING", this);
+    apvts.removeParameterListener("ROUTING_MERGE", this);
+    apvts.removeParameterListener("PIPELINE_STAGES", this);
+    apvts.removeParameterListener("SPECTRAL_ASYNC", this);
+    apvts.removeParameterListener("DETERMINISTIC_SEEDS", this);
 }
 
 void ModularMultiFxAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    // Holding builderLock keeps the builder from building against a half-updated configuration.
+    const juce::ScopedLock sl(builderLock);
+
     preparedSampleRate = sampleRate;
     preparedMaxBlockSize = samplesPerBlock;
+    cpuMeter.prepare(sampleRate);
 
     double safeSR = preparedSampleRate > 0 ? preparedSampleRate : 44100.0;
     int safeBS = preparedMaxBlockSize > 0 ? preparedMaxBlockSize : 512;
@@ -113,9 +105,6 @@ void ModularMultiFxAudioProcessor::prepareToPlay(double sampleRate, int samplesP
         isGraphDirty.store(true);
     }
 
-    if (activeContext && activeContext->graph)
-        activeContext->graph->setPlayConfigDetails(getTotalNumInputChannels(), getTotalNumOutputChannels(), safeSR, safeBS);
-
     if (numChannels > 0)
     {
         dryBufferForMixing.setSize(numChannels, safeBS);
@@ -130,16 +119,25 @@ void ModularMultiFxAudioProcessor::prepareToPlay(double sampleRate, int samplesP
     smartAutoGain.prepare(spec);
     updateSmartAutoGainParameters();
     updateGainStages();
-
-    isGraphDirty.store(true);
-    if (isGraphDirty.load())
+    workerPool.start();
+
+    // The audio thread is stopped here, so build synchronously and install without a crossfade.
+    delete pendingContext.exchange(nullptr);
+    latestContext = activeContext.get(); // It may have pointed at the pending context
+    contextPool.clear(); // Built for the old sample rate / block size
+    isGraphDirty.store(false);
+    isSlotLayoutDirty.store(false);
+    if (auto ctx = buildContext(effectiveOSAlgo.load(), effectiveOSRate.load()))
     {
-        initiateGraphUpdate();
-        if (fadeState.load() == FadeState::Fading)
-        {
-            fadeState.store(FadeState::Idle);
-            previousContext.reset();
-        }
+        fadeState.store(FadeState::Idle);
+        previousContext.reset();
+        activeContext = std::move(ctx);
+        latestContext = activeContext.get();
+        setLatencySamples(activeContext->latencySamples);
+    }
+    else
+    {
+        isGraphDirty.store(true);
     }
 
     reset();
@@ -147,8 +145,8 @@ void ModularMultiFxAudioProcessor::prepareToPlay(double sampleRate, int samplesP
 
 void ModularMultiFxAudioProcessor::releaseResources()
 {
-    if (activeContext && activeContext->graph) activeContext->graph->releaseResources();
-    if (previousContext && previousContext->graph) previousContext->graph->releaseResources();
+    if (activeContext) activeContext->releaseResources();
+    if (previousContext) previousContext->releaseResources();
     smartAutoGain.reset();
     inputGainStage.reset();
     outputGainStage.reset();
@@ -156,8 +154,8 @@ void ModularMultiFxAudioProcessor::releaseResources()
 
 void ModularMultiFxAudioProcessor::reset()
 {
-    if (activeContext && activeContext->graph) activeContext->graph->reset();
-    if (previousContext && previousContext->graph) previousContext->graph->reset();
+    if (activeContext) activeContext->reset();
+    if (previousContext) previousContext->reset();
     smartAutoGain.reset();
     inputGainStage.reset();
     outputGainStage.reset();
@@ -169,14 +167,17 @@ void ModularMultiFxAudioProcessor::reset()
 
 void ModularMultiFxAudioProcessor::updateGainStages()
 {
-    if (auto* pIn = apvts.getRawParameterValue("INPUT_GAIN"))
-        inputGainStage.setGainDecibels(pIn->load());
-    if (auto* pOut = apvts.getRawParameterValue("OUTPUT_GAIN"))
-        outputGainStage.setGainDecibels(pOut->load());
+    inputGainStage.setGainDecibels(inputGainParam.get());
+    outputGainStage.setGainDecibels(outputGainParam.get());
 }
 
 void ModularMultiFxAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
 {
+    TraceRecorder::nameCurrentThread("Audio");
+    TESSERA_TRACE_SCOPE_VALUE("processBlock", "audio", buffer.getNumSamples());
+    const RealtimeGuard::ScopedRealtime realtimeScope(!isNonRealtime()); // Offline renders may block
+    const auto callbackStart = juce::Time::getHighResolutionTicks();
+    cpuMeter.beginBlock();
     updateOversamplingConfiguration();
     juce::ScopedNoDenormals noDenormals;
 
@@ -198,44 +199,64 @@ void ModularMultiFxAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer
     juce::dsp::AudioBlock<float> dryBlock(dryBufferForMixing);
     dryBlock.getSubBlock(0, (size_t)numSamples).copyFrom(subBlock);
 
-    if (isGraphDirty.load())
-        initiateGraphUpdate();
+    // Offline renders have no deadline, so build in place rather than waiting for the builder.
+    if (isNonRealtime() && (isGraphDirty.load() || isSlotLayoutDirty.load()))
+    {
+        const juce::ScopedTryLock stl(builderLock);
+        if (stl.isLocked())
+        {
+            TESSERA_TRACE_SCOPE("offline context build", "audio");
+            isGraphDirty.store(false);
+            isSlotLayoutDirty.store(false);
+            publishContext(acquireContext()); // Usually the pre-warmed offline context
+        }
+    }
+    {
+        TESSERA_TRACE_SCOPE("adoptPendingContext", "audio");
+        adoptPendingContext();
+    }
 
     auto processCtx = [&](ProcessingContextWrapper* ctx, juce::AudioBuffer<float>& tgt)
         {
-            if (!ctx || !ctx->graph) return;
-            auto* graph = ctx->graph.get();
+            if (!ctx) return;
             auto* oversampler = ctx->oversampler.get();
-            auto& osBuffer = ctx->oversampledGraphBuffer;
 
             if (oversampler != nullptr)
             {
+                // Process in place on the oversampler's upsampled data, viewed as an AudioBuffer.
                 juce::dsp::AudioBlock<float> mainBlock(tgt);
-                auto upBlock = oversampler->processSamplesUp(mainBlock);
-                int required = (int)upBlock.getNumSamples();
-                int chans = (int)upBlock.getNumChannels();
-                if (osBuffer.getNumSamples() < required || osBuffer.getNumChannels() < chans)
-                    osBuffer.setSize(chans, required, false, true, true);
-                juce::AudioBuffer<float> graphBuf(osBuffer.getArrayOfWritePointers(), chans, 0, required);
-                juce::dsp::AudioBlock<float>(graphBuf).copyFrom(upBlock);
-                graph->processBlock(graphBuf, midi);
-                upBlock.copyFrom(juce::dsp::AudioBlock<float>(graphBuf));
+                juce::dsp::AudioBlock<float> upBlock;
+                {
+                    TESSERA_TRACE_SCOPE("oversample up", "oversampling");
+                    upBlock = oversampler->processSamplesUp(mainBlock);
+                }
+                auto& channels = ctx->oversampledChannels;
+                int chans = juce::jmin((int)upBlock.getNumChannels(), (int)channels.size());
+                for (int ch = 0; ch < chans; ++ch)
+                    channels[(size_t)ch] = upBlock.getChannelPointer((size_t)ch);
+                juce::AudioBuffer<float> graphBuf(channels.data(), chans, (int)upBlock.getNumSamples());
+                SlotHostProcessor::scaleMidiPositions(midi, ctx->oversampledMidi, (int)oversampler->getOversamplingFactor());
+                ctx->process(graphBuf, ctx->oversampledMidi);
+                TESSERA_TRACE_SCOPE("oversample down", "oversampling");
                 oversampler->processSamplesDown(mainBlock);
             }
             else
             {
-                graph->processBlock(tgt, midi);
+                ctx->process(tgt, midi);
             }
         };
 
     if (fadeState.load() == FadeState::Fading && previousContext)
     {
+        TESSERA_TRACE_SCOPE("context crossfade", "audio");
         for (int ch = 0; ch < totalIn; ++ch)
             if (ch < fadeBuffer.getNumChannels())
                 fadeBuffer.copyFrom(ch, 0, buffer, ch, 0, numSamples);
 
-        processCtx(previousContext.get(), fadeBuffer);
+        // The incoming context goes first: the graph fallback consumes the MIDI buffer, and only
+        // the context that stays needs the notes.
         processCtx(activeContext.get(), buffer);
+        processCtx(previousContext.get(), fadeBuffer);
 
         int samplesToFade = std::min(numSamples, fadeSamplesRemaining);
         for (int i = 0; i < samplesToFade; ++i)
@@ -257,7 +278,8 @@ void ModularMultiFxAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer
         if (fadeSamplesRemaining <= 0)
         {
             fadeState.store(FadeState::Idle);
-            previousContext.reset();
+            if (retireContext(previousContext.get()))
+                previousContext.release();
         }
     }
     else
@@ -265,11 +287,14 @@ void ModularMultiFxAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer
         processCtx(activeContext.get(), buffer);
     }
 
-    smartAutoGain.process(dryBlock.getSubBlock(0, (size_t)numSamples), subBlock);
+    {
+        TESSERA_TRACE_SCOPE("SmartAutoGain", "audio");
+        smartAutoGain.process(dryBlock.getSubBlock(0, (size_t)numSamples), subBlock);
+    }
     juce::dsp::ProcessContextReplacing<float> outCtx(subBlock);
     outputGainStage.process(outCtx);
 
-    float masterMix = apvts.getRawParameterValue("MASTER_MIX")->load();
+    float masterMix = masterMixParam.get();
     for (int ch = 0; ch < totalOut; ++ch)
     {
         if (ch < dryBufferForMixing.getNumChannels())
@@ -278,6 +303,15 @@ void ModularMultiFxAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer
             buffer.addFrom(ch, 0, dryBufferForMixing, ch, 0, numSamples, 1.0f - masterMix);
         }
     }
+
+    int sleepingSlots = 0;
+    if (activeContext)
+        for (auto* host : activeContext->slotHosts)
+            if (host != nullptr && host->isSleeping())
+                ++sleepingSlots;
+    numSleepingSlots.store(sleepingSlots, std::memory_order_relaxed);
+
+    cpuMeter.endBlock(numSamples, juce::Time::getHighResolutionTicks() - callbackStart);
 }
 
 juce::AudioProcessorValueTreeState::ParameterLayout ModularMultiFxAudioProcessor::createParameterLayout()
@@ -291,6 +325,10 @@ juce::AudioProcessorValueTreeState::ParameterLayout ModularMultiFxAudioProcessor
         auto slotId = "SLOT_" + juce::String(i + 1);
         auto slotPrefix = slotId + "_";
         params.push_back(std::make_unique<juce::AudioParameterChoice>(slotId + "_CHOICE", slotId + " FX", fxChoices, 0));
+        params.push_back(std::make_unique<juce::AudioParameterChoice>(slotId + "_OS_MODE", slotId + " Oversampling", juce::StringArray{ "Auto", "Off", "On" }, 0));
+        // Seed of the slot's random sources while DETERMINISTIC_SEEDS is on. Saved with the session, never automated.
+        params.push_back(std::make_unique<juce::AudioParameterInt>(slotId + "_SEED", slotId + " Seed", 0, (1 << 24) - 1, i + 1,
+                                                                   juce::AudioParameterIntAttributes().withAutomatable(false)));
 
         // Distortion
         params.push_back(std::make_unique<juce::AudioParameterFloat>(slotPrefix + "DISTORTION_DRIVE", "Drive", 0.0f, 24.0f, 0.0f));
@@ -377,6 +415,10 @@ juce::AudioProcessorValueTreeState::ParameterLayout ModularMultiFxAudioProcessor
         params.push_back(std::make_unique<juce::AudioParameterFloat>(physResPrefix + "SENSITIVITY", "Sensitivity", 0.0f, 1.0f, 0.5f));
         params.push_back(std::make_unique<juce::AudioParameterFloat>(physResPrefix + "MIX", "Mix", 0.0f, 1.0f, 1.0f));
         params.push_back(std::make_unique<juce::AudioParameterChoice>(physResPrefix + "NOISE_TYPE", "Noise Type", juce::StringArray{ "White", "Pink" }, 0));
+        params.push_back(std::make_unique<juce::AudioParameterChoice>(physResPrefix + "PARTIALS", "Max Partials", juce::StringArray{ "16", "32", "60", "120", "240" }, 2));
+        params.push_back(std::make_unique<juce::AudioParameterChoice>(physResPrefix + "STRINGS", "Strings", juce::StringArray{ "6", "12", "18", "24" }, 0));
+        params.push_back(std::make_unique<juce::AudioParameterBool>(physResPrefix + "STEREO_LINK", "Stereo Link", false));
+        params.push_back(std::make_unique<juce::AudioParameterChoice>(physResPrefix + "STRING_TRIGGER", "String Trigger", juce::StringArray{ "Continuous", "Transients", "MIDI" }, 0));
         params.push_back(std::make_unique<juce::AudioParameterFloat>(physResPrefix + "ATTACK", "Attack", juce::NormalisableRange<float>(0.001f, 1.0f, 0.0f, 0.3f), 0.001f));
         params.push_back(std::make_unique<juce::AudioParameterFloat>(physResPrefix + "DECAY", "Decay", juce::NormalisableRange<float>(0.01f, 2.0f, 0.0f, 0.3f), 0.05f));
         params.push_back(std::make_unique<juce::AudioParameterFloat>(physResPrefix + "SUSTAIN", "Sustain", 0.0f, 1.0f, 0.0f));
@@ -431,6 +473,11 @@ juce::AudioProcessorValueTreeState::ParameterLayout ModularMultiFxAudioProcessor
     // Global Parameters
     params.push_back(std::make_unique<juce::AudioParameterChoice>("OVERSAMPLING_ALGO", "OS Algorithm", juce::StringArray{ "Live (IIR)", "HQ (FIR)", "Deluxe (FIR)" }, 1));
     params.push_back(std::make_unique<juce::AudioParameterChoice>("OVERSAMPLING_RATE", "OS Rate", juce::StringArray{ "1x (Off)", "2x", "4x", "8x", "16x" }, 2));
+    params.push_back(std::make_unique<juce::AudioParameterChoice>("ROUTING", "Routing", juce::StringArray{ "Serial", "Parallel Rows", "Parallel Halves", "Rows 1-2 Parallel", "Rows 1-3 Parallel" }, 0));
+    params.push_back(std::make_unique<juce::AudioParameterChoice>("ROUTING_MERGE", "Branch Merge", juce::StringArray{ "Average", "Sum" }, 0));
+    params.push_back(std::make_unique<juce::AudioParameterChoice>("PIPELINE_STAGES", "Pipeline", juce::StringArray{ "Pipeline Off", "2 Stages", "3 Stages", "4 Stages" }, 0));
+    params.push_back(std::make_unique<juce::AudioParameterBool>("SPECTRAL_ASYNC", "Async Spectral Frames", false));
+    params.push_back(std::make_unique<juce::AudioParameterBool>("DETERMINISTIC_SEEDS", "Deterministic Seeds", false));
     params.push_back(std::make_unique<juce::AudioParameterFloat>("MASTER_MIX", "Master Mix", 0.0f, 1.0f, 1.0f));
     params.push_back(std::make_unique<juce::AudioParameterFloat>("INPUT_GAIN", "Input Gain", juce::NormalisableRange<float>(-24.0f, 24.0f, 0.1f), 0.0f));
     params.push_back(std::make_unique<juce::AudioParameterFloat>("OUTPUT_GAIN", "Output Gain", juce::NormalisableRange<float>(-24.0f, 24.0f, 0.1f), 0.0f));
@@ -463,10 +510,8 @@ bool ModularMultiFxAudioProcessor::checkForChromaTapeUsage() const
     int numVisible = getVisibleSlotCount();
     for (int i = 0; i < numVisible; ++i)
     {
-        auto choiceParamId = "SLOT_" + juce::String(i + 1) + "_CHOICE";
-        if (auto* p = apvts.getRawParameterValue(choiceParamId))
-            if (static_cast<int>(p->load()) == 7) // 7 is ChromaTape
-                return true;
+        if (slotChoiceParams[(size_t)i].getIndex() == 7) // 7 is ChromaTape
+            return true;
     }
     return false;
 }
@@ -479,8 +524,8 @@ void ModularMultiFxAudioProcessor::updateOversamplingConfiguration()
 
     if (isNonRealtime())
     {
-        newAlgo = OversamplingAlgorithm::Deluxe;
-        newRate = OversamplingRate::x8;
+        newAlgo = offlineOSAlgo;
+        newRate = offlineOSRate;
     }
     else if (checkForChromaTapeUsage())
     {
@@ -505,57 +550,263 @@ void ModularMultiFxAudioProcessor::updateOversamplingConfiguration()
     }
 }
 
-void ModularMultiFxAudioProcessor::initiateGraphUpdate()
+//==============================================================================
+// Context hand-over. buildContext() runs on the ContextBuilder thread (or inside prepareToPlay);
+// the audio thread only swaps pointers and never allocates, prepares or destroys a context.
+//==============================================================================
+void ModularMultiFxAudioProcessor::ContextBuilder::run()
 {
-    if (previousContext)
+    TraceRecorder::nameCurrentThread("Context Builder");
+    while (!threadShouldExit())
     {
-        if (previousContext->graph) previousContext->graph->releaseResources();
-        previousContext.reset();
+        owner.recycleRetiredContexts();
+
+        {
+            const juce::ScopedLock sl(owner.builderLock);
+
+            if (owner.isGraphDirty.load() || owner.isSlotLayoutDirty.load())
+            {
+                // Try the cheap path first: swap only the slots whose choice changed.
+                if (owner.isSlotLayoutDirty.exchange(false))
+                {
+                    if (!owner.isGraphDirty.load())
+                        if (owner.latestContext == nullptr || !owner.updateSlots(*owner.latestContext))
+                            owner.isGraphDirty.store(true);
+                    owner.syncPooledContexts();
+                }
+
+                if (owner.isGraphDirty.exchange(false))
+                    owner.publishContext(owner.acquireContext());
+            }
+            else
+            {
+                owner.prewarmOfflineContext();
+            }
+
+            // The audio thread retires a replaced module only once its crossfade ends, so collect
+            // on every pass rather than waiting for the next slot change.
+            if (auto* ctx = owner.latestContext)
+                for (auto* host : ctx->slotHosts)
+                    if (host != nullptr)
+                        host->destroyRetiredModules();
+        }
+
+        wait(pollIntervalMs);
+    }
+}
+
+std::unique_ptr<ProcessingContextWrapper> ModularMultiFxAudioProcessor::buildContext(OversamplingAlgorithm algo, OversamplingRate rate)
+{
+    TESSERA_TRACE_SCOPE("buildContext", "builder");
+    auto ctx = std::make_unique<ProcessingContextWrapper>();
+    ctx->osAlgo = algo;
+    ctx->osRate = rate;
+
+    if (!updateGraph(*ctx))
+        return nullptr;
+
+    // The serial chain reports host-rate latency including its domains' oversamplers. The graph
+    // fallback runs entirely oversampled, so its latency is in oversampled samples.
+    if (ctx->oversampler)
+        ctx->latencySamples = juce::roundToInt(ctx->oversampler->getLatencyInSamples()
+            + (double)ctx->getChainLatencySamples() / (double)ctx->oversampler->getOversamplingFactor());
+    else
+        ctx->latencySamples = ctx->getChainLatencySamples();
+
+    return ctx;
+}
+
+void ModularMultiFxAudioProcessor::publishContext(std::unique_ptr<ProcessingContextWrapper> ctx)
+{
+    if (ctx == nullptr) return;
+    latestContext = ctx.get();
+
+    // If the audio thread has not adopted the previous build yet, it is stale. We are never on a
+    // realtime thread here (builder or offline render), so it can be destroyed directly.
+    delete pendingContext.exchange(ctx.release());
+}
+
+void ModularMultiFxAudioProcessor::adoptPendingContext()
+{
+    // Wait for the running crossfade to finish, and for its outgoing context to be retired.
+    if (fadeState.load() == FadeState::Fading)
+        return;
+    if (previousContext != nullptr)
+    {
+        if (!retireContext(previousContext.get()))
+            return;
+        previousContext.release();
     }
+
+    auto* ready = pendingContext.exchange(nullptr);
+    if (ready == nullptr) return;
+
     previousContext = std::move(activeContext);
-    activeContext = std::make_unique<ProcessingContextWrapper>();
+    activeContext.reset(ready);
 
-    auto algo = effectiveOSAlgo.load();
-    auto rate = effectiveOSRate.load();
-    int channels = currentOSChannels.load();
-    if (channels == 0) channels = juce::jmax(getTotalNumInputChannels(), getTotalNumOutputChannels());
-    if (channels == 0) channels = 2;
+    if (getSampleRate() > 0 && previousContext)
+    {
+        int fadeSamples = (int)(getSampleRate() * crossfadeDurationMs / 1000.0);
+        totalFadeSamples = std::max(1, fadeSamples);
+        fadeSamplesRemaining = totalFadeSamples;
+        fadeState.store(FadeState::Fading);
+    }
+    else if (previousContext && retireContext(previousContext.get()))
+    {
+        previousContext.release();
+    }
+
+    setLatencySamples(activeContext->latencySamples);
+}
+
+// Audio thread only (single producer for retiredFifo).
+bool ModularMultiFxAudioProcessor::retireContext(ProcessingContextWrapper* ctx)
+{
+    if (ctx == nullptr) return true;
+
+    const auto scope = retiredFifo.write(1);
+    if (scope.blockSize1 + scope.blockSize2 == 0)
+        return false; // Queue full; caller keeps ownership and retries later.
 
-    if (channels > 0)
-        activeContext->oversampler = createOversamplingEngine(rate, algo, channels);
+    retiredContexts[(size_t)(scope.blockSize1 > 0 ? scope.startIndex1 : scope.startIndex2)] = ctx;
+    return true;
+}
 
-    if (activeContext->oversampler)
+// Builder thread only, or with the builder stopped (single consumer for retiredFifo).
+// Retired contexts for another oversampling configuration are kept in the pool, the rest destroyed.
+void ModularMultiFxAudioProcessor::recycleRetiredContexts()
+{
+    const juce::ScopedLock sl(builderLock);
+    const auto scope = retiredFifo.read(retiredFifo.getNumReady());
+    auto recycle = [this](int start, int size)
+        {
+            for (int i = start; i < start + size; ++i)
+            {
+                auto*& ctx = retiredContexts[(size_t)i];
+                if (ctx) poolContext(std::unique_ptr<ProcessingContextWrapper>(ctx));
+                ctx = nullptr;
+            }
+        };
+    recycle(scope.startIndex1, scope.blockSize1);
+    recycle(scope.startIndex2, scope.blockSize2);
+}
+
+//==============================================================================
+// Context pool. Holds prepared contexts for oversampling configurations other than the current
+// one (the previous rate, the offline bounce configuration), so switching to them is a crossfade
+// instead of a rebuild. Pooled contexts are never processed; everything here runs with builderLock held.
+//==============================================================================
+std::unique_ptr<ProcessingContextWrapper> ModularMultiFxAudioProcessor::acquireContext()
+{
+    const auto algo = effectiveOSAlgo.load();
+    const auto rate = effectiveOSRate.load();
+
+    for (auto it = contextPool.begin(); it != contextPool.end(); ++it)
     {
-        if (preparedMaxBlockSize > 0)
-            activeContext->oversampler->initProcessing(preparedMaxBlockSize);
-        activeContext->oversampler->reset();
+        if ((*it)->osAlgo != algo || (*it)->osRate != rate) continue;
+
+        auto ctx = std::move(*it);
+        contextPool.erase(it);
+        if (isReusable(*ctx))
+            return ctx;
+        ctx->releaseResources();
+        break;
     }
+    return buildContext(algo, rate);
+}
+
+void ModularMultiFxAudioProcessor::poolContext(std::unique_ptr<ProcessingContextWrapper> ctx)
+{
+    const bool isCurrentConfig = ctx->osAlgo == effectiveOSAlgo.load() && ctx->osRate == effectiveOSRate.load();
+    if (isCurrentConfig || !isReusable(*ctx))
+    {
+        ctx->releaseResources();
+        return;
+    }
+
+    for (auto* host : ctx->slotHosts)
+        if (host != nullptr)
+            host->settleWhileIdle();
+    ctx->reset();
+    if (ctx->oversampler) ctx->oversampler->reset();
+
+    // One context per configuration; the oldest goes when the pool is full.
+    contextPool.erase(std::remove_if(contextPool.begin(), contextPool.end(), [&](const auto& pooled)
+        { return pooled->osAlgo == ctx->osAlgo && pooled->osRate == ctx->osRate; }), contextPool.end());
+    if ((int)contextPool.size() >= contextPoolSize)
+        contextPool.erase(contextPool.begin());
+    contextPool.push_back(std::move(ctx));
+}
 
-    if (updateGraph())
+// Applies the current slot layout to every pooled context; drops the ones that would need a rebuild.
+void ModularMultiFxAudioProcessor::syncPooledContexts()
+{
+    for (auto it = contextPool.begin(); it != contextPool.end();)
     {
-        if (getSampleRate() > 0 && previousContext)
+        auto& ctx = **it;
+        if (updateSlots(ctx) && isReusable(ctx))
+        {
+            for (auto* host : ctx.slotHosts)
+                if (host != nullptr)
+                    host->settleWhileIdle();
+            ++it;
+        }
+        else
         {
-            int fadeSamples = (int)(getSampleRate() * crossfadeDurationMs / 1000.0);
-            totalFadeSamples = std::max(1, fadeSamples);
-            fadeSamplesRemaining = totalFadeSamples;
-            fadeState.store(FadeState::Fading);
+            ctx.releaseResources();
+            it = contextPool.erase(it);
         }
-        isGraphDirty.store(false);
+    }
+}
+
+// While playing in realtime, keep the offline configuration prepared so starting a bounce
+// no longer builds a whole context on the audio thread.
+void ModularMultiFxAudioProcessor::prewarmOfflineContext()
+{
+    if (isNonRealtime() || preparedSampleRate <= 0) return;
+    if (effectiveOSAlgo.load() == offlineOSAlgo && effectiveOSRate.load() == offlineOSRate) return;
 
-        int totalLatency = 0;
-        if (activeContext->oversampler)
-            totalLatency = (int)activeContext->oversampler->getLatencyInSamples();
-        if (activeContext->graph)
-            totalLatency += activeContext->graph->getLatencySamples();
+    for (auto& ctx : contextPool)
+        if (ctx->osAlgo == offlineOSAlgo && ctx->osRate == offlineOSRate)
+            return;
 
-        setLatencySamples(totalLatency);
+    if (auto ctx = buildContext(offlineOSAlgo, offlineOSRate))
+        poolContext(std::move(ctx));
+}
+
+// True if the context was built for the prepared configuration and matches the current slot layout.
+bool ModularMultiFxAudioProcessor::isReusable(const ProcessingContextWrapper& ctx) const
+{
+    if (ctx.hostSampleRate != preparedSampleRate || ctx.hostBlockSize != preparedMaxBlockSize
+        || ctx.numChannels != currentOSChannels.load() || (ctx.graph != nullptr) != useGraphEngine.load())
+        return false;
+    if ((int)ctx.slotChoices.size() != maxSlots || (int)ctx.slotOSFactors.size() != maxSlots || (int)ctx.slotBranches.size() != maxSlots)
+        return false;
+    if (ctx.chain && (ctx.branchMerge != branchMergeParam.getChoice<BranchMerge>() || ctx.pipelineStages != 1 + pipelineStagesParam.getIndex()))
+        return false;
+    if (ctx.spectralAsync != spectralAsyncParam.isOn())
+        return false;
+    if (ctx.deterministicSeeds != deterministicSeedsParam.isOn() || (int)ctx.slotSeeds.size() != maxSlots)
+        return false;
+    if (ctx.deterministicSeeds)
+        for (int i = 0; i < maxSlots; ++i)
+            if (ctx.slotSeeds[(size_t)i] != slotSeedParams[(size_t)i].getIndex()) return false;
+
+    const auto layout = computeSlotLayout();
+    const auto branches = computeSlotBranches();
+    const auto factors = computeSlotOversampling(layout, branches, ctx.osRate);
+    for (int i = 0; i < maxSlots; ++i)
+    {
+        if (ctx.slotChoices[(size_t)i] != layout[(size_t)i]) return false;
+        if (ctx.chain && ctx.slotOSFactors[(size_t)i] != factors[(size_t)i]) return false;
+        if (ctx.chain && ctx.slotBranches[(size_t)i] != branches[(size_t)i]) return false;
     }
+    return true;
 }
 
-bool ModularMultiFxAudioProcessor::updateGraph()
+bool ModularMultiFxAudioProcessor::updateGraph(ProcessingContextWrapper& ctx)
 {
     if (preparedSampleRate <= 0 || preparedMaxBlockSize <= 0) return false;
-    if (!activeContext || !activeContext->graph) return false;
 
     int channels = currentOSChannels.load();
     if (channels == 0)
@@ -564,36 +815,199 @@ bool ModularMultiFxAudioProcessor::updateGraph()
         if (channels == 0) channels = 2;
     }
 
-    activeContext->graph->clear();
+    const auto algo = ctx.osAlgo;
+    const auto rate = ctx.osRate;
+    const bool buildGraph = useGraphEngine.load();
+
+    // The graph fallback oversamples the whole chain; the serial chain oversamples per slot domain.
+    if (buildGraph)
+        ctx.oversampler = createOversamplingEngine(rate, algo, channels);
+    if (ctx.oversampler)
+    {
+        ctx.oversampler->initProcessing((size_t)preparedMaxBlockSize);
+        ctx.oversampler->reset();
+    }
 
     double graphSR = preparedSampleRate;
     int graphBS = preparedMaxBlockSize;
-    if (activeContext->oversampler)
+    if (ctx.oversampler)
     {
-        graphSR *= activeContext->oversampler->getOversamplingFactor();
-        graphBS = (int)((double)graphBS * activeContext->oversampler->getOversamplingFactor());
+        graphSR *= ctx.oversampler->getOversamplingFactor();
+        graphBS = (int)((double)graphBS * ctx.oversampler->getOversamplingFactor());
     }
 
-    if (channels > 0 && activeContext->oversampler)
-        activeContext->oversampledGraphBuffer.setSize(channels, graphBS);
-    else
-        activeContext->oversampledGraphBuffer.setSize(0, 0);
+    ctx.oversampledChannels.assign(ctx.oversampler ? (size_t)channels : 0, nullptr);
+    ctx.oversampledMidi.ensureSize(SlotHostProcessor::midiReserveBytes);
+
+    const auto layout = computeSlotLayout();
+    ctx.slotNodes.assign(maxSlots, nullptr);
+    ctx.slotHosts.assign(maxSlots, nullptr);
+    ctx.slotChoices.assign(maxSlots, 0);
+    ctx.slotLatencies.assign(maxSlots, 0);
+    ctx.slotOSFactors.assign(maxSlots, 1);
+
+    const auto branches = computeSlotBranches();
+    ctx.slotBranches.assign(branches.begin(), branches.end());
+    ctx.branchMerge = branchMergeParam.getChoice<BranchMerge>();
+    ctx.pipelineStages = 1 + pipelineStagesParam.getIndex();
+    ctx.spectralAsync = spectralAsyncParam.isOn();
+    ctx.deterministicSeeds = deterministicSeedsParam.isOn();
+    ctx.slotSeeds.resize(maxSlots);
+    for (int i = 0; i < maxSlots; ++i)
+        ctx.slotSeeds[(size_t)i] = slotSeedParams[(size_t)i].getIndex();
+
+    if (!buildGraph)
+    {
+        // Default: flat serial chain, processed in place.
+        ctx.graph.reset();
+        ctx.chain = std::make_unique<SerialChainEngine>();
+        for (int i = 0; i < maxSlots; ++i)
+        {
+            auto host = std::make_unique<SlotHostProcessor>(HostedModule::create(layout[(size_t)i], apvts, i));
+            host->setCpuMeter(&cpuMeter, i);
+            ctx.slotHosts[(size_t)i] = host.get();
+            ctx.slotChoices[(size_t)i] = layout[(size_t)i];
+            ctx.chain->setSlot(i, std::move(host));
+        }
 
-    activeContext->graph->setPlayConfigDetails(channels, channels, graphSR, graphBS);
+        // Each run of consecutive oversampled slots within one branch becomes a domain with its own oversampler.
+        const auto factors = computeSlotOversampling(layout, branches, rate);
+        for (int first = 0; first < maxSlots; ++first)
+        {
+            if (factors[(size_t)first] <= 1) continue;
+            int last = first;
+            while (last + 1 < maxSlots && factors[(size_t)(last + 1)] > 1 && branches[(size_t)(last + 1)] == branches[(size_t)first]) ++last;
+            ctx.chain->addOversampledDomain(first, last, createOversamplingEngine(rate, algo, channels));
+            first = last;
+        }
+
+        // The parallel section: consecutive slots with a branch, split wherever the branch changes.
+        std::vector<SerialChainEngine::BranchRange> branchRanges;
+        for (int i = 0; i < maxSlots; ++i)
+        {
+            if (branches[(size_t)i] == 0) continue;
+            if (branchRanges.empty() || branches[(size_t)i] != branches[(size_t)(i - 1)])
+                branchRanges.push_back({ i, i });
+            else
+                branchRanges.back().lastSlot = i;
+        }
+        if (branchRanges.size() > 1)
+        {
+            const float mergeGain = ctx.branchMerge == BranchMerge::Average ? 1.0f / (float)branchRanges.size() : 1.0f;
+            ctx.chain->addParallelSection(branchRanges, mergeGain);
+        }
+        ctx.chain->setWorkerPool(&workerPool);
+
+        // Opt-in pipelining trades one block of latency per extra stage for using more cores.
+        ctx.chain->setPipelineStages(ctx.pipelineStages);
+
+        ctx.chain->prepare(graphSR, graphBS, channels);
+        for (int i = 0; i < maxSlots; ++i)
+            ctx.slotOSFactors[(size_t)i] = ctx.chain->getOversamplingFactor(i);
+    }
+    else
+    {
+        // Fallback: the same slot hosts as nodes of an AudioProcessorGraph.
+        ctx.chain.reset();
+        ctx.graph = std::make_unique<juce::AudioProcessorGraph>();
+        auto& graph = *ctx.graph;
+        graph.setPlayConfigDetails(channels, channels, graphSR, graphBS);
 
-    inputNode = activeContext->graph->addNode(std::make_unique<juce::AudioProcessorGraph::AudioGraphIOProcessor>(juce::AudioProcessorGraph::AudioGraphIOProcessor::audioInputNode));
-    outputNode = activeContext->graph->addNode(std::make_unique<juce::AudioProcessorGraph::AudioGraphIOProcessor>(juce::AudioProcessorGraph::AudioGraphIOProcessor::audioOutputNode));
+        ctx.inputNode = graph.addNode(std::make_unique<juce::AudioProcessorGraph::AudioGraphIOProcessor>(juce::AudioProcessorGraph::AudioGraphIOProcessor::audioInputNode));
+        ctx.outputNode = graph.addNode(std::make_unique<juce::AudioProcessorGraph::AudioGraphIOProcessor>(juce::AudioProcessorGraph::AudioGraphIOProcessor::audioOutputNode));
+        ctx.midiInputNode = graph.addNode(std::make_unique<juce::AudioProcessorGraph::AudioGraphIOProcessor>(juce::AudioProcessorGraph::AudioGraphIOProcessor::midiInputNode));
 
-    auto connect = [&](juce::AudioProcessorGraph::Node* src, juce::AudioProcessorGraph::Node* dst)
+        auto connect = [&](juce::AudioProcessorGraph::Node* src, juce::AudioProcessorGraph::Node* dst)
+            {
+                if (!src || !dst) return;
+                for (int ch = 0; ch < channels; ++ch)
+                    if (graph.canConnect({ { src->nodeID, ch }, { dst->nodeID, ch } }))
+                        graph.addConnection({ { src->nodeID, ch }, { dst->nodeID, ch } });
+            };
+
+        juce::AudioProcessorGraph::Node* last = ctx.inputNode.get();
+        for (int i = 0; i < maxSlots; ++i)
         {
-            if (!src || !dst) return;
-            for (int ch = 0; ch < channels; ++ch)
-                if (activeContext->graph->canConnect({ { src->nodeID, ch }, { dst->nodeID, ch } }))
-                    activeContext->graph->addConnection({ { src->nodeID, ch }, { dst->nodeID, ch } });
-        };
+            auto host = std::make_unique<SlotHostProcessor>(HostedModule::create(layout[(size_t)i], apvts, i));
+            auto* hostPtr = host.get();
+            host->setCpuMeter(&cpuMeter, i);
+            host->setControlBlockSize(SlotHostProcessor::defaultControlBlockSize * (ctx.oversampler ? (int)ctx.oversampler->getOversamplingFactor() : 1));
+            ctx.slotNodes[(size_t)i] = graph.addNode(std::move(host));
+            if (ctx.slotNodes[(size_t)i] == nullptr) continue;
+
+            ctx.slotHosts[(size_t)i] = hostPtr;
+            ctx.slotChoices[(size_t)i] = layout[(size_t)i];
+            connect(last, ctx.slotNodes[(size_t)i].get());
+            last = ctx.slotNodes[(size_t)i].get();
+
+            // Every slot hears the same notes, as in the serial chain.
+            if (ctx.midiInputNode != nullptr)
+                graph.addConnection({ { ctx.midiInputNode->nodeID, juce::AudioProcessorGraph::midiChannelIndex },
+                                      { last->nodeID, juce::AudioProcessorGraph::midiChannelIndex } });
+        }
+
+        connect(last, ctx.outputNode.get());
+        graph.prepareToPlay(graphSR, graphBS);
+        for (auto node : graph.getNodes()) if (node && node->getProcessor()) node->getProcessor()->enableAllBuses();
+    }
+
+    for (int i = 0; i < maxSlots; ++i)
+        if (auto* host = ctx.slotHosts[(size_t)i])
+            ctx.slotLatencies[(size_t)i] = host->getLatencySamples();
+
+    ctx.graphSampleRate = graphSR;
+    ctx.graphBlockSize = graphBS;
+    ctx.hostSampleRate = preparedSampleRate;
+    ctx.hostBlockSize = preparedMaxBlockSize;
+    ctx.numChannels = channels;
+    return true;
+}
+
+// Diffs the current slot layout against the context and swaps only the modules that changed.
+// Returns false when the change cannot be applied in place (a latency change needs a full rebuild).
+bool ModularMultiFxAudioProcessor::updateSlots(ProcessingContextWrapper& ctx)
+{
+    TESSERA_TRACE_SCOPE("updateSlots", "builder");
+    if (ctx.graphSampleRate <= 0 || (int)ctx.slotHosts.size() != maxSlots) return false;
 
-    juce::AudioProcessorGraph::Node* last = inputNode.get();
-    bool added = false;
+    const auto layout = computeSlotLayout();
+
+    // Moving a slot into or out of an oversampled domain or a parallel branch (visible rows
+    // decide the branches) changes the chain's structure.
+    if (ctx.chain)
+    {
+        const auto branches = computeSlotBranches();
+        const auto factors = computeSlotOversampling(layout, branches, ctx.osRate);
+        for (int i = 0; i < maxSlots; ++i)
+            if (factors[(size_t)i] != ctx.slotOSFactors[(size_t)i] || branches[(size_t)i] != ctx.slotBranches[(size_t)i])
+                return false;
+    }
+
+    for (int i = 0; i < maxSlots; ++i)
+    {
+        int choice = layout[(size_t)i];
+        auto* host = ctx.slotHosts[(size_t)i];
+        if (host == nullptr) return false;
+        if (choice == ctx.slotChoices[(size_t)i]) continue;
+
+        const int factor = ctx.slotOSFactors[(size_t)i];
+        auto module = HostedModule::create(choice, apvts, i);
+        SlotHostProcessor::prepareModule(*module, ctx.numChannels, ctx.graphSampleRate * factor, ctx.graphBlockSize * factor);
+
+        // Chain latency is only computed when the context is built.
+        if (module->get().getLatencySamples() != ctx.slotLatencies[(size_t)i])
+            return false;
+
+        host->requestModule(std::move(module));
+        ctx.slotChoices[(size_t)i] = choice;
+    }
+    return true;
+}
+
+// Effective module per slot: hidden slots and slots covered by a multi-slot module are empty.
+std::array<int, ModularMultiFxAudioProcessor::maxSlots> ModularMultiFxAudioProcessor::computeSlotLayout() const
+{
+    std::array<int, maxSlots> layout{};
     int numVisible = getVisibleSlotCount();
     const int numCols = 4;
     int slotsConsumed = 0;
@@ -601,66 +1015,114 @@ bool ModularMultiFxAudioProcessor::updateGraph()
     for (int i = 0; i < numVisible; i += slotsConsumed)
     {
         slotsConsumed = 1;
-        auto choiceParamId = "SLOT_" + juce::String(i + 1) + "_CHOICE";
-        int choice = 0;
-        if (auto* p = apvts.getRawParameterValue(choiceParamId)) choice = (int)p->load();
+        int choice = slotChoiceParams[(size_t)i].getIndex();
         if (choice == 7) slotsConsumed = 3; // ChromaTape spans multiple slots
         int currentCol = i % numCols;
         if (currentCol + slotsConsumed > numCols) slotsConsumed = std::max(1, numCols - currentCol);
         if (i + slotsConsumed > numVisible) slotsConsumed = numVisible - i;
         if (slotsConsumed <= 0) break;
-        if (choice > 0)
-        {
-            fxSlotNodes[i] = activeContext->graph->addNode(createProcessorForChoice(choice, i));
-            if (fxSlotNodes[i]) { connect(last, fxSlotNodes[i].get()); last = fxSlotNodes[i].get(); added = true; }
-            for (int j = 1; j < slotsConsumed; ++j) if (i + j < maxSlots) fxSlotNodes[i + j] = nullptr;
-        }
-        else
-        {
-            for (int j = 0; j < slotsConsumed; ++j) if (i + j < maxSlots) fxSlotNodes[i + j] = nullptr;
-        }
+        layout[(size_t)i] = choice;
     }
+    return layout;
+}
+
+// Parallel branch of every slot under the current routing: 0 for slots in the serial part of the
+// chain, otherwise 1 + the slot's branch in the parallel section. Only rows with visible slots take
+// part, and a section left with a single branch is just serial.
+std::array<int, ModularMultiFxAudioProcessor::maxSlots> ModularMultiFxAudioProcessor::computeSlotBranches() const
+{
+    std::array<int, maxSlots> branches{};
+    const int numCols = 4;
+    const int numRows = (getVisibleSlotCount() + numCols - 1) / numCols;
 
-    if (!added)
+    std::array<int, maxSlots / numCols> rowBranch;
+    rowBranch.fill(-1);
+    switch (routingParam.getChoice<ChainRouting>())
     {
-        auto wire = activeContext->graph->addNode(std::make_unique<PassThroughProcessor>());
-        if (wire) { connect(last, wire.get()); last = wire.get(); }
+    case ChainRouting::Serial: break;
+    case ChainRouting::ParallelRows:    rowBranch = { 0, 1, 2, 3 }; break;
+    case ChainRouting::ParallelHalves:  rowBranch = { 0, 0, 1, 1 }; break;
+    case ChainRouting::ParallelRows12:  rowBranch = { 0, 1, -1, -1 }; break;
+    case ChainRouting::ParallelRows123: rowBranch = { 0, 1, 2, -1 }; break;
     }
 
-    connect(last, outputNode.get());
-    activeContext->graph->prepareToPlay(graphSR, graphBS);
-    for (auto node : activeContext->graph->getNodes()) if (node && node->getProcessor()) node->getProcessor()->enableAllBuses();
-    return true;
+    int highestBranch = -1;
+    for (int row = 0; row < numRows; ++row)
+        highestBranch = juce::jmax(highestBranch, rowBranch[(size_t)row]);
+    if (highestBranch < 1)
+        return branches;
+
+    for (int row = 0; row < numRows; ++row)
+        if (rowBranch[(size_t)row] >= 0)
+            for (int col = 0; col < numCols; ++col)
+                branches[(size_t)(row * numCols + col)] = 1 + rowBranch[(size_t)row];
+    return branches;
 }
 
-std::unique_ptr<juce::AudioProcessor> ModularMultiFxAudioProcessor::createProcessorForChoice(int choice, int slotIndex)
+// Oversampling factor each slot runs at in the serial chain. A slot is oversampled when its mode
+// is On, or in Auto when its module is nonlinear. Empty slots between two oversampled slots join
+// their domain, so the chain does not drop back to the host rate just to pass audio through.
+// Domains never cross from one parallel branch into another.
+std::array<int, ModularMultiFxAudioProcessor::maxSlots> ModularMultiFxAudioProcessor::computeSlotOversampling(const std::array<int, maxSlots>& layout, const std::array<int, maxSlots>& branches, OversamplingRate rate) const
 {
-    switch (choice)
+    std::array<int, maxSlots> factors;
+    factors.fill(1);
+
+    const int factor = 1 << (int)rate; // x1, x2, x4, x8, x16
+    if (factor <= 1) return factors;
+
+    int runEnd = -1; // Last oversampled slot of the current run; -1 after a host-rate module
+    for (int i = 0; i < maxSlots; ++i)
     {
-    case 1:  return std::make_unique<DistortionProcessor>(apvts, slotIndex);
-    case 2:  return std::make_unique<FilterProcessor>(apvts, slotIndex);
-    case 3:  return std::make_unique<ModulationProcessor>(apvts, slotIndex);
-    case 4:  return std::make_unique<AdvancedDelayProcessor>(apvts, slotIndex);
-    case 5:  return std::make_unique<ReverbProcessor>(apvts, slotIndex);
-    case 6:  return std::make_unique<AdvancedCompressorProcessor>(apvts, slotIndex);
-    case 7:  return std::make_unique<ChromaTapeProcessor>(apvts, slotIndex);
-    case 8:  return std::make_unique<MorphoCompProcessor>(apvts, slotIndex);
-    case 9:  return std::make_unique<PhysicalResonatorProcessor>(apvts, slotIndex);
-    case 10: return std::make_unique<SpectralAnimatorProcessor>(apvts, slotIndex);
-    case 11: return std::make_unique<HelicalDelayProcessor>(apvts, slotIndex);
-    case 12: return std::make_unique<ChronoVerbProcessor>(apvts, slotIndex);
-    case 13: return std::make_unique<TectonicDelayProcessor>(apvts, slotIndex);
-    default: return nullptr;
+        if (i > 0 && branches[(size_t)i] != branches[(size_t)(i - 1)])
+            runEnd = -1;
+
+        const int choice = layout[(size_t)i];
+        if (choice == 0) continue;
+
+        bool oversample = false;
+        switch (slotOSModeParams[(size_t)i].getChoice<SlotOversamplingMode>())
+        {
+        case SlotOversamplingMode::Auto: oversample = HostedModule::benefitsFromOversampling(choice); break;
+        case SlotOversamplingMode::Off:  oversample = false; break;
+        case SlotOversamplingMode::On:   oversample = true; break;
+        }
+
+        if (!oversample)
+        {
+            runEnd = -1;
+            continue;
+        }
+        for (int j = runEnd >= 0 ? runEnd + 1 : i; j <= i; ++j)
+            factors[(size_t)j] = factor;
+        runEnd = i;
     }
+    return factors;
 }
 
 void ModularMultiFxAudioProcessor::parameterChanged(const juce::String& parameterID, float newValue)
 {
     if (parameterID.endsWith("_CHOICE") && parameterID.startsWith("SLOT_"))
     {
-        isGraphDirty.store(true);
+        isSlotLayoutDirty.store(true);
         editorResizeBroadcaster.sendChangeMessage();
     }
+    else if (parameterID.endsWith("_OS_MODE") && parameterID.startsWith("SLOT_"))
+    {
+        // updateSlots() falls back to a full rebuild if the domains actually change.
+        isSlotLayoutDirty.store(true);
+    }
+    else if (parameterID.endsWith("_SEED") && parameterID.startsWith("SLOT_"))
+    {
+        // Seeds are only read when modules are prepared; they do nothing unless deterministic.
+        if (deterministicSeedsParam.isOn())
+            isGraphDirty.store(true);
+    }
+    else if (parameterID == "ROUTING" || parameterID == "ROUTING_MERGE" || parameterID == "PIPELINE_STAGES"
+             || parameterID == "SPECTRAL_ASYNC" || parameterID == "DETERMINISTIC_SEEDS")
+    {
+        isGraphDirty.store(true);
+    }
     if (parameterID == "OVERSAMPLING_ALGO")
         pendingOSAlgo.store(static_cast<OversamplingAlgorithm>((int)newValue));
     else if (parameterID == "OVERSAMPLING_RATE")
@@ -673,13 +1135,11 @@ void ModularMultiFxAudioProcessor::parameterChanged(const juce::String& paramete
 
 void ModularMultiFxAudioProcessor::updateSmartAutoGainParameters()
 {
-    if (auto* pEnable = apvts.getRawParameterValue("SAG_ENABLE"))
-        smartAutoGain.setEnabled(pEnable->load() > 0.5f);
-    if (auto* pResp = apvts.getRawParameterValue("SAG_RESPONSE"))
-        smartAutoGain.setResponseTime(pResp->load());
+    smartAutoGain.setEnabled(sagEnableParam.isOn());
+    smartAutoGain.setResponseTime(sagResponseParam.get());
 }
 
-std::unique_ptr<juce::dsp::Oversampling<float>> ModularMultiFxAudioProcessor::createOversamplingEngine(OversamplingRate rate, OversamplingAlgorithm algo, int numChannels)
+std::unique_ptr<HalfBandOversampler> ModularMultiFxAudioProcessor::createOversamplingEngine(OversamplingRate rate, OversamplingAlgorithm algo, int numChannels)
 {
     if (numChannels <= 0 || rate == OversamplingRate::x1) return nullptr;
     int stages = 0;
@@ -691,22 +1151,32 @@ std::unique_ptr<juce::dsp::Oversampling<float>> ModularMultiFxAudioProcessor::cr
     case OversamplingRate::x16: stages = 4; break;
     default: return nullptr;
     }
-    juce::dsp::Oversampling<float>::FilterType fType;
-    bool linearPhase = true;
+    // FIR specs: { transition width relative to the stage input rate, stopband attenuation in dB }.
+    // Later stages only have to protect the band below the host Nyquist, so they can be short.
     switch (algo)
     {
-    case OversamplingAlgorithm::Live: fType = juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR; linearPhase = false; break;
+    case OversamplingAlgorithm::Live:
+        return std::make_unique<HalfBandOversampler>(numChannels, stages);
     case OversamplingAlgorithm::HQ:
-    case OversamplingAlgorithm::Deluxe: fType = juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple; linearPhase = true; break;
+        return std::make_unique<HalfBandOversampler>(numChannels, stages, HalfBandOversampler::FIRSpec{ 0.12f, 90.0f }, HalfBandOversampler::FIRSpec{ 0.40f, 90.0f });
+    case OversamplingAlgorithm::Deluxe:
+        return std::make_unique<HalfBandOversampler>(numChannels, stages, HalfBandOversampler::FIRSpec{ 0.05f, 130.0f }, HalfBandOversampler::FIRSpec{ 0.30f, 120.0f });
     }
-    return std::make_unique<juce::dsp::Oversampling<float>>((size_t)numChannels, stages, fType, linearPhase);
+    return nullptr;
+}
+
+void ModularMultiFxAudioProcessor::setUseGraphEngine(bool shouldUseGraph)
+{
+    if (useGraphEngine.exchange(shouldUseGraph) != shouldUseGraph)
+        isGraphDirty.store(true);
 }
 
 void ModularMultiFxAudioProcessor::setVisibleSlotCount(int n)
 {
     int clamped = juce::jlimit(0, maxSlots, n);
-    if (clamped == visibleSlotCountInt) return;
-    visibleSlotCountInt = clamped;
+    if (clamped == visibleSlotCountInt.load()) return;
+    visibleSlotCountInt.store(clamped);
+    isSlotLayoutDirty.store(true);
 
     // This value object is now just for state saving/loading.
     // The UI will query getVisibleSlotCount().
@@ -717,9 +1187,9 @@ void ModularMultiFxAudioProcessor::setVisibleSlotCount(int n)
 
 double ModularMultiFxAudioProcessor::getTailLengthSeconds() const
 {
-    if (activeContext && activeContext->graph)
+    if (activeContext)
     {
-        double tail = activeContext->graph->getTailLengthSeconds();
+        double tail = activeContext->getTailLengthSeconds();
         if (activeContext->oversampler && activeContext->oversampler->getOversamplingFactor() > 1)
         {
             tail /= activeContext->oversampler->getOversamplingFactor();
@@ -6,6 +6,17 @@
 #include <juce_dsp/juce_dsp.h>
 #include "SmartAutoGain.h"
 #include "Presets/PresetManager.h"
+#include "SerialChainEngine.h"
+#include "ParameterHandle.h"
+#include "TraceRecorder.h"
+#include "RealtimeGuard.h"
+#include <array>
+#include <atomic>
+
+// Set to 1 to run the slot chain through juce::AudioProcessorGraph instead of SerialChainEngine.
+#ifndef TESSERA_USE_GRAPH_ENGINE
+#define TESSERA_USE_GRAPH_ENGINE 0
+#endif
 
 #if JucePlugin_Build_VST3
 #define JucePlugin_Vst3Category "Fx"
@@ -15,8 +26,35 @@
 enum class OversamplingAlgorithm
 {
     Live,    // Polyphase IIR (Fast, Non-Linear Phase)
-    HQ,      // FIR Equiripple (Standard, Linear Phase)
-    Deluxe   // FIR Equiripple (High Quality, Linear Phase)
+    HQ,      // Polyphase half-band FIR, 90 dB (Standard, Linear Phase)
+    Deluxe   // Polyphase half-band FIR, 130 dB, narrow transition (High Quality, Linear Phase)
+};
+
+// Per-slot oversampling: Auto oversamples only nonlinear modules, On/Off force it for the slot.
+// The rate and filter still come from OVERSAMPLING_RATE / OVERSAMPLING_ALGO.
+enum class SlotOversamplingMode
+{
+    Auto,
+    Off,
+    On
+};
+
+// Slot routing. Parallel modes run rows of four slots as branches that all get the same input and
+// are merged before the next serial row (or the output). The graph fallback always runs serially.
+enum class ChainRouting
+{
+    Serial,
+    ParallelRows,    // Every row is a branch
+    ParallelHalves,  // Rows 1-2 and rows 3-4 are two branches
+    ParallelRows12,  // Rows 1 and 2 in parallel, then rows 3-4 in series
+    ParallelRows123  // Rows 1, 2 and 3 in parallel, then row 4
+};
+
+// How the branches of a parallel section are combined.
+enum class BranchMerge
+{
+    Average, // Sum scaled by 1 / number of branches
+    Sum
 };
 
 // Defines the oversampling rates
@@ -31,10 +69,50 @@ enum class OversamplingRate
 
 // A wrapper to hold a processing graph and its associated oversampler and buffers.
 // This is crucial for seamless, cross-faded graph updates.
+// Contexts are built and destroyed on the ContextBuilder thread; the audio thread only adopts them.
 struct ProcessingContextWrapper {
-    std::unique_ptr<juce::AudioProcessorGraph> graph = std::make_unique<juce::AudioProcessorGraph>();
-    std::unique_ptr<juce::dsp::Oversampling<float>> oversampler;
-    juce::AudioBuffer<float> oversampledGraphBuffer; // Dedicated buffer for this context
+    // Exactly one of these runs the slot chain: the flat serial engine, or the graph fallback.
+    std::unique_ptr<SerialChainEngine> chain;
+    std::unique_ptr<juce::AudioProcessorGraph> graph;
+    std::unique_ptr<HalfBandOversampler> oversampler; // Graph fallback only; the chain oversamples per domain
+    std::vector<float*> oversampledChannels; // Channel view onto the oversampler's upsampled block
+    juce::MidiBuffer oversampledMidi;        // The block's MIDI at the oversampled rate; reserves SlotHostProcessor::midiReserveBytes
+
+    // Graph node management (owned per context so building never touches the live graph).
+    // Every slot has a permanent SlotHostProcessor; slot changes swap the module inside it.
+    juce::AudioProcessorGraph::Node::Ptr inputNode, outputNode, midiInputNode;
+    std::vector<juce::AudioProcessorGraph::Node::Ptr> slotNodes;
+    std::vector<SlotHostProcessor*> slotHosts;
+
+    // Builder-side record of what each host was last asked to run (effective choice, latency and
+    // the oversampling factor of its domain within the chain).
+    std::vector<int> slotChoices, slotLatencies, slotOSFactors;
+    std::vector<int> slotBranches; // See computeSlotBranches()
+    BranchMerge branchMerge = BranchMerge::Average;
+    int pipelineStages = 1; // Requested; the chain may use fewer
+    bool spectralAsync = false; // Modules read SPECTRAL_ASYNC when prepared, so a change needs new modules
+    bool deterministicSeeds = false; // Likewise DETERMINISTIC_SEEDS and the slot seeds (see SlotSeed)
+    std::vector<int> slotSeeds;
+    double graphSampleRate = 0.0;
+    int graphBlockSize = 0;
+    int numChannels = 0;
+    int latencySamples = 0;
+
+    // Configuration the context was built for, so the context pool can tell when it can be reused.
+    OversamplingAlgorithm osAlgo = OversamplingAlgorithm::HQ;
+    OversamplingRate osRate = OversamplingRate::x1;
+    double hostSampleRate = 0.0;
+    int hostBlockSize = 0;
+
+    void process(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
+    {
+        if (chain) chain->process(buffer, midi);
+        else if (graph) graph->processBlock(buffer, midi);
+    }
+    int getChainLatencySamples() const { return chain ? chain->getLatencySamples() : (graph ? graph->getLatencySamples() : 0); }
+    double getTailLengthSeconds() const { return chain ? chain->getTailLengthSeconds() : (graph ? graph->getTailLengthSeconds() : 0.0); }
+    void reset() { if (chain) chain->reset(); if (graph) graph->reset(); }
+    void releaseResources() { if (chain) chain->releaseResources(); if (graph) graph->releaseResources(); }
 };
 
 class ModularMultiFxAudioProcessor : public juce::AudioProcessor,
@@ -52,7 +130,7 @@ public:
     juce::AudioProcessorEditor* createEditor() override;
     bool hasEditor() const override { return true; }
     const juce::String getName() const override { return JucePlugin_Name; }
-    bool acceptsMidi() const override { return false; }
+    bool acceptsMidi() const override { return true; } // Reaches every slot; the resonator's strings play notes
     bool producesMidi() const override { return false; }
     double getTailLengthSeconds() const override;
     int getNumPrograms() override { return 1; }
@@ -66,12 +144,27 @@ public:
 
     bool isOversamplingLocked() const { return oversamplingLockActive.load(); }
 
+    // Diagnostics: slots currently skipped because their input has been silent past their tail.
+    int getNumSleepingSlots() const noexcept { return numSleepingSlots.load(std::memory_order_relaxed); }
+
+    // Diagnostics: per-slot share of the real-time budget and overrun attribution (any thread).
+    const SlotCpuMeter& getSlotCpuMeter() const noexcept { return cpuMeter; }
+    void resetSlotCpuMeter() noexcept { cpuMeter.resetStatistics(); }
+
+    // Timeline capture of audio-thread spans, written as Chrome trace JSON (message thread).
+    TraceRecorder& getTraceRecorder() noexcept { return *traceRecorder; }
+
+    // Switches between SerialChainEngine (default) and the AudioProcessorGraph fallback.
+    void setUseGraphEngine(bool shouldUseGraph);
+    bool isUsingGraphEngine() const noexcept { return useGraphEngine.load(); }
+
     std::unique_ptr<PresetManager> presetManager;
     PresetManager* getPresetManager() noexcept { return presetManager.get(); }
 
     static constexpr int maxSlots = 16;
+    static_assert(maxSlots == SerialChainEngine::numSlots, "SerialChainEngine must hold every slot");
 
-    int getVisibleSlotCount() const noexcept { return visibleSlotCountInt; }
+    int getVisibleSlotCount() const noexcept { return visibleSlotCountInt.load(); }
     void setVisibleSlotCount(int newCount);
 
     juce::ChangeBroadcaster editorResizeBroadcaster;
@@ -81,8 +174,25 @@ public:
     juce::AudioProcessorValueTreeState apvts{ *this, nullptr, "Parameters", createParameterLayout() };
 
 private:
-    // Authoritative state for visible slots
-    int visibleSlotCountInt = 8;
+    // Builds the next ProcessingContextWrapper off the audio thread whenever the graph is dirty,
+    // recycles contexts the audio thread has retired, and keeps the offline context pre-warmed.
+    class ContextBuilder : public juce::Thread
+    {
+    public:
+        explicit ContextBuilder(ModularMultiFxAudioProcessor& p) : juce::Thread("Tessera Context Builder"), owner(p) {}
+        void run() override;
+    private:
+        static constexpr int pollIntervalMs = 5;
+        ModularMultiFxAudioProcessor& owner;
+    };
+
+    // Pre-resolved handles for the parameters the processor reads itself (bound in the constructor)
+    std::array<ParameterHandle, maxSlots> slotChoiceParams, slotOSModeParams, slotSeedParams;
+    ParameterHandle masterMixParam, inputGainParam, outputGainParam, sagEnableParam, sagResponseParam;
+    ParameterHandle routingParam, branchMergeParam, pipelineStagesParam, spectralAsyncParam, deterministicSeedsParam;
+
+    // Authoritative state for visible slots (read by the builder thread)
+    std::atomic<int> visibleSlotCountInt{ 8 };
 
     double preparedSampleRate = 0.0;
     int preparedMaxBlockSize = 0;
@@ -94,6 +204,9 @@ private:
     std::atomic<OversamplingAlgorithm> effectiveOSAlgo;
     std::atomic<OversamplingRate> effectiveOSRate;
     std::atomic<bool> oversamplingLockActive{ false };
+    std::atomic<int> numSleepingSlots{ 0 };
+    SlotCpuMeter cpuMeter; // Outlives the contexts: every slot host holds a pointer to it
+    juce::SharedResourcePointer<TraceRecorder> traceRecorder; // Keeps the process-wide recorder alive
 
     SmartAutoGain smartAutoGain;
     juce::dsp::Gain<float> inputGainStage, outputGainStage;
@@ -110,22 +223,53 @@ private:
     int totalFadeSamples = 0;
     static constexpr double crossfadeDurationMs = 10.0;
 
-    // Graph node management
-    juce::AudioProcessorGraph::Node::Ptr inputNode, outputNode;
-    std::vector<juce::AudioProcessorGraph::Node::Ptr> fxSlotNodes;
-    std::atomic<bool> isGraphDirty{ true };
+    std::atomic<bool> isGraphDirty{ true };       // Full rebuild (OS config, channel count, prepare)
+    std::atomic<bool> isSlotLayoutDirty{ false }; // Slot choices only: diffed into the live context
+    std::atomic<bool> useGraphEngine{ TESSERA_USE_GRAPH_ENGINE != 0 };
+
+    // Lock-free hand-over between the builder and the audio thread.
+    // pendingContext: built and ready, waiting for the audio thread to adopt it.
+    // retiredContexts: faded out by the audio thread, waiting for the builder to destroy them.
+    std::atomic<ProcessingContextWrapper*> pendingContext{ nullptr };
+    static constexpr int retiredQueueSize = 8;
+    juce::AbstractFifo retiredFifo{ retiredQueueSize };
+    std::array<ProcessingContextWrapper*, retiredQueueSize> retiredContexts{};
+    juce::CriticalSection builderLock; // Serialises builds against prepareToPlay. The audio thread only try-locks it when offline.
+    ProcessingContextWrapper* latestContext = nullptr; // Most recently built context (pending or active). Guarded by builderLock.
+
+    // Prepared contexts for other oversampling configurations (guarded by builderLock).
+    static constexpr int contextPoolSize = 3;
+    std::vector<std::unique_ptr<ProcessingContextWrapper>> contextPool;
+    static constexpr OversamplingAlgorithm offlineOSAlgo = OversamplingAlgorithm::Deluxe;
+    static constexpr OversamplingRate offlineOSRate = OversamplingRate::x8;
+    ContextBuilder contextBuilder{ *this };
+
+    // Runs the branches of parallel sections on other cores (shared by every context).
+    ChainWorkerPool workerPool{ juce::jlimit(0, 3, juce::SystemStats::getNumCpus() - 1) };
 
     juce::AudioBuffer<float> dryBufferForMixing;
 
     // Private Helper Methods
-    bool updateGraph();
-    void initiateGraphUpdate();
+    bool updateGraph(ProcessingContextWrapper& ctx);
+    bool updateSlots(ProcessingContextWrapper& ctx);
+    std::array<int, maxSlots> computeSlotLayout() const;
+    std::array<int, maxSlots> computeSlotBranches() const;
+    std::array<int, maxSlots> computeSlotOversampling(const std::array<int, maxSlots>& layout, const std::array<int, maxSlots>& branches, OversamplingRate rate) const;
+    std::unique_ptr<ProcessingContextWrapper> buildContext(OversamplingAlgorithm algo, OversamplingRate rate);
+    std::unique_ptr<ProcessingContextWrapper> acquireContext();
+    void poolContext(std::unique_ptr<ProcessingContextWrapper> ctx);
+    void syncPooledContexts();
+    void prewarmOfflineContext();
+    bool isReusable(const ProcessingContextWrapper& ctx) const;
+    void publishContext(std::unique_ptr<ProcessingContextWrapper> ctx);
+    void adoptPendingContext();
+    bool retireContext(ProcessingContextWrapper* ctx);
+    void recycleRetiredContexts();
     void updateOversamplingConfiguration();
     bool checkForChromaTapeUsage() const;
-    std::unique_ptr<juce::AudioProcessor> createProcessorForChoice(int choice, int slotIndex);
     void updateSmartAutoGainParameters();
     void updateGainStages();
-    std::unique_ptr<juce::dsp::Oversampling<float>> createOversamplingEngine(OversamplingRate, OversamplingAlgorithm, int numChannels);
+    std::unique_ptr<HalfBandOversampler> createOversamplingEngine(OversamplingRate, OversamplingAlgorithm, int numChannels);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ModularMultiFxAudioProcessor)
 };
\ No newline at end of file
@@ -0,0 +1,241 @@
+//================================================================================
+// File: RealtimeGuard.cpp
+//================================================================================
+#include "RealtimeGuard.h"
+
+#if ! TESSERA_RT_GUARD
+
+int RealtimeGuard::getNumViolations() noexcept { return 0; }
+
+#else
+
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <set>
+
+// malloc and pthread_mutex_lock can only be wrapped where the real implementation is reachable
+// under another name. glibc exports both (__libc_malloc, __pthread_mutex_lock). Elsewhere only
+// operator new/delete are hooked.
+#if defined(__GLIBC__)
+ #include <pthread.h>
+ #define TESSERA_RT_GUARD_LIBC_HOOKS 1
+extern "C"
+{
+    void* __libc_malloc(size_t);
+    void* __libc_calloc(size_t, size_t);
+    void* __libc_realloc(void*, size_t);
+    void __libc_free(void*);
+    int __pthread_mutex_lock(pthread_mutex_t*);
+}
+#else
+ #define TESSERA_RT_GUARD_LIBC_HOOKS 0
+#endif
+
+// The hooks read these from inside malloc, so they must not be allocated lazily (initial-exec).
+#if defined(__GNUC__) || defined(__clang__)
+ #define TESSERA_RT_GUARD_TLS __attribute__((tls_model("initial-exec"))) thread_local
+#else
+ #define TESSERA_RT_GUARD_TLS thread_local
+#endif
+
+namespace
+{
+    TESSERA_RT_GUARD_TLS int realtimeDepth = 0;
+    TESSERA_RT_GUARD_TLS bool reporting = false;
+    std::atomic<int> numViolations{ 0 };
+
+    inline bool shouldReport() noexcept { return realtimeDepth > 0 && !reporting; }
+
+    void report(const char* what) noexcept
+    {
+        reporting = true; // Everything below allocates or locks
+        numViolations.fetch_add(1, std::memory_order_relaxed);
+
+        const auto stack = juce::SystemStats::getStackBacktrace();
+        static std::mutex seenLock;
+        static std::set<juce::String> seenStacks;
+        bool isNew = false;
+        {
+            const std::lock_guard<std::mutex> lock(seenLock);
+            isNew = seenStacks.insert(stack).second;
+        }
+
+        if (isNew)
+        {
+            juce::Logger::outputDebugString(juce::String("Tessera RT guard: ") + what + " on an audio thread\n" + stack);
+           #if TESSERA_RT_GUARD_ASSERT
+            jassertfalse;
+           #endif
+        }
+        reporting = false;
+    }
+
+    void* rawAllocate(std::size_t size) noexcept
+    {
+       #if TESSERA_RT_GUARD_LIBC_HOOKS
+        return __libc_malloc(size);
+       #else
+        return std::malloc(size);
+       #endif
+    }
+
+    void rawFree(void* p) noexcept
+    {
+       #if TESSERA_RT_GUARD_LIBC_HOOKS
+        __libc_free(p);
+       #else
+        std::free(p);
+       #endif
+    }
+
+    void* rawAlignedAllocate(std::size_t size, std::size_t alignment) noexcept
+    {
+       #if JUCE_WINDOWS
+        return _aligned_malloc(size, alignment);
+       #else
+        void* p = nullptr;
+        return posix_memalign(&p, juce::jmax(alignment, sizeof(void*)), size) == 0 ? p : nullptr;
+       #endif
+    }
+
+    void rawAlignedFree(void* p) noexcept
+    {
+       #if JUCE_WINDOWS
+        _aligned_free(p);
+       #else
+        rawFree(p);
+       #endif
+    }
+
+    void* allocate(std::size_t size, const char* what) noexcept
+    {
+        if (shouldReport()) report(what);
+        return rawAllocate(size != 0 ? size : 1);
+    }
+
+    void* allocateAligned(std::size_t size, std::align_val_t alignment, const char* what) noexcept
+    {
+        if (shouldReport()) report(what);
+        return rawAlignedAllocate(size != 0 ? size : 1, (std::size_t)alignment);
+    }
+
+    void release(void* p, const char* what) noexcept
+    {
+        if (p != nullptr && shouldReport()) report(what);
+        rawFree(p);
+    }
+
+    void releaseAligned(void* p, const char* what) noexcept
+    {
+        if (p != nullptr && shouldReport()) report(what);
+        rawAlignedFree(p);
+    }
+}
+
+//==============================================================================
+RealtimeGuard::ScopedRealtime::ScopedRealtime(bool isRealtime) noexcept
+    : active(isRealtime)
+{
+    if (active) ++realtimeDepth;
+}
+
+RealtimeGuard::ScopedRealtime::~ScopedRealtime() noexcept
+{
+    if (active) --realtimeDepth;
+}
+
+int RealtimeGuard::getNumViolations() noexcept
+{
+    return numViolations.load(std::memory_order_relaxed);
+}
+
+//==============================================================================
+// Global operator new/delete replacements
+void* operator new(std::size_t size)
+{
+    if (void* p = allocate(size, "operator new")) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    if (void* p = allocate(size, "operator new[]")) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return allocate(size, "operator new"); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return allocate(size, "operator new[]"); }
+
+void operator delete(void* p) noexcept { release(p, "operator delete"); }
+void operator delete[](void* p) noexcept { release(p, "operator delete[]"); }
+void operator delete(void* p, std::size_t) noexcept { release(p, "operator delete"); }
+void operator delete[](void* p, std::size_t) noexcept { release(p, "operator delete[]"); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { release(p, "operator delete"); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { release(p, "operator delete[]"); }
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    if (void* p = allocateAligned(size, alignment, "operator new")) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    if (void* p = allocateAligned(size, alignment, "operator new[]")) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocateAligned(size, alignment, "operator new"); }
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocateAligned(size, alignment, "operator new[]"); }
+
+void operator delete(void* p, std::align_val_t) noexcept { releaseAligned(p, "operator delete"); }
+void operator delete[](void* p, std::align_val_t) noexcept { releaseAligned(p, "operator delete[]"); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { releaseAligned(p, "operator delete"); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { releaseAligned(p, "operator delete[]"); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { releaseAligned(p, "operator delete"); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { releaseAligned(p, "operator delete[]"); }
+
+//==============================================================================
+// C allocation and mutex wrappers (glibc). Hidden, so in a plugin they catch the calls made by
+// the plugin's own code (JUCE included) without interposing on the host.
+#if TESSERA_RT_GUARD_LIBC_HOOKS
+#pragma GCC visibility push(hidden)
+extern "C"
+{
+    void* malloc(size_t size) __THROW
+    {
+        if (shouldReport()) report("malloc");
+        return __libc_malloc(size);
+    }
+
+    void* calloc(size_t count, size_t size) __THROW
+    {
+        if (shouldReport()) report("calloc");
+        return __libc_calloc(count, size);
+    }
+
+    void* realloc(void* p, size_t size) __THROW
+    {
+        if (shouldReport()) report("realloc");
+        return __libc_realloc(p, size);
+    }
+
+    void free(void* p) __THROW
+    {
+        if (p != nullptr && shouldReport()) report("free");
+        __libc_free(p);
+    }
+
+    // Try-locks are left alone: they never block, and the audio thread uses them on purpose.
+    int pthread_mutex_lock(pthread_mutex_t* mutex) __THROWNL
+    {
+        if (shouldReport()) report("pthread_mutex_lock");
+        return __pthread_mutex_lock(mutex);
+    }
+}
+#pragma GCC visibility pop
+#endif
+
+#endif // TESSERA_RT_GUARD
@@ -0,0 +1,53 @@
+//================================================================================
+// File: RealtimeGuard.h
+//================================================================================
+#pragma once
+#include <juce_core/juce_core.h>
+
+// Set to 1 (debug/test builds) to report allocations and lock acquisitions made while a thread is
+// doing audio work. Costs a thread-local check in every allocation, so leave it off for releases.
+#ifndef TESSERA_RT_GUARD
+#define TESSERA_RT_GUARD 0
+#endif
+
+// With the guard on, also stop in the debugger at the first report of each call stack.
+#ifndef TESSERA_RT_GUARD_ASSERT
+#define TESSERA_RT_GUARD_ASSERT 0
+#endif
+
+/**
+ * Real-time safety guard.
+ *
+ * A ScopedRealtime marks the current thread as doing audio work: processBlock, and the worker
+ * threads while they run jobs for it. With TESSERA_RT_GUARD on, the guard hooks the following
+ * while any thread is inside such a scope:
+ * - global operator new/delete, on every platform;
+ * - malloc/calloc/realloc/free (which juce::HeapBlock and AudioBuffer use), on glibc;
+ * - pthread_mutex_lock (juce::CriticalSection, std::mutex), on glibc. Try-locks are not hooked:
+ *   they never block, and the audio thread uses them on purpose.
+ *
+ * Each hooked call is reported with its call stack through juce::Logger::outputDebugString. A
+ * stack is reported once, however often it recurs. Reporting itself allocates, so the guard is
+ * suspended while it runs.
+ *
+ * With the guard off, ScopedRealtime is an empty object and nothing is hooked.
+ */
+struct RealtimeGuard
+{
+    class ScopedRealtime
+    {
+    public:
+#if TESSERA_RT_GUARD
+        explicit ScopedRealtime(bool isRealtime = true) noexcept;
+        ~ScopedRealtime() noexcept;
+    private:
+        const bool active;
+#else
+        explicit ScopedRealtime(bool = true) noexcept {}
+#endif
+        JUCE_DECLARE_NON_COPYABLE(ScopedRealtime)
+    };
+
+    // Number of hooked calls seen inside realtime scopes since the process started (0 when off).
+    static int getNumViolations() noexcept;
+};
@@ -0,0 +1,508 @@
+//================================================================================
+// File: SerialChainEngine.cpp
+//================================================================================
+#include "SerialChainEngine.h"
+#include "TraceRecorder.h"
+
+void SerialChainEngine::setSlot(int index, std::unique_ptr<SlotHostProcessor> host)
+{
+    jassert(juce::isPositiveAndBelow(index, numSlots));
+    slots[(size_t)index] = std::move(host);
+}
+
+void SerialChainEngine::addOversampledDomain(int firstSlot, int lastSlot, std::unique_ptr<HalfBandOversampler> oversampler)
+{
+    jassert(juce::isPositiveAndBelow(firstSlot, numSlots) && juce::isPositiveAndBelow(lastSlot, numSlots) && firstSlot <= lastSlot);
+    if (oversampler == nullptr) return;
+
+    for (auto& d : domains)
+        if (firstSlot <= d.lastSlot && d.firstSlot <= lastSlot)
+        {
+            jassertfalse; // Overlapping domains
+            return;
+        }
+
+    Domain domain;
+    domain.firstSlot = firstSlot;
+    domain.lastSlot = lastSlot;
+    domain.oversampler = std::move(oversampler);
+    domains.push_back(std::move(domain));
+    domainStartingAt[(size_t)firstSlot] = (int)domains.size();
+}
+
+void SerialChainEngine::addParallelSection(const std::vector<BranchRange>& branches, float mergeGain)
+{
+    if (branches.size() < 2) return;
+
+    for (size_t b = 0; b < branches.size(); ++b)
+    {
+        const auto& range = branches[b];
+        if (!juce::isPositiveAndBelow(range.firstSlot, numSlots) || !juce::isPositiveAndBelow(range.lastSlot, numSlots)
+            || range.firstSlot > range.lastSlot || (b > 0 && range.firstSlot != branches[b - 1].lastSlot + 1))
+        {
+            jassertfalse; // Branches must be contiguous slot ranges, in order
+            return;
+        }
+    }
+
+    Section section;
+    section.firstSlot = branches.front().firstSlot;
+    section.lastSlot = branches.back().lastSlot;
+    section.mergeGain = mergeGain;
+
+    for (auto& s : sections)
+        if (section.firstSlot <= s.lastSlot && s.firstSlot <= section.lastSlot)
+        {
+            jassertfalse; // Overlapping sections
+            return;
+        }
+
+    for (const auto& range : branches)
+    {
+        section.branches.emplace_back();
+        section.branches.back().firstSlot = range.firstSlot;
+        section.branches.back().lastSlot = range.lastSlot;
+    }
+
+    const int firstSlot = section.firstSlot;
+    sections.push_back(std::move(section));
+    sectionStartingAt[(size_t)firstSlot] = (int)sections.size();
+}
+
+int SerialChainEngine::getOversamplingFactor(int slotIndex) const noexcept
+{
+    for (auto& d : domains)
+        if (slotIndex >= d.firstSlot && slotIndex <= d.lastSlot)
+            return (int)d.oversampler->getOversamplingFactor();
+    return 1;
+}
+
+void SerialChainEngine::prepare(double sampleRate, int samplesPerBlock, int numChannels)
+{
+    for (auto& d : domains)
+    {
+        d.oversampler->initProcessing((size_t)samplesPerBlock);
+        d.oversampler->reset();
+        d.channels.assign((size_t)numChannels, nullptr);
+        d.midi.ensureSize(SlotHostProcessor::midiReserveBytes);
+    }
+
+    for (int i = 0; i < numSlots; ++i)
+    {
+        auto& host = slots[(size_t)i];
+        if (host == nullptr) continue;
+        const int factor = getOversamplingFactor(i);
+        host->setControlBlockSize(SlotHostProcessor::defaultControlBlockSize * factor);
+        host->setPlayConfigDetails(numChannels, numChannels, sampleRate * factor, samplesPerBlock * factor);
+        host->enableAllBuses();
+        host->prepareToPlay(sampleRate * factor, samplesPerBlock * factor);
+    }
+
+    // Branch buffers, and the delays that line every branch up with the section's longest one.
+    for (auto& section : sections)
+    {
+        const double longest = getSectionLatencySamples(section);
+        for (size_t b = 0; b < section.branches.size(); ++b)
+        {
+            auto& branch = section.branches[b];
+            branch.buffer.setSize(numChannels, b > 0 ? samplesPerBlock : 0);
+            branch.midi.ensureSize(SlotHostProcessor::midiReserveBytes);
+            branch.compensationSamples = juce::roundToInt(longest - getRangeLatencySamples(branch.firstSlot, branch.lastSlot));
+            branch.compensation.prepare({ sampleRate, (juce::uint32)samplesPerBlock, (juce::uint32)numChannels });
+            branch.compensation.setMaximumDelayInSamples(juce::jmax(1, branch.compensationSamples));
+            branch.compensation.setDelay((float)branch.compensationSamples);
+        }
+    }
+
+    buildPipeline(samplesPerBlock, numChannels);
+}
+
+void SerialChainEngine::buildPipeline(int samplesPerBlock, int numChannels)
+{
+    stages.clear();
+    pipelineDelay = 0;
+    pipelineWritePos = 0;
+    if (requestedPipelineStages < 2) return;
+
+    // Stages are cut between top-level items (a slot, an oversampled domain or a parallel
+    // section), balanced by the number of slots holding a module.
+    struct Item { int firstSlot, lastSlot, weight; };
+    std::vector<Item> items;
+    int totalWeight = 0;
+    for (int i = 0; i < numSlots; ++i)
+    {
+        int last = i;
+        if (const int s = sectionStartingAt[(size_t)i]; s > 0) last = sections[(size_t)(s - 1)].lastSlot;
+        else if (const int d = domainStartingAt[(size_t)i]; d > 0) last = domains[(size_t)(d - 1)].lastSlot;
+
+        int weight = 0;
+        for (int j = i; j <= last; ++j)
+            if (slots[(size_t)j] && slots[(size_t)j]->hasModule()) ++weight;
+        items.push_back({ i, last, weight });
+        totalWeight += weight;
+        i = last;
+    }
+
+    const int numStages = juce::jmin(requestedPipelineStages, totalWeight);
+    if (numStages < 2) return;
+
+    int accumulated = 0, stageFirst = 0;
+    for (size_t n = 0; n + 1 < items.size() && (int)stages.size() < numStages - 1; ++n)
+    {
+        accumulated += items[n].weight;
+        if (accumulated * numStages >= totalWeight * ((int)stages.size() + 1))
+        {
+            stages.emplace_back();
+            stages.back().firstSlot = stageFirst;
+            stages.back().lastSlot = items[n].lastSlot;
+            stageFirst = items[n].lastSlot + 1;
+        }
+    }
+    stages.emplace_back();
+    stages.back().firstSlot = stageFirst;
+    stages.back().lastSlot = numSlots - 1;
+
+    if (stages.size() < 2)
+    {
+        stages.clear();
+        return;
+    }
+
+    pipelineDelay = samplesPerBlock;
+    for (size_t k = 0; k < stages.size(); ++k)
+    {
+        auto& stage = stages[k];
+        stage.work.setSize(numChannels, k > 0 ? samplesPerBlock : 0);
+        stage.ring.setSize(numChannels, k + 1 < stages.size() ? 2 * pipelineDelay : 0);
+        stage.ring.clear();
+        stage.midi.ensureSize(SlotHostProcessor::midiReserveBytes);
+        stage.delayedMidi.ensureSize(SlotHostProcessor::midiReserveBytes);
+        stage.scratchMidi.ensureSize(SlotHostProcessor::midiReserveBytes);
+    }
+    pipelineMidiChunk.ensureSize(SlotHostProcessor::midiReserveBytes);
+    pipelineChannels.assign((size_t)numChannels, nullptr);
+}
+
+void SerialChainEngine::releaseResources()
+{
+    for (auto& host : slots)
+        if (host) host->releaseResources();
+}
+
+void SerialChainEngine::reset()
+{
+    for (auto& host : slots)
+        if (host) host->reset();
+    for (auto& d : domains)
+        d.oversampler->reset();
+    for (auto& section : sections)
+        for (auto& branch : section.branches)
+            branch.compensation.reset();
+    for (auto& stage : stages)
+    {
+        stage.ring.clear();
+        stage.delayedMidi.clear();
+    }
+    pipelineWritePos = 0;
+}
+
+void SerialChainEngine::process(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
+{
+    if (stages.empty())
+    {
+        processRange(0, numSlots - 1, buffer, midi, true);
+        return;
+    }
+
+    // Blocks longer than the prepared size would overrun the stage delay; run them in pieces.
+    const int numSamples = buffer.getNumSamples();
+    if (numSamples <= pipelineDelay)
+    {
+        processPipeline(buffer, midi);
+        return;
+    }
+
+    const int numChannels = juce::jmin(buffer.getNumChannels(), (int)pipelineChannels.size());
+    for (int start = 0; start < numSamples; start += pipelineDelay)
+    {
+        const int length = juce::jmin(pipelineDelay, numSamples - start);
+        for (int ch = 0; ch < numChannels; ++ch)
+            pipelineChannels[(size_t)ch] = buffer.getWritePointer(ch, start);
+        juce::AudioBuffer<float> piece(pipelineChannels.data(), numChannels, length);
+        pipelineMidiChunk.clear();
+        pipelineMidiChunk.addEvents(midi, start, length, -start);
+        processPipeline(piece, pipelineMidiChunk);
+    }
+}
+
+void SerialChainEngine::processRange(int firstSlot, int lastSlot, juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi, bool useWorkers)
+{
+    for (int i = firstSlot; i <= lastSlot; ++i)
+    {
+        if (const int s = sectionStartingAt[(size_t)i]; s > 0)
+        {
+            auto& section = sections[(size_t)(s - 1)];
+            processSection(section, buffer, midi, useWorkers);
+            i = section.lastSlot;
+        }
+        else
+        {
+            i = processSlot(i, buffer, midi);
+        }
+    }
+}
+
+// Runs one slot, or the whole oversampled domain starting at it. Returns the last slot it covered.
+int SerialChainEngine::processSlot(int slotIndex, juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
+{
+    // SlotHostProcessor is final, so these calls are resolved statically.
+    if (const int d = domainStartingAt[(size_t)slotIndex]; d > 0)
+    {
+        auto& domain = domains[(size_t)(d - 1)];
+        processDomain(domain, buffer, midi);
+        return domain.lastSlot;
+    }
+    if (auto& host = slots[(size_t)slotIndex])
+        host->processBlock(buffer, midi);
+    return slotIndex;
+}
+
+void SerialChainEngine::processDomain(Domain& domain, juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
+{
+    juce::dsp::AudioBlock<float> block(buffer);
+    juce::dsp::AudioBlock<float> upBlock;
+    {
+        TESSERA_TRACE_SCOPE("oversample up", "oversampling");
+        upBlock = domain.oversampler->processSamplesUp(block);
+    }
+
+    // The slots run directly on the oversampler's upsampled data through a non-owning view.
+    const int chans = juce::jmin((int)upBlock.getNumChannels(), (int)domain.channels.size());
+    for (int ch = 0; ch < chans; ++ch)
+        domain.channels[(size_t)ch] = upBlock.getChannelPointer((size_t)ch);
+    juce::AudioBuffer<float> domainBuf(domain.channels.data(), chans, (int)upBlock.getNumSamples());
+    SlotHostProcessor::scaleMidiPositions(midi, domain.midi, (int)domain.oversampler->getOversamplingFactor());
+
+    for (int i = domain.firstSlot; i <= domain.lastSlot; ++i)
+        if (auto& host = slots[(size_t)i])
+            host->processBlock(domainBuf, domain.midi);
+
+    TESSERA_TRACE_SCOPE("oversample down", "oversampling");
+    domain.oversampler->processSamplesDown(block);
+}
+
+void SerialChainEngine::processSection(Section& section, juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi, bool useWorkers)
+{
+    const int numSamples = buffer.getNumSamples();
+    const int numBranches = (int)section.branches.size();
+
+    // Every branch gets its own copy of the input (branch 0 keeps the chain buffer) and of the MIDI,
+    // so the branches share nothing while they run.
+    section.input = &buffer;
+    for (int b = 0; b < numBranches; ++b)
+    {
+        auto& branch = section.branches[(size_t)b];
+        if (b > 0)
+        {
+            jassert(branch.buffer.getNumSamples() >= numSamples);
+            for (int ch = 0; ch < juce::jmin(buffer.getNumChannels(), branch.buffer.getNumChannels()); ++ch)
+                branch.buffer.copyFrom(ch, 0, buffer, ch, 0, numSamples);
+        }
+        branch.midi.clear();
+        if (!midi.isEmpty())
+            branch.midi.addEvents(midi, 0, numSamples, 0);
+    }
+
+    auto job = [this, &section](int branchIndex) { processBranch(section, branchIndex); };
+    if (useWorkers && workerPool != nullptr)
+        workerPool->run(numBranches, job);
+    else
+        for (int b = 0; b < numBranches; ++b)
+            job(b);
+
+    // Deterministic join: always merged in branch order, whichever thread finished first.
+    for (int b = 1; b < numBranches; ++b)
+    {
+        const auto& branch = section.branches[(size_t)b];
+        for (int ch = 0; ch < juce::jmin(buffer.getNumChannels(), branch.buffer.getNumChannels()); ++ch)
+            buffer.addFrom(ch, 0, branch.buffer, ch, 0, numSamples);
+    }
+    if (section.mergeGain != 1.0f)
+        buffer.applyGain(0, numSamples, section.mergeGain);
+    section.input = nullptr;
+}
+
+void SerialChainEngine::processBranch(Section& section, int branchIndex)
+{
+    TESSERA_TRACE_SCOPE_VALUE("parallel branch", "chain", branchIndex);
+    auto& branch = section.branches[(size_t)branchIndex];
+    auto& input = *section.input;
+    const int numSamples = input.getNumSamples();
+
+    juce::AudioBuffer<float> view(branchIndex == 0 ? input.getArrayOfWritePointers() : branch.buffer.getArrayOfWritePointers(),
+                                  branchIndex == 0 ? input.getNumChannels() : branch.buffer.getNumChannels(), numSamples);
+
+    for (int i = branch.firstSlot; i <= branch.lastSlot; ++i)
+        i = processSlot(i, view, branch.midi);
+
+    if (branch.compensationSamples > 0)
+    {
+        juce::dsp::AudioBlock<float> block(view);
+        branch.compensation.process(juce::dsp::ProcessContextReplacing<float>(block));
+    }
+}
+
+// Stage k processes the block stage k-1 produced pipelineDelay samples ago, so all stages can run
+// at once: stage k-1 writes its ring at [pos, pos + n) while stage k reads [pos - delay, pos - delay + n).
+void SerialChainEngine::processPipeline(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
+{
+    const int numSamples = buffer.getNumSamples();
+    const int numStages = (int)stages.size();
+
+    // MIDI travels with the audio: events reach each stage one stage delay after the previous one.
+    stages[0].midi.clear();
+    stages[0].midi.addEvents(midi, 0, numSamples, 0);
+    for (int k = 1; k < numStages; ++k)
+    {
+        auto& previous = stages[(size_t)(k - 1)];
+        auto& stage = stages[(size_t)k];
+        stage.midi.clear();
+        stage.midi.addEvents(previous.delayedMidi, 0, numSamples, 0);
+        previous.scratchMidi.clear();
+        previous.scratchMidi.addEvents(previous.delayedMidi, numSamples, -1, -numSamples);
+        previous.delayedMidi.swapWith(previous.scratchMidi);
+        previous.delayedMidi.addEvents(previous.midi, 0, numSamples, pipelineDelay);
+    }
+
+    pipelineBlock = &buffer;
+    auto job = [this](int stageIndex) { processStage(stageIndex); };
+    if (workerPool != nullptr)
+        workerPool->run(numStages, job);
+    else
+        for (int k = 0; k < numStages; ++k)
+            job(k);
+    pipelineBlock = nullptr;
+
+    // The last stage's output is the chain's output.
+    const auto& last = stages.back();
+    for (int ch = 0; ch < juce::jmin(buffer.getNumChannels(), last.work.getNumChannels()); ++ch)
+        buffer.copyFrom(ch, 0, last.work, ch, 0, numSamples);
+
+    pipelineWritePos = (pipelineWritePos + numSamples) % (2 * pipelineDelay);
+}
+
+void SerialChainEngine::processStage(int stageIndex)
+{
+    TESSERA_TRACE_SCOPE_VALUE("pipeline stage", "chain", stageIndex);
+    auto& stage = stages[(size_t)stageIndex];
+    auto& block = *pipelineBlock;
+    const int numSamples = block.getNumSamples();
+    const int ringLength = 2 * pipelineDelay;
+
+    // Stage 0 works in place on the chain buffer; the others on what the previous stage left in its ring.
+    if (stageIndex > 0)
+    {
+        const auto& ring = stages[(size_t)(stageIndex - 1)].ring;
+        const int readPos = (pipelineWritePos - pipelineDelay + ringLength) % ringLength;
+        const int firstPart = juce::jmin(numSamples, ringLength - readPos);
+        for (int ch = 0; ch < juce::jmin(stage.work.getNumChannels(), ring.getNumChannels()); ++ch)
+        {
+            stage.work.copyFrom(ch, 0, ring, ch, readPos, firstPart);
+            if (firstPart < numSamples)
+                stage.work.copyFrom(ch, firstPart, ring, ch, 0, numSamples - firstPart);
+        }
+    }
+
+    juce::AudioBuffer<float> view(stageIndex == 0 ? block.getArrayOfWritePointers() : stage.work.getArrayOfWritePointers(),
+                                  stageIndex == 0 ? block.getNumChannels() : stage.work.getNumChannels(), numSamples);
+
+    // Parallel sections inside a stage run serially: the pool is busy with the stages.
+    processRange(stage.firstSlot, stage.lastSlot, view, stage.midi, false);
+
+    if (stageIndex + 1 < (int)stages.size())
+    {
+        const int firstPart = juce::jmin(numSamples, ringLength - pipelineWritePos);
+        for (int ch = 0; ch < juce::jmin(view.getNumChannels(), stage.ring.getNumChannels()); ++ch)
+        {
+            stage.ring.copyFrom(ch, pipelineWritePos, view, ch, 0, firstPart);
+            if (firstPart < numSamples)
+                stage.ring.copyFrom(ch, 0, view, ch, firstPart, numSamples - firstPart);
+        }
+    }
+}
+
+// Host-rate latency of a serial run of slots, including the oversamplers of the domains starting in it.
+double SerialChainEngine::getRangeLatencySamples(int firstSlot, int lastSlot) const
+{
+    double latency = 0.0;
+    for (int i = firstSlot; i <= lastSlot; ++i)
+        if (auto& host = slots[(size_t)i])
+            latency += (double)host->getLatencySamples() / getOversamplingFactor(i);
+    for (auto& d : domains)
+        if (d.firstSlot >= firstSlot && d.firstSlot <= lastSlot)
+            latency += (double)d.oversampler->getLatencyInSamples();
+    return latency;
+}
+
+double SerialChainEngine::getSectionLatencySamples(const Section& section) const
+{
+    double longest = 0.0;
+    for (auto& branch : section.branches)
+        longest = juce::jmax(longest, getRangeLatencySamples(branch.firstSlot, branch.lastSlot));
+    return longest;
+}
+
+int SerialChainEngine::getLatencySamples() const
+{
+    // Slot latencies are in their own domain's samples; convert everything to host-rate samples.
+    // A parallel section adds the latency of its longest branch (the others are padded to match).
+    double latency = 0.0;
+    for (int i = 0; i < numSlots; ++i)
+    {
+        if (const int s = sectionStartingAt[(size_t)i]; s > 0)
+        {
+            const auto& section = sections[(size_t)(s - 1)];
+            latency += std::round(getSectionLatencySamples(section));
+            i = section.lastSlot;
+        }
+        else
+        {
+            latency += getRangeLatencySamples(i, i);
+        }
+    }
+    if (stages.size() > 1)
+        latency += (double)((int)stages.size() - 1) * pipelineDelay;
+    return juce::roundToInt(latency);
+}
+
+double SerialChainEngine::getRangeTailLengthSeconds(int firstSlot, int lastSlot) const
+{
+    // Serial chain: each slot's tail rings on through the slots after it.
+    double tail = 0.0;
+    for (int i = firstSlot; i <= lastSlot; ++i)
+        if (auto& host = slots[(size_t)i])
+            tail += host->getTailLengthSeconds();
+    return tail;
+}
+
+double SerialChainEngine::getTailLengthSeconds() const
+{
+    double tail = 0.0;
+    for (int i = 0; i < numSlots; ++i)
+    {
+        if (const int s = sectionStartingAt[(size_t)i]; s > 0)
+        {
+            const auto& section = sections[(size_t)(s - 1)];
+            double longest = 0.0;
+            for (auto& branch : section.branches)
+                longest = juce::jmax(longest, getRangeTailLengthSeconds(branch.firstSlot, branch.lastSlot));
+            tail += longest;
+            i = section.lastSlot;
+        }
+        else
+        {
+            tail += getRangeTailLengthSeconds(i, i);
+        }
+    }
+    return tail;
+}
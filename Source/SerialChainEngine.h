@@ -0,0 +1,130 @@
+//================================================================================
+// File: SerialChainEngine.h
+//================================================================================
+#pragma once
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_dsp/juce_dsp.h>
+#include <array>
+#include <vector>
+#include "SlotHostProcessor.h"
+#include "DSP_Helpers/HalfBandOversampler.h"
+#include "ChainWorkerPool.h"
+
+/**
+ * Flat serial chain: input -> slot 1..N -> output, processed in place on one buffer.
+ * Replaces AudioProcessorGraph for the (strictly linear) slot chain, avoiding its render
+ * sequence, per-node buffer copies and virtual dispatch. The graph remains as a fallback.
+ *
+ * Runs of consecutive slots can be placed in an oversampled domain: the chain upsamples once
+ * on entry, runs those slots at the higher rate and downsamples on exit. Every other slot
+ * runs at the host rate.
+ *
+ * Runs of slots can also be split into parallel sections: each branch of a section gets the
+ * section's input, the branches run concurrently on a ChainWorkerPool, and their outputs are
+ * merged in branch order once all of them have finished. The result does not depend on which
+ * thread ran which branch. Shorter branches are delayed to match the section's longest one.
+ *
+ * Optionally the chain is pipelined: it is cut into stages that all run at once on the pool,
+ * each stage working on audio the previous stage finished one block earlier. Every stage
+ * boundary delays by exactly samplesPerBlock, whatever the host's actual block lengths.
+ */
+class SerialChainEngine
+{
+public:
+    static constexpr int numSlots = 16;
+
+    void setSlot(int index, std::unique_ptr<SlotHostProcessor> host);
+    SlotHostProcessor* getSlot(int index) const noexcept { return slots[(size_t)index].get(); }
+
+    // Runs slots firstSlot..lastSlot (inclusive) through the given oversampler.
+    // Domains must not overlap and must be added before prepare().
+    void addOversampledDomain(int firstSlot, int lastSlot, std::unique_ptr<HalfBandOversampler> oversampler);
+    int getOversamplingFactor(int slotIndex) const noexcept;
+
+    // Runs each branch (an inclusive slot range) from the section input and merges the outputs
+    // as sum * mergeGain. Branches must be contiguous and in order, and each oversampled domain
+    // must lie inside one branch. Must be added before prepare().
+    struct BranchRange { int firstSlot = 0, lastSlot = -1; };
+    void addParallelSection(const std::vector<BranchRange>& branches, float mergeGain);
+
+    // Pool the branches of parallel sections run on; without one they run one after another.
+    void setWorkerPool(ChainWorkerPool* pool) noexcept { workerPool = pool; }
+
+    // Cuts the chain into up to numStages pipeline stages of roughly equal active slot counts.
+    // Adds (stages - 1) * samplesPerBlock of latency. 1 disables pipelining. Set before prepare().
+    void setPipelineStages(int numStages) noexcept { requestedPipelineStages = juce::jmax(1, numStages); }
+    int getNumPipelineStages() const noexcept { return juce::jmax(1, (int)stages.size()); }
+
+    // sampleRate/samplesPerBlock are the host values; slots in a domain are prepared at the domain rate.
+    void prepare(double sampleRate, int samplesPerBlock, int numChannels);
+    void releaseResources();
+    void reset();
+    void process(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi);
+
+    // In host-rate samples, including the oversamplers' filter delay and the pipeline delay.
+    int getLatencySamples() const;
+    double getTailLengthSeconds() const;
+
+private:
+    struct Domain
+    {
+        int firstSlot = 0, lastSlot = -1;
+        std::unique_ptr<HalfBandOversampler> oversampler;
+        std::vector<float*> channels; // Points into the oversampler's own upsampled block
+        juce::MidiBuffer midi;        // The block's MIDI at the domain's rate; reserves SlotHostProcessor::midiReserveBytes
+    };
+
+    struct Branch
+    {
+        int firstSlot = 0, lastSlot = -1;
+        juce::AudioBuffer<float> buffer; // Copy of the section input; branch 0 runs in place instead
+        juce::MidiBuffer midi;
+        juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::None> compensation;
+        int compensationSamples = 0;
+    };
+
+    struct Section
+    {
+        int firstSlot = 0, lastSlot = -1;
+        float mergeGain = 1.0f;
+        std::vector<Branch> branches;
+        juce::AudioBuffer<float>* input = nullptr; // The chain buffer, while the section is processing
+    };
+
+    struct Stage
+    {
+        int firstSlot = 0, lastSlot = -1;
+        juce::AudioBuffer<float> work;   // The stage's input block, processed in place (stage 0 uses the chain buffer)
+        juce::AudioBuffer<float> ring;   // Output for the next stage, 2 * pipelineDelay long (unused by the last stage)
+        juce::MidiBuffer midi;           // MIDI for the block the stage processes now
+        juce::MidiBuffer delayedMidi;    // MIDI on its way to the next stage, relative to the current block
+        juce::MidiBuffer scratchMidi;
+    };
+
+    void processRange(int firstSlot, int lastSlot, juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi, bool useWorkers);
+    int processSlot(int slotIndex, juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi);
+    void processDomain(Domain& domain, juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi);
+    void processSection(Section& section, juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi, bool useWorkers);
+    void buildPipeline(int samplesPerBlock, int numChannels);
+    void processPipeline(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi);
+    void processStage(int stageIndex);
+    void processBranch(Section& section, int branchIndex);
+    double getRangeLatencySamples(int firstSlot, int lastSlot) const;
+    double getSectionLatencySamples(const Section& section) const;
+    double getRangeTailLengthSeconds(int firstSlot, int lastSlot) const;
+
+    std::array<std::unique_ptr<SlotHostProcessor>, numSlots> slots;
+    std::vector<Domain> domains;
+    std::array<int, numSlots> domainStartingAt{}; // Domain index + 1 for the first slot of each domain, else 0
+    std::vector<Section> sections;
+    std::array<int, numSlots> sectionStartingAt{}; // Section index + 1 for the first slot of each section, else 0
+    ChainWorkerPool* workerPool = nullptr;
+
+    std::vector<Stage> stages; // Empty unless pipelined
+    int requestedPipelineStages = 1;
+    int pipelineDelay = 0;     // Samples added per stage boundary (the prepared block size)
+    int pipelineWritePos = 0;  // Ring position of the current block
+    juce::AudioBuffer<float>* pipelineBlock = nullptr; // The current block, while the stages run
+    juce::MidiBuffer pipelineMidiChunk;
+    std::vector<float*> pipelineChannels;
+};
@@ -0,0 +1,129 @@
+//================================================================================
+// File: SlotCpuMeter.cpp
+//================================================================================
+#include "SlotCpuMeter.h"
+#include <cmath>
+
+SlotCpuMeter::SlotCpuMeter()
+    : ticksPerSecond((double)juce::Time::getHighResolutionTicksPerSecond())
+{
+}
+
+void SlotCpuMeter::prepare(double newSampleRate)
+{
+    sampleRate = newSampleRate > 0.0 ? newSampleRate : 44100.0;
+    windowSamples = (juce::int64)(sampleRate * worstCaseWindowSeconds);
+    samplesInWindow = 0;
+    clearStatistics();
+}
+
+void SlotCpuMeter::beginBlock() noexcept
+{
+    for (auto& slot : slots)
+        slot.blockTicks.store(0, std::memory_order_relaxed);
+}
+
+void SlotCpuMeter::addSlotTicks(int slotIndex, juce::int64 ticks) noexcept
+{
+    if (juce::isPositiveAndBelow(slotIndex, maxSlots))
+        slots[(size_t)slotIndex].blockTicks.fetch_add(ticks, std::memory_order_relaxed);
+}
+
+void SlotCpuMeter::endBlock(int numSamples, juce::int64 callbackTicks) noexcept
+{
+    if (resetRequested.exchange(false, std::memory_order_relaxed))
+        clearStatistics();
+    if (numSamples <= 0) return;
+
+    const double blockSeconds = (double)numSamples / sampleRate;
+    const double budgetTicks = blockSeconds * ticksPerSecond;
+    const float smoothing = (float)(1.0 - std::exp(-blockSeconds / averageTimeSeconds));
+    const double microsPerTick = 1.0e6 / ticksPerSecond;
+
+    // The worst case covers the current window plus the whole previous one, so it never drops
+    // to zero just because a window boundary was crossed.
+    samplesInWindow += numSamples;
+    const bool windowEnded = samplesInWindow >= windowSamples;
+    if (windowEnded)
+        samplesInWindow = 0;
+
+    int busiestSlot = -1;
+    juce::int64 busiestTicks = 0;
+
+    for (int i = 0; i < maxSlots; ++i)
+    {
+        auto& slot = slots[(size_t)i];
+        const auto ticks = slot.blockTicks.load(std::memory_order_relaxed);
+        const float load = (float)((double)ticks / budgetTicks);
+
+        slot.average += smoothing * (load - slot.average);
+        slot.averageMicros += smoothing * ((float)((double)ticks * microsPerTick) - slot.averageMicros);
+        slot.windowWorst = juce::jmax(slot.windowWorst, load);
+
+        slot.lastLoad.store(load, std::memory_order_relaxed);
+        slot.averageLoad.store(slot.average, std::memory_order_relaxed);
+        slot.averageMicroseconds.store(slot.averageMicros, std::memory_order_relaxed);
+        slot.worstLoad.store(juce::jmax(slot.windowWorst, slot.previousWindowWorst), std::memory_order_relaxed);
+
+        if (windowEnded)
+        {
+            slot.previousWindowWorst = slot.windowWorst;
+            slot.windowWorst = 0.0f;
+        }
+
+        if (ticks > busiestTicks)
+        {
+            busiestTicks = ticks;
+            busiestSlot = i;
+        }
+    }
+
+    const float load = (float)((double)callbackTicks / budgetTicks);
+    callbackWindowWorst = juce::jmax(callbackWindowWorst, load);
+    callbackLoad.store(load, std::memory_order_relaxed);
+    callbackWorstLoad.store(juce::jmax(callbackWindowWorst, callbackPreviousWindowWorst), std::memory_order_relaxed);
+    if (windowEnded)
+    {
+        callbackPreviousWindowWorst = callbackWindowWorst;
+        callbackWindowWorst = 0.0f;
+    }
+
+    if (load > 1.0f)
+    {
+        totalOverruns.fetch_add(1, std::memory_order_relaxed);
+        if (busiestSlot >= 0)
+            slots[(size_t)busiestSlot].overruns.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+SlotCpuMeter::SlotStats SlotCpuMeter::getSlotStats(int slotIndex) const noexcept
+{
+    SlotStats stats;
+    if (!juce::isPositiveAndBelow(slotIndex, maxSlots))
+        return stats;
+
+    const auto& slot = slots[(size_t)slotIndex];
+    stats.lastLoad = slot.lastLoad.load(std::memory_order_relaxed);
+    stats.averageLoad = slot.averageLoad.load(std::memory_order_relaxed);
+    stats.worstLoad = slot.worstLoad.load(std::memory_order_relaxed);
+    stats.averageMicroseconds = slot.averageMicroseconds.load(std::memory_order_relaxed);
+    stats.overruns = slot.overruns.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void SlotCpuMeter::clearStatistics() noexcept
+{
+    for (auto& slot : slots)
+    {
+        slot.average = slot.averageMicros = slot.windowWorst = slot.previousWindowWorst = 0.0f;
+        slot.lastLoad.store(0.0f, std::memory_order_relaxed);
+        slot.averageLoad.store(0.0f, std::memory_order_relaxed);
+        slot.worstLoad.store(0.0f, std::memory_order_relaxed);
+        slot.averageMicroseconds.store(0.0f, std::memory_order_relaxed);
+        slot.overruns.store(0, std::memory_order_relaxed);
+    }
+    callbackWindowWorst = callbackPreviousWindowWorst = 0.0f;
+    callbackLoad.store(0.0f, std::memory_order_relaxed);
+    callbackWorstLoad.store(0.0f, std::memory_order_relaxed);
+    totalOverruns.store(0, std::memory_order_relaxed);
+}
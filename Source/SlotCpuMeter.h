@@ -0,0 +1,103 @@
+//================================================================================
+// File: SlotCpuMeter.h
+//================================================================================
+#pragma once
+#include <juce_core/juce_core.h>
+#include <array>
+#include <atomic>
+
+/**
+ * Per-slot CPU usage, measured on the audio thread and readable from any thread.
+ *
+ * Each SlotHostProcessor times its processBlock() with a ScopedTimer. The processor brackets the
+ * whole callback with beginBlock()/endBlock(), which turns the slot times into a fraction of the
+ * block's real-time budget (block length / sample rate). It keeps a smoothed average, the worst
+ * block over the last couple of seconds, and overrun counts. A callback that takes longer than
+ * its budget is an overrun; it is charged to the slot that used the most time in that block.
+ *
+ * Writers only do relaxed atomic stores and one fetch_add per slot per block, and readers never
+ * block, so the meter stays on in release builds. Slots run by worker threads (parallel sections,
+ * pipeline stages) are timed on those threads; the pool's join orders them before endBlock().
+ */
+class SlotCpuMeter
+{
+public:
+    static constexpr int maxSlots = 16;
+
+    struct SlotStats
+    {
+        float lastLoad = 0.0f;    // Fraction of the budget used in the latest block
+        float averageLoad = 0.0f; // Smoothed over roughly averageTimeSeconds
+        float worstLoad = 0.0f;   // Worst block in the last one to two worst-case windows
+        float averageMicroseconds = 0.0f; // Smoothed time per callback
+        int overruns = 0;         // Overrunning callbacks charged to this slot
+    };
+
+    SlotCpuMeter();
+
+    // Not realtime safe; call from prepareToPlay.
+    void prepare(double sampleRate);
+
+    // Audio thread, around each callback. callbackTicks is the whole callback's duration in
+    // juce::Time high resolution ticks.
+    void beginBlock() noexcept;
+    void endBlock(int numSamples, juce::int64 callbackTicks) noexcept;
+
+    // Times one slot's processing for the current block. A null meter disables it.
+    class ScopedTimer
+    {
+    public:
+        ScopedTimer(SlotCpuMeter* m, int slotIndex) noexcept
+            : meter(m), slot(slotIndex), start(m != nullptr ? juce::Time::getHighResolutionTicks() : 0) {}
+        ~ScopedTimer() noexcept
+        {
+            if (meter != nullptr)
+                meter->addSlotTicks(slot, juce::Time::getHighResolutionTicks() - start);
+        }
+
+    private:
+        SlotCpuMeter* const meter;
+        const int slot;
+        const juce::int64 start;
+        JUCE_DECLARE_NON_COPYABLE(ScopedTimer)
+    };
+
+    // Any thread.
+    SlotStats getSlotStats(int slotIndex) const noexcept;
+    float getCallbackLoad() const noexcept { return callbackLoad.load(std::memory_order_relaxed); }
+    float getWorstCallbackLoad() const noexcept { return callbackWorstLoad.load(std::memory_order_relaxed); }
+    int getNumOverruns() const noexcept { return totalOverruns.load(std::memory_order_relaxed); }
+    // Clears the averages, worst cases and overrun counts on the next block.
+    void resetStatistics() noexcept { resetRequested.store(true, std::memory_order_relaxed); }
+
+private:
+    void addSlotTicks(int slotIndex, juce::int64 ticks) noexcept;
+    void clearStatistics() noexcept;
+
+    static constexpr double averageTimeSeconds = 0.3;
+    static constexpr double worstCaseWindowSeconds = 2.0;
+
+    struct Slot
+    {
+        std::atomic<juce::int64> blockTicks{ 0 }; // Accumulated by whichever thread ran the slot
+
+        // Audio thread only
+        float average = 0.0f, averageMicros = 0.0f, windowWorst = 0.0f, previousWindowWorst = 0.0f;
+
+        // Published
+        std::atomic<float> lastLoad{ 0.0f }, averageLoad{ 0.0f }, worstLoad{ 0.0f }, averageMicroseconds{ 0.0f };
+        std::atomic<int> overruns{ 0 };
+    };
+
+    std::array<Slot, maxSlots> slots;
+    const double ticksPerSecond;
+    double sampleRate = 44100.0;
+    juce::int64 windowSamples = 0, samplesInWindow = 0;
+
+    float callbackWindowWorst = 0.0f, callbackPreviousWindowWorst = 0.0f;
+    std::atomic<float> callbackLoad{ 0.0f }, callbackWorstLoad{ 0.0f };
+    std::atomic<int> totalOverruns{ 0 };
+    std::atomic<bool> resetRequested{ false };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SlotCpuMeter)
+};
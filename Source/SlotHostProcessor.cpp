@@ -0,0 +1,268 @@
+//================================================================================
+// File: SlotHostProcessor.cpp
+//================================================================================
+#include "SlotHostProcessor.h"
+#include "TraceRecorder.h"
+
+namespace
+{
+    // Trace span names must be literals.
+    const char* const slotTraceNames[] = { "Slot 1", "Slot 2", "Slot 3", "Slot 4", "Slot 5", "Slot 6", "Slot 7", "Slot 8",
+                                           "Slot 9", "Slot 10", "Slot 11", "Slot 12", "Slot 13", "Slot 14", "Slot 15", "Slot 16" };
+
+    bool isBelow(const juce::AudioBuffer<float>& buffer, int numSamples, float threshold)
+    {
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+            if (buffer.getMagnitude(ch, 0, numSamples) > threshold)
+                return false;
+        return true;
+    }
+}
+
+SlotHostProcessor::SlotHostProcessor(std::unique_ptr<HostedModule> initialModule)
+    : AudioProcessor(BusesProperties().withInput("Input", juce::AudioChannelSet::stereo(), true)
+        .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
+    current(initialModule != nullptr ? std::move(initialModule) : std::make_unique<HostedModule>())
+{
+}
+
+SlotHostProcessor::~SlotHostProcessor()
+{
+    delete pendingModule.exchange(nullptr);
+    destroyRetiredModules();
+}
+
+void SlotHostProcessor::prepareModule(HostedModule& module, int numChannels, double sampleRate, int samplesPerBlock)
+{
+    auto& processor = module.get();
+    processor.setPlayConfigDetails(numChannels, numChannels, sampleRate, samplesPerBlock);
+    processor.enableAllBuses();
+    processor.prepareToPlay(sampleRate, samplesPerBlock);
+}
+
+void SlotHostProcessor::scaleMidiPositions(const juce::MidiBuffer& source, juce::MidiBuffer& dest, int factor)
+{
+    dest.clear();
+    for (const auto metadata : source)
+        dest.addEvent(metadata.data, metadata.numBytes, metadata.samplePosition * factor);
+}
+
+void SlotHostProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
+{
+    int numChannels = juce::jmax(getTotalNumInputChannels(), getTotalNumOutputChannels());
+    prepareModule(*current, numChannels, sampleRate, samplesPerBlock);
+    if (outgoing) prepareModule(*outgoing, numChannels, sampleRate, samplesPerBlock);
+
+    fadeBuffer.setSize(numChannels, samplesPerBlock);
+    chunkChannels.assign((size_t)numChannels, nullptr);
+    chunkMidi.ensureSize(midiReserveBytes);
+    controlPhase = 0;
+    totalFadeSamples = juce::jmax(1, (int)(sampleRate * crossfadeDurationMs / 1000.0));
+    setLatencySamples(current->get().getLatencySamples());
+    updateSleepThreshold();
+}
+
+void SlotHostProcessor::updateSleepThreshold()
+{
+    sleeping.store(false, std::memory_order_relaxed);
+    silentSamples = 0;
+
+    const double tailSeconds = current->get().getTailLengthSeconds();
+    if (current->isEmpty() || !std::isfinite(tailSeconds) || getSampleRate() <= 0)
+        samplesBeforeSleep = -1;
+    else
+        samplesBeforeSleep = (juce::int64)(tailSeconds * getSampleRate()) + current->get().getLatencySamples();
+}
+
+void SlotHostProcessor::releaseResources()
+{
+    current->get().releaseResources();
+    if (outgoing) outgoing->get().releaseResources();
+}
+
+void SlotHostProcessor::reset()
+{
+    current->get().reset();
+    if (outgoing) outgoing->get().reset();
+    fadeSamplesRemaining = 0;
+    sleeping.store(false, std::memory_order_relaxed);
+    silentSamples = 0;
+    controlPhase = 0;
+}
+
+void SlotHostProcessor::requestModule(std::unique_ptr<HostedModule> module)
+{
+    if (module == nullptr)
+    {
+        module = std::make_unique<HostedModule>();
+        prepareModule(*module, juce::jmax(getTotalNumInputChannels(), getTotalNumOutputChannels()), getSampleRate(), getBlockSize());
+    }
+
+    delete pendingModule.exchange(module.release());
+}
+
+void SlotHostProcessor::settleWhileIdle()
+{
+    if (auto* ready = pendingModule.exchange(nullptr))
+    {
+        current->get().releaseResources();
+        current.reset(ready);
+    }
+    outgoing.reset();
+    fadeSamplesRemaining = 0;
+    destroyRetiredModules();
+    setLatencySamples(current->get().getLatencySamples());
+    updateSleepThreshold();
+}
+
+void SlotHostProcessor::destroyRetiredModules()
+{
+    const auto scope = retiredFifo.read(retiredFifo.getNumReady());
+    auto destroy = [this](int start, int size)
+        {
+            for (int i = start; i < start + size; ++i)
+            {
+                auto*& module = retiredModules[(size_t)i];
+                if (module) module->get().releaseResources();
+                delete module;
+                module = nullptr;
+            }
+        };
+    destroy(scope.startIndex1, scope.blockSize1);
+    destroy(scope.startIndex2, scope.blockSize2);
+}
+
+bool SlotHostProcessor::retireModule(HostedModule* module)
+{
+    if (module == nullptr) return true;
+
+    const auto scope = retiredFifo.write(1);
+    if (scope.blockSize1 + scope.blockSize2 == 0)
+        return false; // Queue full; keep ownership and retry on a later block.
+
+    retiredModules[(size_t)(scope.blockSize1 > 0 ? scope.startIndex1 : scope.startIndex2)] = module;
+    return true;
+}
+
+void SlotHostProcessor::adoptPendingModule()
+{
+    if (fadeSamplesRemaining > 0) return;
+
+    if (outgoing != nullptr)
+    {
+        if (!retireModule(outgoing.get())) return;
+        outgoing.release();
+    }
+
+    if (pendingModule.load(std::memory_order_relaxed) == nullptr) return;
+    auto* ready = pendingModule.exchange(nullptr);
+    if (ready == nullptr) return;
+
+    outgoing = std::move(current);
+    current.reset(ready);
+    fadeSamplesRemaining = totalFadeSamples;
+    updateSleepThreshold();
+}
+
+void SlotHostProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
+{
+    const SlotCpuMeter::ScopedTimer cpuTimer(cpuMeter, slotIndex);
+    TESSERA_TRACE_SCOPE(slotTraceNames[juce::jlimit(0, (int)std::size(slotTraceNames) - 1, slotIndex)], "slot");
+    juce::ScopedNoDenormals noDenormals;
+    for (auto ch = getTotalNumInputChannels(); ch < getTotalNumOutputChannels(); ++ch)
+        buffer.clear(ch, 0, buffer.getNumSamples());
+
+    adoptPendingModule();
+
+    const int numSamples = buffer.getNumSamples();
+    const int numChannels = juce::jmin(buffer.getNumChannels(), fadeBuffer.getNumChannels());
+
+    // The control grid keeps running while the module sleeps, so it stays tied to the timeline.
+    const int phase = controlPhase;
+    controlPhase = (controlPhase + numSamples) % controlBlockSize;
+
+    if (fadeBuffer.getNumSamples() < numSamples)
+        fadeSamplesRemaining = 0; // Oversized block: cut over rather than fade.
+
+    if (fadeSamplesRemaining <= 0 || outgoing == nullptr)
+    {
+        if (samplesBeforeSleep < 0)
+        {
+            processModule(*current, buffer, midi, phase);
+            return;
+        }
+
+        if (!midi.isEmpty() || !isBelow(buffer, numSamples, silenceThreshold)) // Notes wake it too
+        {
+            silentSamples = 0;
+            sleeping.store(false, std::memory_order_relaxed);
+        }
+        else if (sleeping.load(std::memory_order_relaxed))
+        {
+            buffer.clear(0, numSamples);
+            return;
+        }
+        else
+        {
+            silentSamples += numSamples;
+        }
+
+        processModule(*current, buffer, midi, phase);
+
+        if (silentSamples > samplesBeforeSleep && isBelow(buffer, numSamples, silenceThreshold))
+            sleeping.store(true, std::memory_order_relaxed);
+        return;
+    }
+
+    // Only this slot fades; its neighbours keep running untouched.
+    for (int ch = 0; ch < numChannels; ++ch)
+        fadeBuffer.copyFrom(ch, 0, buffer, ch, 0, numSamples);
+
+    juce::AudioBuffer<float> outgoingView(fadeBuffer.getArrayOfWritePointers(), numChannels, numSamples);
+    processModule(*outgoing, outgoingView, midi, phase);
+    processModule(*current, buffer, midi, phase);
+
+    int samplesToFade = juce::jmin(numSamples, fadeSamplesRemaining);
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        auto* out = buffer.getWritePointer(ch);
+        const auto* old = fadeBuffer.getReadPointer(ch);
+        for (int i = 0; i < samplesToFade; ++i)
+        {
+            float fade = (float)(totalFadeSamples - (fadeSamplesRemaining - i)) / (float)totalFadeSamples;
+            out[i] = old[i] * (1.0f - fade) + out[i] * fade;
+        }
+    }
+    fadeSamplesRemaining -= samplesToFade;
+
+    if (fadeSamplesRemaining <= 0 && retireModule(outgoing.get()))
+        outgoing.release();
+}
+
+// phase: how far into the current control block the buffer starts. The first chunk completes
+// that block; the rest follow the grid.
+void SlotHostProcessor::processModule(HostedModule& module, juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi, int phase)
+{
+    const int numSamples = buffer.getNumSamples();
+    if (phase + numSamples <= controlBlockSize)
+    {
+        module.process(buffer, midi);
+        return;
+    }
+
+    const int numChannels = juce::jmin(buffer.getNumChannels(), (int)chunkChannels.size());
+    auto* const* channels = buffer.getArrayOfWritePointers();
+
+    for (int start = 0, length = 0; start < numSamples; start += length, phase = 0)
+    {
+        length = juce::jmin(controlBlockSize - phase, numSamples - start);
+        for (int ch = 0; ch < numChannels; ++ch)
+            chunkChannels[(size_t)ch] = channels[ch] + start;
+        juce::AudioBuffer<float> chunk(chunkChannels.data(), numChannels, length);
+
+        chunkMidi.clear();
+        if (!midi.isEmpty())
+            chunkMidi.addEvents(midi, start, length, -start);
+        module.process(chunk, chunkMidi);
+    }
+}
@@ -0,0 +1,132 @@
+//================================================================================
+// File: SlotHostProcessor.h
+//================================================================================
+#pragma once
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <array>
+#include <atomic>
+#include <vector>
+#include "HostedModule.h"
+#include "SlotCpuMeter.h"
+
+/**
+ * Permanent home for one FX slot. Owns the slot's module and swaps it for a new one
+ * with a short local crossfade, so changing a slot never touches its neighbours.
+ * Runs either as a node in the fallback AudioProcessorGraph or directly in a SerialChainEngine.
+ *
+ * Threading: requestModule()/destroyRetiredModules() are called from the builder thread;
+ * processBlock() adopts the pending module and retires the outgoing one lock-free.
+ * An empty slot holds a pass-through module, so there is always something to fade to.
+ *
+ * Modules always see fixed control blocks: host buffers are cut on a grid of
+ * getControlBlockSize() samples that runs on across buffers, so control-block boundaries land
+ * on the same samples whatever buffer size the host uses. Output is only fully independent of
+ * the host buffer size when that size is a multiple of the control block (see
+ * defaultControlBlockSize).
+ */
+class SlotHostProcessor final : public juce::AudioProcessor
+{
+public:
+    explicit SlotHostProcessor(std::unique_ptr<HostedModule> initialModule);
+    ~SlotHostProcessor() override;
+
+    const juce::String getName() const override { return "SlotHost"; }
+    void prepareToPlay(double sampleRate, int samplesPerBlock) override;
+    void releaseResources() override;
+    void reset() override;
+    void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+
+    // Prepares a module for use inside a host running at the given configuration.
+    static void prepareModule(HostedModule& module, int numChannels, double sampleRate, int samplesPerBlock);
+
+    // Bytes every MIDI buffer filled on the audio thread reserves in prepare. A MidiBuffer event
+    // takes 6 header bytes plus its data, so this holds 2048 three-byte messages (notes, dense CC
+    // streams) per block. Blocks beyond it (or heavy in SysEx) still allocate, and the realtime
+    // guard reports it.
+    static constexpr int midiReserveBytes = 2048 * (6 + 3);
+
+    // Copies host-rate MIDI into dest with every position multiplied by factor, for buffers that
+    // run oversampled. It needs as many bytes as source holds; dest should reserve
+    // midiReserveBytes up front so this does not allocate.
+    static void scaleMidiPositions(const juce::MidiBuffer& source, juce::MidiBuffer& dest, int factor);
+
+    // Sub-block length the module is processed in. Call before prepareToPlay(); hosts in an
+    // oversampled domain scale it by the factor so control rate stays the same in host time.
+    // Limitation: there is no internal buffering (it would add a block of latency), so a control
+    // block that straddles two host buffers reaches the module as two calls whose lengths add up
+    // to one block. Per-call parameter reads then happen twice in that block, so output is
+    // block-size independent only for host buffer sizes that are multiples of this size.
+    static constexpr int defaultControlBlockSize = 32;
+    void setControlBlockSize(int numSamples) noexcept { controlBlockSize = juce::jmax(1, numSamples); }
+    int getControlBlockSize() const noexcept { return controlBlockSize; }
+
+    // Hands a prepared module (nullptr means an empty slot) to the audio thread.
+    // A previously requested module the audio thread never adopted is destroyed here.
+    void requestModule(std::unique_ptr<HostedModule> module);
+    void destroyRetiredModules();
+
+    // Times every processBlock() into the meter under this slot's index (which also labels the
+    // slot's spans in trace captures). Call before processing.
+    void setCpuMeter(SlotCpuMeter* meter, int index) noexcept { cpuMeter = meter; slotIndex = index; }
+
+    // False for an empty slot (pass-through module).
+    bool hasModule() const noexcept { return !current->isEmpty(); }
+
+    // True while the module is skipped because its input has been silent for longer than its tail.
+    bool isSleeping() const noexcept { return sleeping.load(std::memory_order_relaxed); }
+
+    // For hosts the audio thread is not processing (pooled contexts): adopt the requested module
+    // at once and drop any outgoing one, instead of crossfading on the next block.
+    void settleWhileIdle();
+
+    juce::AudioProcessorEditor* createEditor() override { return nullptr; }
+    bool hasEditor() const override { return false; }
+    double getTailLengthSeconds() const override { return current->get().getTailLengthSeconds(); }
+    bool acceptsMidi() const override { return true; } // Passed on to the module
+    bool producesMidi() const override { return false; }
+    int getNumPrograms() override { return 1; }
+    int getCurrentProgram() override { return 0; }
+    void setCurrentProgram(int) override {}
+    const juce::String getProgramName(int) override { return {}; }
+    void changeProgramName(int, const juce::String&) override {}
+    void getStateInformation(juce::MemoryBlock&) override {}
+    void setStateInformation(const void*, int) override {}
+
+private:
+    void adoptPendingModule();
+    bool retireModule(HostedModule* module);
+    void updateSleepThreshold();
+    void processModule(HostedModule& module, juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi, int phase);
+
+    std::unique_ptr<HostedModule> current, outgoing;
+    std::atomic<HostedModule*> pendingModule{ nullptr };
+
+    static constexpr int retiredQueueSize = 8;
+    juce::AbstractFifo retiredFifo{ retiredQueueSize };
+    std::array<HostedModule*, retiredQueueSize> retiredModules{};
+
+    // Local crossfade (old module -> new module)
+    juce::AudioBuffer<float> fadeBuffer;
+    int fadeSamplesRemaining = 0;
+    int totalFadeSamples = 1;
+    static constexpr double crossfadeDurationMs = 10.0;
+
+    // Fixed control-block processing (views into the host buffer, no copies)
+    int controlBlockSize = defaultControlBlockSize;
+    int controlPhase = 0; // Samples of the current control block already processed, carried across buffers
+    std::vector<float*> chunkChannels;
+    juce::MidiBuffer chunkMidi; // Reserves midiReserveBytes
+
+    // Sleep on silence: once the input has been below silenceThreshold for longer than the
+    // module's tail (plus latency) and its output has decayed too, processBlock skips the module.
+    // The module keeps its (decayed) state and resumes from it on the first block with sound or MIDI.
+    static constexpr float silenceThreshold = 1.0e-5f; // -100 dBFS
+    std::atomic<bool> sleeping{ false };
+    juce::int64 silentSamples = 0;
+    juce::int64 samplesBeforeSleep = -1; // -1: never sleeps (infinite tail)
+
+    SlotCpuMeter* cpuMeter = nullptr;
+    int slotIndex = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SlotHostProcessor)
+};
@@ -0,0 +1,55 @@
+//================================================================================
+// File: SlotSeed.h
+//================================================================================
+#pragma once
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "ParameterHandle.h"
+
+/**
+ * Seeds for a module's random sources (noise generators, grain and phase scatter, crackle).
+ *
+ * While DETERMINISTIC_SEEDS is on, the module reseeds every source from its slot's SLOT_n_SEED
+ * whenever it is reset, so every render of a session starts from the same state and two bounces
+ * null. Each source asks for its own stream number, so sources in one slot never share a
+ * sequence. While it is off, sources keep the free-running seeds they were constructed with.
+ *
+ * Both parameters are read when the module is prepared; the processor rebuilds the chain when
+ * either changes.
+ */
+class SlotSeed
+{
+public:
+    SlotSeed() = default;
+
+    SlotSeed(juce::AudioProcessorValueTreeState& apvts, int slotIndex)
+        : deterministicParam(apvts, "DETERMINISTIC_SEEDS"),
+          seedParam(apvts, "SLOT_" + juce::String(slotIndex + 1) + "_SEED")
+    {
+    }
+
+    // Latches the parameters. Call at the start of prepareToPlay().
+    void update() noexcept
+    {
+        deterministic = deterministicParam.isOn();
+        seed = (juce::uint32)seedParam.getIndex();
+    }
+
+    bool isDeterministic() const noexcept { return deterministic; }
+
+    // Seed for one source of the module.
+    juce::uint32 get(juce::uint32 stream) const noexcept { return mix(seed, stream); }
+
+    // SplitMix64 finaliser over (seed, stream): nearby seeds and streams give unrelated sequences.
+    static juce::uint32 mix(juce::uint32 seed, juce::uint32 stream) noexcept
+    {
+        auto z = (((juce::uint64)seed << 32) | stream) + 0x9e3779b97f4a7c15ull;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return (juce::uint32)(z ^ (z >> 31));
+    }
+
+private:
+    ParameterHandle deterministicParam, seedParam;
+    bool deterministic = false;
+    juce::uint32 seed = 0;
+};
@@ -0,0 +1,214 @@
+//================================================================================
+// File: TraceRecorder.cpp
+//================================================================================
+#include "TraceRecorder.h"
+#include <array>
+
+namespace
+{
+    // Set while a capture is running; the only thing a scope looks at when nothing is recorded.
+    std::atomic<TraceRecorder*> activeRecorder{ nullptr };
+
+    std::atomic<int> nextThreadIndex{ 0 };
+    std::array<std::atomic<const char*>, 64> threadNames{};
+}
+
+TraceRecorder::TraceRecorder()
+    : juce::Thread("Tessera Trace Writer"),
+      microsecondsPerTick(1.0e6 / (double)juce::Time::getHighResolutionTicksPerSecond())
+{
+    static_assert(maxThreads == (int)std::tuple_size<decltype(threadNames)>::value, "Thread name table size");
+}
+
+TraceRecorder::~TraceRecorder()
+{
+    stopCapture();
+}
+
+TraceRecorder* TraceRecorder::getActiveRecorder() noexcept
+{
+    return activeRecorder.load(std::memory_order_acquire);
+}
+
+TraceRecorder* TraceRecorder::enterScope() noexcept
+{
+    auto* recorder = getActiveRecorder();
+    if (recorder == nullptr)
+        return nullptr;
+
+    // Count first, then check the capture is still on: stopCapture() clears activeRecorder before
+    // it reads the count, so either it sees this scope or this scope sees the capture stopped.
+    recorder->openScopes.fetch_add(1, std::memory_order_seq_cst);
+    if (activeRecorder.load(std::memory_order_seq_cst) != recorder)
+    {
+        recorder->openScopes.fetch_sub(1, std::memory_order_release);
+        return nullptr;
+    }
+    return recorder;
+}
+
+int TraceRecorder::getCurrentThreadIndex() noexcept
+{
+    thread_local int index = nextThreadIndex.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+void TraceRecorder::nameCurrentThread(const char* name) noexcept
+{
+    const int index = getCurrentThreadIndex();
+    if (index < maxThreads)
+        threadNames[(size_t)index].store(name, std::memory_order_relaxed);
+}
+
+//==============================================================================
+bool TraceRecorder::startCapture(const juce::File& file)
+{
+    stopCapture();
+
+    if (events == nullptr)
+        events = std::make_unique<Event[]>((size_t)capacity);
+
+    file.getParentDirectory().createDirectory();
+    file.deleteFile();
+    stream = std::make_unique<juce::FileOutputStream>(file);
+    if (stream->failedToOpen())
+    {
+        stream.reset();
+        return false;
+    }
+
+    captureFile = file;
+    *stream << "[\n";
+    firstEventWritten = false;
+    captureStartTicks = juce::Time::getHighResolutionTicks();
+    readIndex = writeIndex.load(std::memory_order_acquire);
+    droppedEvents.store(0, std::memory_order_relaxed);
+
+    capturing.store(true, std::memory_order_relaxed);
+    activeRecorder.store(this, std::memory_order_release);
+    startThread(juce::Thread::Priority::low);
+    return true;
+}
+
+void TraceRecorder::stopCapture()
+{
+    if (!capturing.exchange(false))
+        return;
+
+    TraceRecorder* expected = this;
+    activeRecorder.compare_exchange_strong(expected, nullptr, std::memory_order_seq_cst);
+
+    // Wait for the scopes that were already open to record their spans, then write what is left.
+    while (openScopes.load(std::memory_order_seq_cst) > 0)
+        juce::Thread::sleep(1);
+    stopThread(2000);
+    drain();
+    finishFile();
+}
+
+//==============================================================================
+void TraceRecorder::record(const char* name, const char* category, juce::int64 start, juce::int64 duration, int value) noexcept
+{
+    const auto index = writeIndex.fetch_add(1, std::memory_order_relaxed);
+    auto& event = events[(size_t)(index & (juce::uint32)(capacity - 1))];
+
+    // Seqlock-style publish: the reader rejects the entry unless the sequence is the same before
+    // and after it copies the fields.
+    event.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    event.name = name;
+    event.category = category;
+    event.start = start;
+    event.duration = duration;
+    event.thread = getCurrentThreadIndex();
+    event.value = value;
+    event.sequence.store(index + 1, std::memory_order_release);
+}
+
+void TraceRecorder::run()
+{
+    while (!threadShouldExit())
+    {
+        drain();
+        wait(20);
+    }
+}
+
+void TraceRecorder::drain()
+{
+    if (stream == nullptr || events == nullptr) return;
+
+    const auto end = writeIndex.load(std::memory_order_acquire);
+    if (end - readIndex > (juce::uint32)capacity)
+    {
+        droppedEvents.fetch_add(end - readIndex - (juce::uint32)capacity, std::memory_order_relaxed);
+        readIndex = end - (juce::uint32)capacity;
+    }
+
+    juce::String text;
+    while (readIndex != end)
+    {
+        const auto& event = events[(size_t)(readIndex & (juce::uint32)(capacity - 1))];
+        const auto sequence = event.sequence.load(std::memory_order_acquire);
+
+        // 0 while being written. An entry claimed but not yet started still holds the previous
+        // lap's sequence, behind this one (compared mod 2^32). Either way, pick it up next pass.
+        const auto lead = (juce::int32)(sequence - (readIndex + 1));
+        if (sequence == 0 || lead < 0)
+            break;
+
+        const char* name = event.name;
+        const char* category = event.category;
+        const auto start = event.start;
+        const auto duration = event.duration;
+        const int thread = event.thread;
+        const int value = event.value;
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (lead > 0 || event.sequence.load(std::memory_order_relaxed) != sequence)
+        {
+            droppedEvents.fetch_add(1, std::memory_order_relaxed); // Overwritten by a lapping writer
+            ++readIndex;
+            continue;
+        }
+        ++readIndex;
+
+        if (start < captureStartTicks)
+            continue; // Opened before this capture started
+
+        text << (firstEventWritten ? ",\n" : "")
+             << "{\"name\":\"" << name << "\",\"cat\":\"" << category << "\",\"ph\":\"X\""
+             << ",\"ts\":" << juce::String((double)(start - captureStartTicks) * microsecondsPerTick, 3)
+             << ",\"dur\":" << juce::String((double)duration * microsecondsPerTick, 3)
+             << ",\"pid\":1,\"tid\":" << thread;
+        if (value >= 0)
+            text << ",\"args\":{\"value\":" << value << "}";
+        text << "}";
+        firstEventWritten = true;
+    }
+
+    if (text.isNotEmpty())
+        *stream << text;
+}
+
+void TraceRecorder::finishFile()
+{
+    if (stream == nullptr) return;
+
+    juce::String text;
+    text << (firstEventWritten ? ",\n" : "")
+         << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Tessera\"}}";
+
+    const int numThreads = juce::jmin(maxThreads, nextThreadIndex.load());
+    for (int i = 0; i < numThreads; ++i)
+        if (const char* name = threadNames[(size_t)i].load(std::memory_order_relaxed))
+            text << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << i
+                 << ",\"args\":{\"name\":\"" << name << "\"}}";
+
+    text << ",\n{\"name\":\"dropped_events\",\"ph\":\"M\",\"pid\":1,\"args\":{\"count\":"
+         << (int)droppedEvents.load() << "}}\n]\n";
+
+    *stream << text;
+    stream->flush();
+    stream.reset();
+}
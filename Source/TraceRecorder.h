@@ -0,0 +1,106 @@
+//================================================================================
+// File: TraceRecorder.h
+//================================================================================
+#pragma once
+#include <juce_core/juce_core.h>
+#include <atomic>
+#include <memory>
+
+/**
+ * Capture of timestamped spans from the audio thread and its helpers, written out as Chrome
+ * trace-event JSON (open in chrome://tracing or ui.perfetto.dev).
+ *
+ * Code marks a span with TESSERA_TRACE_SCOPE("name", "category"). Names and categories must be
+ * string literals: only the pointers are stored. While no capture runs a scope costs one atomic
+ * load. While capturing, the span is written into a preallocated ring: one fetch_add to claim an
+ * entry, then plain stores published through a sequence number. No locks and no allocation.
+ * Open scopes are counted, so stopping a capture waits for every span already open to be written.
+ * A background thread drains the ring to the file. If it falls a whole ring behind, the oldest
+ * spans are dropped and counted.
+ *
+ * There is one recorder per process, shared through juce::SharedResourcePointer. Spans are only
+ * recorded while some object holds it, which the processor and the editor always do.
+ */
+class TraceRecorder : private juce::Thread
+{
+public:
+    TraceRecorder();
+    ~TraceRecorder() override;
+
+    // Message thread. Starting a capture while one is running restarts it into the new file.
+    bool startCapture(const juce::File& file);
+    void stopCapture();
+    bool isCapturing() const noexcept { return capturing.load(std::memory_order_relaxed); }
+    juce::File getCaptureFile() const { return captureFile; }
+    int getNumDroppedEvents() const noexcept { return (int)droppedEvents.load(std::memory_order_relaxed); }
+
+    // Gives the calling thread a name in the trace. Realtime safe; the name must be a literal.
+    static void nameCurrentThread(const char* name) noexcept;
+
+    class Scope
+    {
+    public:
+        Scope(const char* spanName, const char* spanCategory, int spanValue = -1) noexcept
+            : recorder(enterScope()), name(spanName), category(spanCategory), value(spanValue),
+              start(recorder != nullptr ? juce::Time::getHighResolutionTicks() : 0) {}
+
+        ~Scope() noexcept
+        {
+            if (recorder != nullptr)
+            {
+                recorder->record(name, category, start, juce::Time::getHighResolutionTicks() - start, value);
+                recorder->openScopes.fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+    private:
+        TraceRecorder* const recorder;
+        const char* const name;
+        const char* const category;
+        const int value;
+        const juce::int64 start;
+        JUCE_DECLARE_NON_COPYABLE(Scope)
+    };
+
+private:
+    struct Event
+    {
+        std::atomic<juce::uint32> sequence{ 0 }; // Index + 1 once the entry is complete, 0 while written
+        const char* name = nullptr;
+        const char* category = nullptr;
+        juce::int64 start = 0, duration = 0;
+        int thread = 0;
+        int value = -1;
+    };
+
+    static constexpr int capacity = 1 << 16; // Power of two
+    static constexpr int maxThreads = 64;
+
+    static TraceRecorder* getActiveRecorder() noexcept;
+    static TraceRecorder* enterScope() noexcept; // The active recorder, with the scope counted, or nullptr
+    static int getCurrentThreadIndex() noexcept;
+    void record(const char* name, const char* category, juce::int64 start, juce::int64 duration, int value) noexcept;
+    void run() override;
+    void drain();
+    void finishFile();
+
+    std::unique_ptr<Event[]> events; // Allocated once, on the first capture
+    std::atomic<juce::uint32> writeIndex{ 0 };
+    juce::uint32 readIndex = 0;      // Writer thread only
+    std::atomic<bool> capturing{ false };
+    std::atomic<juce::uint32> droppedEvents{ 0 };
+    std::atomic<int> openScopes{ 0 }; // Scopes that will still record into this capture
+
+    juce::File captureFile;
+    std::unique_ptr<juce::FileOutputStream> stream;
+    juce::int64 captureStartTicks = 0;
+    double microsecondsPerTick = 1.0;
+    bool firstEventWritten = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TraceRecorder)
+};
+
+#define TESSERA_TRACE_SCOPE(name, category) \
+    const TraceRecorder::Scope JUCE_JOIN_MACRO(traceScope_, __LINE__)(name, category)
+#define TESSERA_TRACE_SCOPE_VALUE(name, category, value) \
+    const TraceRecorder::Scope JUCE_JOIN_MACRO(traceScope_, __LINE__)(name, category, value)
@@ -12,6 +12,29 @@ ModuleHeader::ModuleHeader()
 
     addAndMakeVisible(deleteButton);
     deleteButton.onClick = [this] { if (onDeleteClicked) onDeleteClicked(); };
+
+    addAndMakeVisible(osModeBox);
+    osModeBox.setTooltip("Oversampling for this slot. Auto oversamples nonlinear modules only.");
+
+    addAndMakeVisible(cpuLabel);
+    cpuLabel.setJustificationType(juce::Justification::centredRight);
+    cpuLabel.setFont(juce::FontOptions(11.0f));
+}
+
+void ModuleHeader::setCpuStats(const SlotCpuMeter::SlotStats& stats)
+{
+    const auto text = juce::String(stats.averageLoad * 100.0f, 1) + "%";
+    if (cpuLabel.getText() != text)
+        cpuLabel.setText(text, juce::dontSendNotification);
+
+    cpuLabel.setTooltip("CPU: " + juce::String(stats.averageLoad * 100.0f, 1) + "% of the real-time budget ("
+                        + juce::String(stats.averageMicroseconds, 0) + " us per block), worst "
+                        + juce::String(stats.worstLoad * 100.0f, 1) + "%, overruns " + juce::String(stats.overruns));
+
+    // Orange once this slot has been blamed for an overrun, or its worst block takes half the budget.
+    const auto colour = (stats.overruns > 0 || stats.worstLoad > 0.5f) ? juce::Colours::orange
+                                                                       : juce::Colours::grey;
+    cpuLabel.setColour(juce::Label::textColourId, colour);
 }
 
 void ModuleHeader::paint(juce::Graphics& g)
@@ -72,5 +95,7 @@ void ModuleHeader::resized()
     auto bounds = getLocalBounds();
     deleteButton.setBounds(bounds.removeFromLeft(30).reduced(5));
     optionsButton.setBounds(bounds.removeFromRight(30).reduced(5));
+    osModeBox.setBounds(bounds.removeFromRight(62).reduced(2, 5));
+    cpuLabel.setBounds(bounds.removeFromRight(44));
     title.setBounds(bounds);
 }
\ No newline at end of file
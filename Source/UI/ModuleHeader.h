@@ -1,5 +1,6 @@
 #pragma once
 #include <juce_gui_basics/juce_gui_basics.h>
+#include "../SlotCpuMeter.h"
 
 class ModuleHeader : public juce::Component,
     public juce::DragAndDropTarget
@@ -13,9 +14,13 @@ public:
     juce::Label title;
     juce::TextButton optionsButton{ "..." };
     juce::TextButton deleteButton{ "-" };
+    juce::ComboBox osModeBox; // Per-slot oversampling (Auto/Off/On), attached by the owning ModuleSlot
+    juce::Label cpuLabel;     // Share of the real-time budget, updated by the owning ModuleSlot
 
     ModuleHeader();
 
+    void setCpuStats(const SlotCpuMeter::SlotStats& stats);
+
     void paint(juce::Graphics& g) override;
     void mouseDrag(const juce::MouseEvent& event) override;
 
@@ -6,8 +6,8 @@
 // NEW: Explicitly include the new editor definition
 #include "PhysicalResonatorSlotEditor.h"
 
-ModuleSlot::ModuleSlot(juce::AudioProcessorValueTreeState& apvts, int slotIndex)
-    : valueTreeState(apvts), index(slotIndex)
+ModuleSlot::ModuleSlot(juce::AudioProcessorValueTreeState& apvts, int slotIndex, const SlotCpuMeter* meter)
+    : valueTreeState(apvts), index(slotIndex), cpuMeter(meter)
 {
     setLookAndFeel(&lookAndFeel);
     slotChoiceParamId = "SLOT_" + juce::String(index + 1) + "_CHOICE";
@@ -16,6 +16,11 @@ ModuleSlot::ModuleSlot(juce::AudioProcessorValueTreeState& apvts, int slotIndex)
     addAndMakeVisible(*header);
     header->onMenuClicked = [this] { showModuleMenu(); };
     header->getSlotIndex = [this] { return index; };
+    if (auto* osParam = valueTreeState.getParameter(slotPrefix + "OS_MODE"))
+    {
+        header->osModeBox.addItemList(osParam->getAllValueStrings(), 1);
+        osModeAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(valueTreeState, slotPrefix + "OS_MODE", header->osModeBox);
+    }
     header->onDeleteClicked = [this]
         {
             auto* param = valueTreeState.getParameter(slotChoiceParamId);
@@ -23,17 +28,21 @@ ModuleSlot::ModuleSlot(juce::AudioProcessorValueTreeState& apvts, int slotIndex)
         };
     header->onSlotMoved = [this](int sourceSlot, int targetSlot)
         {
-            auto sourceParamId = "SLOT_" + juce::String(sourceSlot + 1) + "_CHOICE";
-            auto targetParamId = "SLOT_" + juce::String(targetSlot + 1) + "_CHOICE";
-
-            auto* sourceParam = valueTreeState.getParameter(sourceParamId);
-            auto* targetParam = valueTreeState.getParameter(targetParamId);
-            if (sourceParam && targetParam)
+            // The oversampling mode travels with the module.
+            for (auto suffix : { "_OS_MODE", "_CHOICE" })
             {
-                float sourceVal = sourceParam->getValue();
-                float targetVal = targetParam->getValue();
-                sourceParam->setValueNotifyingHost(targetVal);
-                targetParam->setValueNotifyingHost(sourceVal);
+                auto sourceParamId = "SLOT_" + juce::String(sourceSlot + 1) + suffix;
+                auto targetParamId = "SLOT_" + juce::String(targetSlot + 1) + suffix;
+
+                auto* sourceParam = valueTreeState.getParameter(sourceParamId);
+                auto* targetParam = valueTreeState.getParameter(targetParamId);
+                if (sourceParam && targetParam)
+                {
+                    float sourceVal = sourceParam->getValue();
+                    float targetVal = targetParam->getValue();
+                    sourceParam->setValueNotifyingHost(targetVal);
+                    targetParam->setValueNotifyingHost(sourceVal);
+                }
             }
         };
 
@@ -55,10 +64,15 @@ ModuleSlot::ModuleSlot(juce::AudioProcessorValueTreeState& apvts, int slotIndex)
 
     // Now register the listener for future changes.
     valueTreeState.addParameterListener(slotChoiceParamId, this);
+
+    header->cpuLabel.setVisible(cpuMeter != nullptr);
+    if (cpuMeter != nullptr)
+        startTimerHz(10);
 }
 
 ModuleSlot::~ModuleSlot()
 {
+    stopTimer();
     setLookAndFeel(nullptr);
     valueTreeState.removeParameterListener(slotChoiceParamId, this);
 }
@@ -89,6 +103,12 @@ void ModuleSlot::resized() {
         addModuleButton.setBounds(bounds.withSizeKeepingCentre(40, 40));
 }
 
+void ModuleSlot::timerCallback()
+{
+    if (header->isVisible())
+        header->setCpuStats(cpuMeter->getSlotStats(index));
+}
+
 // === FIX: Implement Hybrid Sync/Async Update ===
 void ModuleSlot::parameterChanged(const juce::String& parameterID, float newValue) {
     if (parameterID == slotChoiceParamId)
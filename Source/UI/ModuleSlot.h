@@ -2,21 +2,25 @@
 #include <juce_gui_basics/juce_gui_basics.h>
 #include <juce_audio_processors/juce_audio_processors.h>
 #include "CustomLookAndFeel.h"
+#include "../SlotCpuMeter.h"
 
 class ModuleSelectionGrid;
 class ModuleHeader;
 
 class ModuleSlot : public juce::Component,
-    private juce::AudioProcessorValueTreeState::Listener
+    private juce::AudioProcessorValueTreeState::Listener,
+    private juce::Timer
 {
 public:
-    ModuleSlot(juce::AudioProcessorValueTreeState& apvts, int slotIndex);
+    // cpuMeter may be null, in which case the header shows no CPU readout.
+    ModuleSlot(juce::AudioProcessorValueTreeState& apvts, int slotIndex, const SlotCpuMeter* cpuMeter = nullptr);
     ~ModuleSlot() override;
 
     void paint(juce::Graphics& g) override;
     void resized() override;
 private:
     void parameterChanged(const juce::String& parameterID, float newValue) override;
+    void timerCallback() override;
 
     void createModule(int choice);
     // UPDATED: No longer returns an AudioProcessorEditor
@@ -26,12 +30,14 @@ private:
 
     juce::AudioProcessorValueTreeState& valueTreeState;
     int index;
+    const SlotCpuMeter* cpuMeter;
     juce::String slotChoiceParamId;
     juce::String slotPrefix;
 
     CustomLookAndFeel lookAndFeel;
 
     std::unique_ptr<ModuleHeader> header;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> osModeAttachment;
     // UPDATED: No more temp processor, just a simple component for the editor
     std::unique_ptr<juce::Component> currentEditor;
     juce::TextButton addModuleButton{ "+" };
@@ -9,7 +9,10 @@ PhysicalResonatorSlotEditor::PhysicalResonatorSlotEditor(juce::AudioProcessorVal
     addAndMakeVisible(orbController);
     addAndMakeVisible(xyPad);
     addAndMakeVisible(modelSelector);
+    addAndMakeVisible(partialsSelector);
+    addAndMakeVisible(stringsSelector);
     addAndMakeVisible(noiseTypeSelector);
+    addAndMakeVisible(stringTriggerSelector);
 
     // Labels
     addAndMakeVisible(modelLabel);
@@ -17,11 +20,29 @@ PhysicalResonatorSlotEditor::PhysicalResonatorSlotEditor(juce::AudioProcessorVal
     modelLabel.attachToComponent(&modelSelector, false);
     modelLabel.setJustificationType(juce::Justification::centred);
 
+    addAndMakeVisible(partialsLabel);
+    partialsLabel.setText("Partials", juce::dontSendNotification);
+    partialsLabel.attachToComponent(&partialsSelector, false);
+    partialsLabel.setJustificationType(juce::Justification::centred);
+
+    addAndMakeVisible(stringsLabel);
+    stringsLabel.setText("Strings", juce::dontSendNotification);
+    stringsLabel.attachToComponent(&stringsSelector, false);
+    stringsLabel.setJustificationType(juce::Justification::centred);
+
+    addAndMakeVisible(stereoLinkButton);
+    stereoLinkButton.setClickingTogglesState(true);
+
     addAndMakeVisible(noiseTypeLabel);
     noiseTypeLabel.setText("Noise Type", juce::dontSendNotification);
     noiseTypeLabel.attachToComponent(&noiseTypeSelector, false);
     noiseTypeLabel.setJustificationType(juce::Justification::centred);
 
+    addAndMakeVisible(stringTriggerLabel);
+    stringTriggerLabel.setText("Trigger", juce::dontSendNotification);
+    stringTriggerLabel.attachToComponent(&stringTriggerSelector, false);
+    stringTriggerLabel.setJustificationType(juce::Justification::centred);
+
     addAndMakeVisible(excitationLabel);
     excitationLabel.setText("Excitation (X: Excite Type / Y: Sensitivity)", juce::dontSendNotification);
     excitationLabel.setJustificationType(juce::Justification::centred);
@@ -30,17 +51,30 @@ PhysicalResonatorSlotEditor::PhysicalResonatorSlotEditor(juce::AudioProcessorVal
     if (auto* param = apvts.getParameter(physResPrefix + "MODEL"))
         modelSelector.addItemList(param->getAllValueStrings(), 1);
 
+    if (auto* param = apvts.getParameter(physResPrefix + "PARTIALS"))
+        partialsSelector.addItemList(param->getAllValueStrings(), 1);
+
+    if (auto* param = apvts.getParameter(physResPrefix + "STRINGS"))
+        stringsSelector.addItemList(param->getAllValueStrings(), 1);
+
     if (auto* param = apvts.getParameter(physResPrefix + "NOISE_TYPE"))
         noiseTypeSelector.addItemList(param->getAllValueStrings(), 1);
 
+    if (auto* param = apvts.getParameter(physResPrefix + "STRING_TRIGGER"))
+        stringTriggerSelector.addItemList(param->getAllValueStrings(), 1);
+
     // --- Setup Attachments (Correct parameter IDs) ---
     tuneAttachment = std::make_unique<SliderAttachment>(apvts, physResPrefix + "TUNE", orbController.tuneSlider);
     mixAttachment = std::make_unique<SliderAttachment>(apvts, physResPrefix + "MIX", orbController.mixSlider);
     modelAttachment = std::make_unique<ComboBoxAttachment>(apvts, physResPrefix + "MODEL", modelSelector);
+    partialsAttachment = std::make_unique<ComboBoxAttachment>(apvts, physResPrefix + "PARTIALS", partialsSelector);
+    stringsAttachment = std::make_unique<ComboBoxAttachment>(apvts, physResPrefix + "STRINGS", stringsSelector);
+    stereoLinkAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(apvts, physResPrefix + "STEREO_LINK", stereoLinkButton);
 
     exciteTypeAttachment = std::make_unique<SliderAttachment>(apvts, physResPrefix + "EXCITE_TYPE", xyPad.xSlider);
     sensitivityAttachment = std::make_unique<SliderAttachment>(apvts, physResPrefix + "SENSITIVITY", xyPad.ySlider);
     noiseTypeAttachment = std::make_unique<ComboBoxAttachment>(apvts, physResPrefix + "NOISE_TYPE", noiseTypeSelector);
+    stringTriggerAttachment = std::make_unique<ComboBoxAttachment>(apvts, physResPrefix + "STRING_TRIGGER", stringTriggerSelector);
 
     // Ensure initial internal normalised values reflect current slider state
     orbController.sliderValueChanged(&orbController.mixSlider);
@@ -63,8 +97,12 @@ void PhysicalResonatorSlotEditor::resized()
     // 1. Resonator Core Area
     auto resonatorArea = bounds.removeFromTop(bounds.getHeight() * 0.55f);
 
-    // Model Selector (placed above the Orb)
-    modelSelector.setBounds(resonatorArea.removeFromTop(50).reduced(60, 10));
+    // Model, Partials (modal) and Strings (sympathetic) Selectors (placed above the Orb)
+    auto selectorRow = resonatorArea.removeFromTop(50).reduced(10, 10);
+    const int selectorWidth = selectorRow.getWidth() / 3;
+    modelSelector.setBounds(selectorRow.removeFromLeft(selectorWidth).reduced(3, 0));
+    partialsSelector.setBounds(selectorRow.removeFromLeft(selectorWidth).reduced(3, 0));
+    stringsSelector.setBounds(selectorRow.reduced(3, 0));
 
     // The Orb
     orbController.setBounds(resonatorArea);
@@ -78,6 +116,10 @@ void PhysicalResonatorSlotEditor::resized()
     // XY Pad
     xyPad.setBounds(excitationArea.removeFromTop(100).reduced(40, 0));
 
-    // Noise Type Selector (placed below the XY Pad)
-    noiseTypeSelector.setBounds(excitationArea.removeFromTop(50).reduced(60, 10));
+    // Noise Type, String Trigger and Stereo Link (placed below the XY Pad)
+    auto bottomRow = excitationArea.removeFromTop(50).reduced(20, 10);
+    const int bottomWidth = bottomRow.getWidth() / 3;
+    noiseTypeSelector.setBounds(bottomRow.removeFromLeft(bottomWidth).reduced(5, 0));
+    stringTriggerSelector.setBounds(bottomRow.removeFromLeft(bottomWidth).reduced(5, 0));
+    stereoLinkButton.setBounds(bottomRow.reduced(5, 0));
 }
\ No newline at end of file
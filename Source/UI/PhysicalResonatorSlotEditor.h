@@ -21,13 +21,15 @@ private:
     XYPad xyPad;
 
     // Standard Selectors
-    juce::ComboBox modelSelector, noiseTypeSelector;
-    juce::Label modelLabel, noiseTypeLabel, excitationLabel;
+    juce::ComboBox modelSelector, partialsSelector, stringsSelector, noiseTypeSelector, stringTriggerSelector;
+    juce::Label modelLabel, partialsLabel, stringsLabel, noiseTypeLabel, stringTriggerLabel, excitationLabel;
+    juce::ToggleButton stereoLinkButton{ "Stereo Link" };
 
     // Attachments
     using SliderAttachment = juce::AudioProcessorValueTreeState::SliderAttachment;
     using ComboBoxAttachment = juce::AudioProcessorValueTreeState::ComboBoxAttachment;
 
     std::unique_ptr<SliderAttachment> tuneAttachment, mixAttachment, exciteTypeAttachment, sensitivityAttachment;
-    std::unique_ptr<ComboBoxAttachment> modelAttachment, noiseTypeAttachment;
+    std::unique_ptr<ComboBoxAttachment> modelAttachment, partialsAttachment, stringsAttachment, noiseTypeAttachment, stringTriggerAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> stereoLinkAttachment;
 };
\ No newline at end of file
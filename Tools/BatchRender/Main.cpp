@@ -0,0 +1,213 @@
+//================================================================================
+// File: Tools/BatchRender/Main.cpp
+//================================================================================
+// Headless batch renderer: runs audio files through a Tessera preset, without a DAW.
+//
+// Build as a JUCE console application from this folder plus every .cpp under Source/, linked
+// against juce_audio_formats, juce_audio_processors, juce_dsp and juce_gui_extra (the plugin's
+// editor is compiled in), with JucePlugin_Name="Tessera" defined. Needs no display.
+//
+// Usage:
+//   TesseraRender --preset=<preset.xml> [options] <file or folder>...
+//
+// --preset       A global preset, as written by the plugin's preset browser (PresetManager).
+// --output-dir   Where rendered files go (default: a "Rendered" folder next to each input).
+// --format       wav or aiff (default: the input's own format when it is one of these, else wav).
+// --bits         16, 24 or 32 (32 is float in WAV) (default 24).
+// --block        Host block size (default 4096).
+// --tail         Seconds rendered after the input ends (default: the chain's tail, at most 30 s).
+// --jobs         Files rendered at once, each on its own thread and processor (default: one per core).
+// --no-latency-compensation
+//                Keep the chain's latency at the start of the output instead of trimming it.
+// --free-seeds   Let noise and grain sources run from random seeds. By default they use the
+//                preset's slot seeds, so rendering the same file twice gives identical output.
+//
+// Folders are searched recursively for WAV, AIFF and FLAC files. The exit code is 1 if any file
+// failed and 2 for usage errors.
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_events/juce_events.h>
+#include <iostream>
+#include "RenderJob.h"
+
+namespace
+{
+    const juce::String inputWildcard = "*.wav;*.wave;*.aif;*.aiff;*.flac";
+
+    bool loadPreset(const juce::File& file, juce::MemoryBlock& state)
+    {
+        auto xml = juce::XmlDocument::parse(file);
+        if (xml == nullptr || !xml->hasTagName("Parameters")) // The processor's APVTS state type
+            return false;
+        juce::AudioProcessor::copyXmlToBinary(*xml, state);
+        return true;
+    }
+
+    juce::Array<juce::File> collectInputs(const juce::StringArray& paths)
+    {
+        juce::Array<juce::File> files;
+        for (const auto& path : paths)
+        {
+            const auto file = juce::File::getCurrentWorkingDirectory().getChildFile(path.unquoted());
+            if (file.isDirectory())
+            {
+                auto found = file.findChildFiles(juce::File::findFiles, true, inputWildcard);
+                found.sort();
+                files.addArray(found);
+            }
+            else if (file.existsAsFile())
+            {
+                files.add(file);
+            }
+            else
+            {
+                std::cerr << "Not found: " << file.getFullPathName() << std::endl;
+            }
+        }
+        return files;
+    }
+
+    juce::File getOutputFile(const juce::File& input, const juce::File& outputDir, const juce::String& format)
+    {
+        auto extension = format;
+        if (extension.isEmpty())
+            extension = input.hasFileExtension("aif;aiff") ? input.getFileExtension().substring(1) : juce::String("wav");
+
+        const auto dir = outputDir != juce::File() ? outputDir : input.getSiblingFile("Rendered");
+        return dir.getChildFile(input.getFileNameWithoutExtension()).withFileExtension(extension);
+    }
+
+    juce::String formatProgress(double fraction)
+    {
+        return juce::String(fraction * 100.0, 1) + "%";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // JUCE's timers (the parameter state's, for one) expect a message manager to exist. None of
+    // its messages are ever dispatched: there is no message loop, and no display is opened.
+    const juce::ScopedJuceInitialiser_GUI juceInitialiser;
+    const juce::ArgumentList args(argc, argv);
+
+    juce::StringArray paths;
+    for (const auto& arg : args.arguments)
+        if (!arg.isOption())
+            paths.add(arg.text);
+
+    if (!args.containsOption("--preset") || paths.isEmpty())
+    {
+        std::cerr << "Usage: TesseraRender --preset=<preset.xml> [--output-dir=<dir>] [--format=wav|aiff] [--bits=16|24|32]" << std::endl
+                  << "                     [--block=<n>] [--tail=<s>] [--jobs=<n>] [--no-latency-compensation] [--free-seeds] <file or folder>..." << std::endl;
+        return 2;
+    }
+
+    RenderSettings settings;
+    const auto presetFile = args.getFileForOption("--preset");
+    if (!loadPreset(presetFile, settings.presetState))
+    {
+        std::cerr << "Not a Tessera preset: " << presetFile.getFullPathName() << std::endl;
+        return 2;
+    }
+
+    if (args.containsOption("--bits"))
+        settings.bitsPerSample = args.getValueForOption("--bits").getIntValue();
+    if (settings.bitsPerSample != 16 && settings.bitsPerSample != 24 && settings.bitsPerSample != 32)
+    {
+        std::cerr << "--bits must be 16, 24 or 32" << std::endl;
+        return 2;
+    }
+    if (args.containsOption("--block"))
+        settings.blockSize = juce::jlimit(32, 65536, args.getValueForOption("--block").getIntValue());
+    if (args.containsOption("--tail"))
+        settings.tailSeconds = juce::jmax(0.0, args.getValueForOption("--tail").getDoubleValue());
+    settings.compensateLatency = !args.containsOption("--no-latency-compensation");
+    settings.deterministicSeeds = !args.containsOption("--free-seeds");
+
+    const auto format = args.getValueForOption("--format").toLowerCase();
+    if (format.isNotEmpty() && format != "wav" && format != "aiff")
+    {
+        std::cerr << "--format must be wav or aiff" << std::endl;
+        return 2;
+    }
+    const auto outputDir = args.containsOption("--output-dir") ? args.getFileForOption("--output-dir") : juce::File();
+
+    const auto inputs = collectInputs(paths);
+    if (inputs.isEmpty())
+    {
+        std::cerr << "No audio files to render" << std::endl;
+        return 2;
+    }
+
+    const int numThreads = args.containsOption("--jobs") ? juce::jmax(1, args.getValueForOption("--jobs").getIntValue())
+                                                         : juce::SystemStats::getNumCpus();
+
+    // Jobs are owned here rather than by the pool, so their results can be read after they finish.
+    juce::OwnedArray<RenderJob> jobs;
+    for (const auto& input : inputs)
+    {
+        const auto output = getOutputFile(input, outputDir, format);
+        if (output == input)
+        {
+            std::cerr << "Skipping " << input.getFullPathName() << ": it would be overwritten by its own render" << std::endl;
+            continue;
+        }
+        jobs.add(new RenderJob(settings, input, output));
+    }
+    if (jobs.isEmpty())
+        return 2;
+
+    std::cout << "Rendering " << jobs.size() << " file(s) through " << presetFile.getFileNameWithoutExtension()
+              << " on " << juce::jmin(numThreads, jobs.size()) << " thread(s)" << std::endl;
+
+    juce::ThreadPool pool(juce::jmin(numThreads, jobs.size()));
+    for (auto* job : jobs)
+        pool.addJob(job, false);
+
+    // Progress: the share of all samples processed, plus a line for every file as it completes.
+    juce::Array<bool> reported;
+    reported.insertMultiple(0, false, jobs.size());
+    int numFailed = 0, numDone = 0;
+    auto lastProgressTime = juce::Time::getMillisecondCounter();
+
+    while (numDone < jobs.size())
+    {
+        juce::Thread::sleep(250);
+
+        double total = 0.0;
+        for (int i = 0; i < jobs.size(); ++i)
+        {
+            auto* job = jobs[i];
+            total += job->getProgress();
+
+            if (job->isFinished() && !reported[i])
+            {
+                reported.set(i, true);
+                ++numDone;
+
+                if (job->getError().isEmpty())
+                {
+                    std::cout << "[" << numDone << "/" << jobs.size() << "] " << job->getOutputFile().getFullPathName()
+                              << " (" << juce::String(job->getAudioSeconds(), 1) << " s of audio in "
+                              << juce::String(job->getRenderSeconds(), 1) << " s)" << std::endl;
+                }
+                else
+                {
+                    ++numFailed;
+                    std::cout << "[" << numDone << "/" << jobs.size() << "] FAILED " << job->getInputFile().getFullPathName()
+                              << ": " << job->getError() << std::endl;
+                }
+            }
+        }
+
+        const auto now = juce::Time::getMillisecondCounter();
+        if (numDone < jobs.size() && now - lastProgressTime >= 2000)
+        {
+            std::cout << "Progress: " << formatProgress(total / (double)jobs.size()) << std::endl;
+            lastProgressTime = now;
+        }
+    }
+
+    std::cout << (jobs.size() - numFailed) << " rendered, " << numFailed << " failed" << std::endl;
+    return numFailed > 0 ? 1 : 0;
+}
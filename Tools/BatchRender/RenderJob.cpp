@@ -0,0 +1,136 @@
+//================================================================================
+// File: Tools/BatchRender/RenderJob.cpp
+//================================================================================
+#include "RenderJob.h"
+#include "../../Source/PluginProcessor.h"
+#include <cmath>
+
+RenderJob::RenderJob(const RenderSettings& settingsToUse, juce::File inputFile, juce::File outputFile)
+    : juce::ThreadPoolJob("Render " + inputFile.getFileName()),
+      settings(settingsToUse), input(std::move(inputFile)), output(std::move(outputFile))
+{
+}
+
+juce::ThreadPoolJob::JobStatus RenderJob::runJob()
+{
+    const auto start = juce::Time::getMillisecondCounterHiRes();
+    error = render();
+    renderSeconds = (juce::Time::getMillisecondCounterHiRes() - start) / 1000.0;
+
+    progress.store(1.0, std::memory_order_relaxed);
+    finished.store(true, std::memory_order_release);
+    return jobHasFinished;
+}
+
+juce::String RenderJob::render()
+{
+    juce::AudioFormatManager formats;
+    formats.registerBasicFormats();
+
+    std::unique_ptr<juce::AudioFormatReader> reader(formats.createReaderFor(input));
+    if (reader == nullptr)
+        return "unsupported or unreadable audio file";
+
+    auto* format = formats.findFormatForFileExtension(output.getFileExtension());
+    if (format == nullptr)
+        return "no audio format for " + output.getFileExtension();
+
+    const double sampleRate = reader->sampleRate;
+    const int blockSize = juce::jmax(32, settings.blockSize);
+    constexpr int numChannels = 2; // The chain is stereo; mono files are rendered on both sides
+
+    // Offline setup. Non-realtime first, so the first build already uses the offline quality.
+    auto processor = std::make_unique<ModularMultiFxAudioProcessor>();
+    processor->setNonRealtime(true);
+    processor->setStateInformation(settings.presetState.getData(), (int)settings.presetState.getSize());
+    if (settings.deterministicSeeds)
+        if (auto* seeds = processor->apvts.getParameter("DETERMINISTIC_SEEDS"))
+            seeds->setValueNotifyingHost(1.0f);
+    processor->setPlayConfigDetails(numChannels, numChannels, sampleRate, blockSize);
+    processor->prepareToPlay(sampleRate, blockSize);
+
+    // The first block makes the processor pick up the offline oversampling configuration. Preparing
+    // again then installs the final context directly, with no crossfade from the setup block.
+    juce::AudioBuffer<float> buffer(numChannels, blockSize);
+    juce::MidiBuffer midi;
+    buffer.clear();
+    processor->processBlock(buffer, midi);
+    processor->prepareToPlay(sampleRate, blockSize);
+
+    const juce::int64 latency = settings.compensateLatency ? processor->getLatencySamples() : 0;
+    double tailSeconds = settings.tailSeconds >= 0.0 ? settings.tailSeconds : processor->getTailLengthSeconds();
+    if (!std::isfinite(tailSeconds))
+        tailSeconds = RenderSettings::maxTailSeconds;
+    tailSeconds = juce::jlimit(0.0, RenderSettings::maxTailSeconds, tailSeconds);
+
+    const juce::int64 inputLength = reader->lengthInSamples;
+    const juce::int64 outputLength = inputLength + (juce::int64)std::ceil(tailSeconds * sampleRate);
+    const juce::int64 totalToProcess = latency + outputLength;
+    audioSeconds = (double)outputLength / sampleRate;
+
+    output.getParentDirectory().createDirectory();
+    const auto tempFile = output.getSiblingFile(output.getFileNameWithoutExtension() + ".partial" + output.getFileExtension());
+    tempFile.deleteFile();
+
+    std::unique_ptr<juce::AudioFormatWriter> writer;
+    {
+        auto stream = std::make_unique<juce::FileOutputStream>(tempFile);
+        if (stream->failedToOpen())
+            return "cannot write " + tempFile.getFullPathName();
+
+        writer.reset(format->createWriterFor(stream.get(), sampleRate, (unsigned int)numChannels, settings.bitsPerSample, {}, 0));
+        if (writer == nullptr)
+            return "the output format does not support " + juce::String(settings.bitsPerSample) + " bit at " + juce::String(sampleRate) + " Hz";
+        stream.release(); // Owned by the writer now
+    }
+
+    juce::int64 processed = 0, written = 0;
+    while (processed < totalToProcess)
+    {
+        if (shouldExit())
+        {
+            writer.reset();
+            tempFile.deleteFile();
+            return "cancelled";
+        }
+
+        const int numSamples = (int)juce::jmin((juce::int64)blockSize, totalToProcess - processed);
+        juce::AudioBuffer<float> block(buffer.getArrayOfWritePointers(), numChannels, numSamples);
+        block.clear();
+
+        // Input runs out after inputLength samples; the rest is silence for the tail.
+        const int numToRead = (int)juce::jlimit((juce::int64)0, (juce::int64)numSamples, inputLength - processed);
+        if (numToRead > 0)
+        {
+            reader->read(&block, 0, numToRead, processed, true, true);
+            if (reader->numChannels == 1)
+                block.copyFrom(1, 0, block, 0, 0, numToRead);
+        }
+
+        processor->processBlock(block, midi);
+
+        // The first `latency` samples are the chain's delay, not output.
+        const int skip = (int)juce::jlimit((juce::int64)0, (juce::int64)numSamples, latency - processed);
+        const int numToWrite = (int)juce::jmin((juce::int64)(numSamples - skip), outputLength - written);
+        if (numToWrite > 0)
+        {
+            if (!writer->writeFromAudioSampleBuffer(block, skip, numToWrite))
+            {
+                writer.reset();
+                tempFile.deleteFile();
+                return "write failed";
+            }
+            written += numToWrite;
+        }
+
+        processed += numSamples;
+        progress.store((double)processed / (double)totalToProcess, std::memory_order_relaxed);
+    }
+
+    writer.reset(); // Flushes and closes the file
+    processor->releaseResources();
+
+    if (!tempFile.moveFileTo(output))
+        return "cannot replace " + output.getFullPathName();
+    return {};
+}
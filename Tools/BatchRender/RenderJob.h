@@ -0,0 +1,61 @@
+//================================================================================
+// File: Tools/BatchRender/RenderJob.h
+//================================================================================
+#pragma once
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <atomic>
+
+// Settings shared by every file of a batch.
+struct RenderSettings
+{
+    juce::MemoryBlock presetState;  // Preset XML in the host's binary state format
+    int blockSize = 4096;           // Host block size; modules still run in their own control blocks
+    int bitsPerSample = 24;         // 16, 24 or 32 (float)
+    double tailSeconds = -1.0;      // Rendered after the input ends; < 0 uses the chain's own tail
+    static constexpr double maxTailSeconds = 30.0;
+    bool compensateLatency = true;  // Drops the chain's latency so the output lines up with the input
+    bool deterministicSeeds = true; // Noise and grain sources restart from the preset's slot seeds
+};
+
+/**
+ * Renders one audio file through its own processor instance, configured from the preset and
+ * switched to non-realtime mode (the processor then runs its offline oversampling quality).
+ *
+ * The output only depends on the input, the preset and the settings: the chain is built
+ * synchronously before any audio runs, so no block is processed with a stale context or a
+ * crossfade, and blocks are always cut at the same points. With deterministic seeds (the default)
+ * the modules' noise sources start from the same state too, so two renders are bit-identical.
+ */
+class RenderJob : public juce::ThreadPoolJob
+{
+public:
+    RenderJob(const RenderSettings& settingsToUse, juce::File inputFile, juce::File outputFile);
+
+    JobStatus runJob() override;
+
+    const juce::File& getInputFile() const noexcept { return input; }
+    const juce::File& getOutputFile() const noexcept { return output; }
+
+    // Any thread. 0..1 while running; 1 once finished (successfully or not).
+    double getProgress() const noexcept { return progress.load(std::memory_order_relaxed); }
+    bool isFinished() const noexcept { return finished.load(std::memory_order_acquire); }
+
+    // Valid once finished: an empty string means the file rendered.
+    juce::String getError() const { return error; }
+    double getRenderSeconds() const noexcept { return renderSeconds; }
+    double getAudioSeconds() const noexcept { return audioSeconds; }
+
+private:
+    juce::String render();
+
+    const RenderSettings& settings;
+    const juce::File input, output;
+
+    std::atomic<double> progress{ 0.0 };
+    std::atomic<bool> finished{ false };
+    juce::String error;
+    double renderSeconds = 0.0, audioSeconds = 0.0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RenderJob)
+};
@@ -0,0 +1,344 @@
+//================================================================================
+// File: Tools/Benchmark/BenchmarkSuite.cpp
+//================================================================================
+#include "BenchmarkSuite.h"
+#include "../../Source/PluginProcessor.h"
+#include "../../Source/SlotHostProcessor.h"
+#include "../../Source/FX_Modules/BBDGranularEngine.h"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <random>
+
+namespace
+{
+    // Names by SLOT_n_CHOICE value, as in the parameter layout.
+    const char* const moduleNames[] = { "Empty", "Distortion", "Filter", "Modulation", "Delay", "Reverb", "Compressor", "ChromaTape",
+                                        "MorphoComp", "Physical Resonator", "Spectral Animator", "Helical Delay", "Chrono-Verb", "Tectonic Delay" };
+    static_assert((int)std::size(moduleNames) == HostedModule::numChoices, "Module name table size");
+
+    const char* const osRateNames[] = { "x1", "x2", "x4", "x8", "x16" };
+    const char* const osAlgorithmNames[] = { "Live", "HQ", "Deluxe" };
+
+    constexpr int minRandomBlockSize = 16;
+    constexpr unsigned int blockSizeSeed = 0x7e55e7a;
+    constexpr double nanosecondsPerSecond = 1.0e9;
+
+    void setParameter(juce::AudioProcessorValueTreeState& apvts, const juce::String& parameterID, float value)
+    {
+        auto* parameter = apvts.getParameter(parameterID);
+        jassert(parameter != nullptr);
+        if (parameter != nullptr)
+            parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+    }
+
+    // Tone, noise and a decaying burst every quarter second: keeps detectors, gates and
+    // transient-driven modules busy, and never lets a slot fall asleep on silence.
+    void fillTestSignal(juce::AudioBuffer<float>& signal, double sampleRate)
+    {
+        juce::Random random(1234);
+        const int burstPeriod = juce::jmax(1, (int)(sampleRate * 0.25));
+        const double toneIncrement = juce::MathConstants<double>::twoPi * 220.0 / sampleRate;
+
+        for (int ch = 0; ch < signal.getNumChannels(); ++ch)
+        {
+            auto* data = signal.getWritePointer(ch);
+            for (int i = 0; i < signal.getNumSamples(); ++i)
+            {
+                const float burst = std::exp(-(float)(i % burstPeriod) / (float)(sampleRate * 0.02));
+                const float noise = random.nextFloat() * 2.0f - 1.0f;
+                data[i] = 0.25f * (float)std::sin(toneIncrement * i + ch) + noise * (0.05f + 0.4f * burst);
+            }
+        }
+    }
+}
+
+//==============================================================================
+BenchmarkSettings BenchmarkSettings::quick()
+{
+    BenchmarkSettings quickSettings;
+    quickSettings.sampleRates = { 48000.0 };
+    quickSettings.blockSizes = { 64, 512, randomBlockSize };
+    quickSettings.channelCounts = { 2 };
+    quickSettings.allOversamplingConfigs = false;
+    quickSettings.secondsPerRun = 0.5;
+    return quickSettings;
+}
+
+juce::var BenchmarkResult::toVar() const
+{
+    auto* object = new juce::DynamicObject();
+    object->setProperty("id", id);
+    object->setProperty("suite", suite);
+    object->setProperty("subject", subject);
+    object->setProperty("sampleRate", sampleRate);
+    object->setProperty("blockSize", blockSize == BenchmarkSettings::randomBlockSize ? juce::var("random") : juce::var(blockSize));
+    object->setProperty("channels", channels);
+    object->setProperty("oversampling", oversampling);
+    object->setProperty("oversamplingLocked", oversamplingLocked);
+    object->setProperty("nsPerSample", nsPerSample);
+    object->setProperty("minNsPerSample", minNsPerSample);
+    object->setProperty("realtimeLoad", realtimeLoad);
+    object->setProperty("latencySamples", latencySamples);
+    return juce::var(object);
+}
+
+juce::String BenchmarkSuite::OversamplingSetting::getName() const
+{
+    if (rate == 0) return osRateNames[0];
+    return juce::String(osAlgorithmNames[algorithm]) + " " + osRateNames[rate];
+}
+
+//==============================================================================
+BenchmarkSuite::BenchmarkSuite(BenchmarkSettings settingsToUse)
+    : settings(std::move(settingsToUse))
+{
+}
+
+BenchmarkSuite::~BenchmarkSuite() = default;
+
+std::vector<BenchmarkResult> BenchmarkSuite::run(const std::function<void(const BenchmarkResult&)>& onResult)
+{
+    results.clear();
+    resultCallback = onResult;
+
+    runModuleSuite();
+    runModuleOversamplingSuite();
+    runChainSuite();
+
+    parameterHost.reset();
+    return results;
+}
+
+bool BenchmarkSuite::shouldRun(const juce::String& id) const
+{
+    return settings.filter.isEmpty() || id.containsIgnoreCase(settings.filter);
+}
+
+void BenchmarkSuite::report(BenchmarkResult result)
+{
+    result.realtimeLoad = result.nsPerSample * result.sampleRate / nanosecondsPerSecond;
+    results.push_back(result);
+    if (resultCallback)
+        resultCallback(results.back());
+}
+
+juce::String BenchmarkSuite::makeId(const juce::String& suite, const juce::String& subject, double sampleRate,
+                                    int blockSize, int channels, const juce::String& oversampling)
+{
+    return suite + "/" + subject + "/" + juce::String((int)sampleRate) + "Hz/"
+        + (blockSize == BenchmarkSettings::randomBlockSize ? juce::String("random") : juce::String(blockSize))
+        + "/" + juce::String(channels) + "ch/" + oversampling;
+}
+
+int BenchmarkSuite::getMaxBlockSize(int blockSize) const noexcept
+{
+    return blockSize == BenchmarkSettings::randomBlockSize ? juce::jmax(minRandomBlockSize, settings.randomMaxBlockSize) : blockSize;
+}
+
+std::vector<BenchmarkSuite::OversamplingSetting> BenchmarkSuite::getOversamplingSettings() const
+{
+    if (!settings.allOversamplingConfigs)
+        return { { 0, 1 }, { 1, 0 }, { 2, 1 }, { 3, 2 } }; // Off, Live x2, HQ x4 (default), Deluxe x8 (offline)
+
+    std::vector<OversamplingSetting> all{ { 0, 1 } };
+    for (int rate = 1; rate < (int)std::size(osRateNames); ++rate)
+        for (int algorithm = 0; algorithm < (int)std::size(osAlgorithmNames); ++algorithm)
+            all.push_back({ rate, algorithm });
+    return all;
+}
+
+std::vector<BenchmarkSuite::ChainSpec> BenchmarkSuite::getChains()
+{
+    return {
+        { "Guitar", { 1, 2, 3, 4, 5 }, (int)ChainRouting::Serial },
+        { "Mix Bus", { 6, 8, 7 }, (int)ChainRouting::Serial },
+        { "Ambient", { 9, 10, 11, 12, 13 }, (int)ChainRouting::Serial },
+        { "Everything", { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13 }, (int)ChainRouting::Serial },
+        { "Everything Parallel Rows", { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13 }, (int)ChainRouting::ParallelRows }
+    };
+}
+
+//==============================================================================
+BenchmarkSuite::Measurement BenchmarkSuite::measure(double sampleRate, int blockSize, int channels, const ProcessFunction& process)
+{
+    const int maxBlockSize = getMaxBlockSize(blockSize);
+    juce::AudioBuffer<float> signal(channels, juce::jmax(maxBlockSize, (int)sampleRate));
+    fillTestSignal(signal, sampleRate);
+    juce::AudioBuffer<float> buffer(channels, maxBlockSize);
+
+    std::minstd_rand blockSizeRandom(blockSizeSeed);
+    std::uniform_int_distribution<int> blockSizeDistribution(minRandomBlockSize, maxBlockSize);
+    int signalPosition = 0;
+
+    // Processes the given number of frames, returning the ticks spent inside process() only.
+    auto runFor = [&](juce::int64 numFrames)
+        {
+            juce::int64 ticks = 0;
+            while (numFrames > 0)
+            {
+                int numSamples = blockSize == BenchmarkSettings::randomBlockSize ? blockSizeDistribution(blockSizeRandom) : blockSize;
+                numSamples = (int)juce::jmin((juce::int64)numSamples, numFrames);
+                if (signalPosition + numSamples > signal.getNumSamples())
+                    signalPosition = 0;
+
+                for (int ch = 0; ch < channels; ++ch)
+                    buffer.copyFrom(ch, 0, signal, ch, signalPosition, numSamples);
+                juce::AudioBuffer<float> block(buffer.getArrayOfWritePointers(), channels, numSamples);
+
+                const auto start = juce::Time::getHighResolutionTicks();
+                process(block);
+                ticks += juce::Time::getHighResolutionTicks() - start;
+
+                signalPosition += numSamples;
+                numFrames -= numSamples;
+            }
+            return ticks;
+        };
+
+    juce::ScopedNoDenormals noDenormals;
+    runFor((juce::int64)(settings.warmupSeconds * sampleRate) + maxBlockSize);
+
+    const auto framesPerRun = juce::jmax((juce::int64)maxBlockSize, (juce::int64)(settings.secondsPerRun * sampleRate));
+    const double nsPerTick = nanosecondsPerSecond / (double)juce::Time::getHighResolutionTicksPerSecond();
+    std::vector<double> runs;
+    for (int i = 0; i < juce::jmax(1, settings.numRuns); ++i)
+        runs.push_back((double)runFor(framesPerRun) * nsPerTick / (double)framesPerRun);
+
+    std::sort(runs.begin(), runs.end());
+    return { runs[runs.size() / 2], runs.front() };
+}
+
+//==============================================================================
+void BenchmarkSuite::runModuleSuite()
+{
+    if (parameterHost == nullptr)
+        parameterHost = std::make_unique<ModularMultiFxAudioProcessor>();
+
+    for (double sampleRate : settings.sampleRates)
+        for (int blockSize : settings.blockSizes)
+            for (int channels : settings.channelCounts)
+            {
+                const int maxBlockSize = getMaxBlockSize(blockSize);
+
+                // Modules read the parameters of the slot they were created for: slot 1 here.
+                for (int choice = 1; choice < HostedModule::numChoices; ++choice)
+                {
+                    const auto id = makeId("module", moduleNames[choice], sampleRate, blockSize, channels, "x1");
+                    if (!shouldRun(id)) continue;
+
+                    SlotHostProcessor host(HostedModule::create(choice, parameterHost->apvts, 0));
+                    host.setPlayConfigDetails(channels, channels, sampleRate, maxBlockSize);
+                    host.prepareToPlay(sampleRate, maxBlockSize);
+
+                    juce::MidiBuffer midi;
+                    const auto measurement = measure(sampleRate, blockSize, channels,
+                        [&](juce::AudioBuffer<float>& block) { host.processBlock(block, midi); });
+
+                    BenchmarkResult result{ id, "module", moduleNames[choice], sampleRate, blockSize, channels, "x1" };
+                    result.nsPerSample = measurement.nsPerSample;
+                    result.minNsPerSample = measurement.minNsPerSample;
+                    result.latencySamples = host.getLatencySamples();
+                    report(result);
+                    host.releaseResources();
+                }
+
+                // Not reachable from any slot, so it is driven the way its processor would.
+                const auto id = makeId("module", "BBDGranularEngine", sampleRate, blockSize, channels, "x1");
+                if (!shouldRun(id)) continue;
+
+                BBDGranularEngine engine;
+                engine.prepare({ sampleRate, (juce::uint32)maxBlockSize, (juce::uint32)channels }, BBDGranularEngine::Config{}, (int)(sampleRate * 2.0));
+                engine.setSeed(1); // Same grain pattern on every run
+                const auto measurement = measure(sampleRate, blockSize, channels, [&](juce::AudioBuffer<float>& block)
+                    {
+                        juce::dsp::AudioBlock<float> audioBlock(block);
+                        engine.capture(audioBlock);
+                        engine.process(audioBlock, 0.5f, 150.0f, 0.5f, 0.3f);
+                    });
+
+                BenchmarkResult result{ id, "module", "BBDGranularEngine", sampleRate, blockSize, channels, "x1" };
+                result.nsPerSample = measurement.nsPerSample;
+                result.minNsPerSample = measurement.minNsPerSample;
+                report(result);
+            }
+}
+
+void BenchmarkSuite::runModuleOversamplingSuite()
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 512, channels = 2;
+
+    for (int choice = 1; choice < HostedModule::numChoices; ++choice)
+        for (const auto& os : getOversamplingSettings())
+            if (os.rate > 0)
+                runProcessorCase("module_os", moduleNames[choice], { choice }, (int)ChainRouting::Serial, true, os,
+                                 sampleRate, blockSize, channels);
+}
+
+void BenchmarkSuite::runChainSuite()
+{
+    const OversamplingSetting defaultOversampling{ 2, 1 }; // HQ x4, the parameter defaults
+    const bool sweepCoversDefault = std::find(settings.sampleRates.begin(), settings.sampleRates.end(), 48000.0) != settings.sampleRates.end();
+
+    for (const auto& chain : getChains())
+    {
+        for (double sampleRate : settings.sampleRates)
+            for (const auto& os : getOversamplingSettings())
+                runProcessorCase("chain", chain.name, chain.slotChoices, chain.routing, false, os, sampleRate, 512, 2);
+
+        for (int blockSize : settings.blockSizes)
+            for (int channels : settings.channelCounts)
+                if (!sweepCoversDefault || blockSize != 512 || channels != 2) // Otherwise measured above
+                    runProcessorCase("chain", chain.name, chain.slotChoices, chain.routing, false, defaultOversampling,
+                                     48000.0, blockSize, channels);
+    }
+}
+
+void BenchmarkSuite::runProcessorCase(const juce::String& suite, const juce::String& subject, const std::vector<int>& slotChoices,
+                                      int routing, bool forceSlotOversampling, OversamplingSetting os,
+                                      double sampleRate, int blockSize, int channels)
+{
+    const auto id = makeId(suite, subject, sampleRate, blockSize, channels, os.getName());
+    if (!shouldRun(id)) return;
+
+    const int maxBlockSize = getMaxBlockSize(blockSize);
+    auto processor = std::make_unique<ModularMultiFxAudioProcessor>();
+    auto& apvts = processor->apvts;
+
+    processor->setVisibleSlotCount(ModularMultiFxAudioProcessor::maxSlots);
+    for (int i = 0; i < ModularMultiFxAudioProcessor::maxSlots; ++i)
+    {
+        const auto slotId = "SLOT_" + juce::String(i + 1);
+        setParameter(apvts, slotId + "_CHOICE", i < (int)slotChoices.size() ? (float)slotChoices[(size_t)i] : 0.0f);
+        setParameter(apvts, slotId + "_OS_MODE", forceSlotOversampling ? (float)SlotOversamplingMode::On : (float)SlotOversamplingMode::Auto);
+    }
+    setParameter(apvts, "ROUTING", (float)routing);
+    setParameter(apvts, "OVERSAMPLING_RATE", (float)os.rate);
+    setParameter(apvts, "OVERSAMPLING_ALGO", (float)os.algorithm);
+
+    // The first block picks up the oversampling parameters; preparing again then builds that
+    // context directly, instead of timing a crossfade from the builder thread's rebuild.
+    juce::AudioBuffer<float> silence(channels, maxBlockSize);
+    silence.clear();
+    juce::MidiBuffer midi;
+    processor->setPlayConfigDetails(channels, channels, sampleRate, maxBlockSize);
+    processor->prepareToPlay(sampleRate, maxBlockSize);
+    processor->processBlock(silence, midi);
+    processor->prepareToPlay(sampleRate, maxBlockSize);
+
+    // The builder pre-warms the offline context in the background; keep that out of the timing.
+    juce::Thread::sleep(settings.settleMilliseconds);
+
+    const auto measurement = measure(sampleRate, blockSize, channels,
+        [&](juce::AudioBuffer<float>& block) { processor->processBlock(block, midi); });
+
+    BenchmarkResult result{ id, suite, subject, sampleRate, blockSize, channels, os.getName() };
+    result.oversamplingLocked = processor->isOversamplingLocked();
+    result.nsPerSample = measurement.nsPerSample;
+    result.minNsPerSample = measurement.minNsPerSample;
+    result.latencySamples = processor->getLatencySamples();
+    report(result);
+
+    processor->releaseResources();
+}
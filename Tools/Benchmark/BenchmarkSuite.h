@@ -0,0 +1,124 @@
+//================================================================================
+// File: Tools/Benchmark/BenchmarkSuite.h
+//================================================================================
+#pragma once
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <functional>
+#include <vector>
+
+class ModularMultiFxAudioProcessor;
+
+// What to sweep and how long to measure each case for.
+struct BenchmarkSettings
+{
+    std::vector<double> sampleRates{ 44100.0, 48000.0, 96000.0, 192000.0 };
+    std::vector<int> blockSizes{ 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, randomBlockSize };
+    std::vector<int> channelCounts{ 1, 2 };
+    bool allOversamplingConfigs = true; // Otherwise a representative subset (see BenchmarkSuite.cpp)
+
+    static constexpr int randomBlockSize = 0; // Block sizes drawn from [16, randomMaxBlockSize]
+    int randomMaxBlockSize = 2048;
+
+    double warmupSeconds = 0.25;  // Processed before timing starts
+    double secondsPerRun = 1.0;   // Audio processed per timed run
+    int numRuns = 3;              // The median run is reported
+    int settleMilliseconds = 500; // Lets the processor's builder thread go idle before timing
+
+    juce::String filter; // Only cases whose ID contains this (case-insensitive) run
+
+    // A small grid for quick checks: one sample rate, three block sizes, stereo, fewer OS settings.
+    static BenchmarkSettings quick();
+};
+
+struct BenchmarkResult
+{
+    juce::String id;      // Unique per case; what baselines are matched on
+    juce::String suite;   // "module", "module_os", "chain"
+    juce::String subject; // Module or chain name
+    double sampleRate = 0.0;
+    int blockSize = 0;    // BenchmarkSettings::randomBlockSize for randomized sizes
+    int channels = 0;
+    juce::String oversampling; // "x1", "HQ x4", ... ("-" when not applicable)
+    bool oversamplingLocked = false; // ChromaTape capped the requested rate at x2
+
+    double nsPerSample = 0.0;    // Median run; per sample frame, all channels together
+    double minNsPerSample = 0.0; // Fastest run
+    double realtimeLoad = 0.0;   // Median run as a share of the real-time budget
+    int latencySamples = 0;
+
+    juce::var toVar() const;
+};
+
+/**
+ * Measures every FX module on its own and inside representative chains, in ns per sample frame.
+ *
+ * Suites:
+ * - module:    each module in a SlotHostProcessor (as the chain runs it, with control blocks),
+ *              plus the stand-alone BBDGranularEngine, over every sample rate, block size and
+ *              channel count.
+ * - module_os: each module alone in slot 1 of the full processor with oversampling forced on,
+ *              over every oversampling rate and algorithm (48 kHz, 512, stereo).
+ * - chain:     representative chains in the full processor, over every sample rate and
+ *              oversampling setting (512, stereo), then every block size and channel count
+ *              (48 kHz, the default HQ x4).
+ *
+ * The input is a fixed, seeded mix of tone, noise and bursts, so no module sleeps on silence and
+ * runs are comparable between machines and builds. Randomized block sizes use a fixed seed too.
+ */
+class BenchmarkSuite
+{
+public:
+    explicit BenchmarkSuite(BenchmarkSettings settingsToUse);
+    ~BenchmarkSuite();
+
+    // Runs every case that passes the filter, reporting each result as it completes.
+    std::vector<BenchmarkResult> run(const std::function<void(const BenchmarkResult&)>& onResult);
+
+private:
+    struct Measurement
+    {
+        double nsPerSample = 0.0, minNsPerSample = 0.0;
+    };
+
+    struct OversamplingSetting
+    {
+        int rate = 0;      // OVERSAMPLING_RATE index (0 = off)
+        int algorithm = 1; // OVERSAMPLING_ALGO index
+        juce::String getName() const;
+    };
+
+    struct ChainSpec
+    {
+        juce::String name;
+        std::vector<int> slotChoices; // SLOT_n_CHOICE values from slot 1
+        int routing = 0;              // ROUTING index
+    };
+
+    void runModuleSuite();
+    void runModuleOversamplingSuite();
+    void runChainSuite();
+    void runProcessorCase(const juce::String& suite, const juce::String& subject, const std::vector<int>& slotChoices,
+                          int routing, bool forceSlotOversampling, OversamplingSetting os,
+                          double sampleRate, int blockSize, int channels);
+
+    bool shouldRun(const juce::String& id) const;
+    void report(BenchmarkResult result);
+
+    using ProcessFunction = std::function<void(juce::AudioBuffer<float>&)>;
+    Measurement measure(double sampleRate, int blockSize, int channels, const ProcessFunction& process);
+
+    std::vector<OversamplingSetting> getOversamplingSettings() const;
+    static std::vector<ChainSpec> getChains();
+    static juce::String makeId(const juce::String& suite, const juce::String& subject, double sampleRate,
+                               int blockSize, int channels, const juce::String& oversampling);
+    int getMaxBlockSize(int blockSize) const noexcept;
+
+    BenchmarkSettings settings;
+    std::vector<BenchmarkResult> results;
+    std::function<void(const BenchmarkResult&)> resultCallback;
+
+    // Parameter source for the modules of the "module" suite (they read their slot's parameters).
+    std::unique_ptr<ModularMultiFxAudioProcessor> parameterHost;
+
+    JUCE_DECLARE_NON_COPYABLE(BenchmarkSuite)
+};
@@ -0,0 +1,155 @@
+//================================================================================
+// File: Tools/Benchmark/Main.cpp
+//================================================================================
+// Headless benchmark for the Tessera FX modules and chain (see BenchmarkSuite.h).
+//
+// Build as a JUCE console application from this folder plus every .cpp under Source/, linked
+// against juce_audio_processors, juce_dsp and juce_gui_extra (the plugin's editor is compiled in),
+// with JucePlugin_Name="Tessera" defined. Always benchmark a Release build.
+//
+// Usage:
+//   TesseraBenchmark [--quick] [--filter=<text>] [--seconds=<s>] [--runs=<n>]
+//                    [--output=<results.json>] [--baseline=<results.json>] [--tolerance=<ratio>]
+//
+// --quick      One sample rate, three block sizes, stereo, four oversampling settings.
+// --filter     Only cases whose ID contains the text, e.g. "chain/Guitar" or "/random/".
+// --output     Where to write the JSON results (default: bench_results.json).
+// --baseline   A previous results file. Each case is compared by ID; a case is a regression when
+//              its ns/sample grew by more than --tolerance (default 0.10, i.e. 10%). The exit code
+//              is 1 when anything regressed, so the tool can gate a CI job.
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_events/juce_events.h>
+#include <iostream>
+#include <map>
+#include "BenchmarkSuite.h"
+
+namespace
+{
+    juce::var createMachineInfo()
+    {
+        auto* machine = new juce::DynamicObject();
+        machine->setProperty("cpu", juce::SystemStats::getCpuModel());
+        machine->setProperty("cpuCores", juce::SystemStats::getNumPhysicalCpus());
+        machine->setProperty("cpuThreads", juce::SystemStats::getNumCpus());
+        machine->setProperty("os", juce::SystemStats::getOperatingSystemName());
+        machine->setProperty("juce", juce::SystemStats::getJUCEVersion());
+       #if JUCE_DEBUG
+        machine->setProperty("build", "Debug");
+       #else
+        machine->setProperty("build", "Release");
+       #endif
+        return juce::var(machine);
+    }
+
+    std::map<juce::String, double> loadBaseline(const juce::File& file)
+    {
+        std::map<juce::String, double> baseline;
+        const auto json = juce::JSON::parse(file);
+        if (const auto* cases = json["results"].getArray())
+            for (const auto& result : *cases)
+                baseline[result["id"].toString()] = (double)result["nsPerSample"];
+        return baseline;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // The processor posts to the message thread (oversampling lock notifications).
+    const juce::ScopedJuceInitialiser_GUI juceInitialiser;
+    const juce::ArgumentList args(argc, argv);
+
+    auto settings = args.containsOption("--quick") ? BenchmarkSettings::quick() : BenchmarkSettings{};
+    if (args.containsOption("--filter"))
+        settings.filter = args.getValueForOption("--filter");
+    if (args.containsOption("--seconds"))
+        settings.secondsPerRun = juce::jmax(0.01, args.getValueForOption("--seconds").getDoubleValue());
+    if (args.containsOption("--runs"))
+        settings.numRuns = juce::jmax(1, args.getValueForOption("--runs").getIntValue());
+
+    const auto outputFile = args.containsOption("--output") ? args.getFileForOption("--output")
+                                                            : juce::File::getCurrentWorkingDirectory().getChildFile("bench_results.json");
+    const double tolerance = args.containsOption("--tolerance") ? args.getValueForOption("--tolerance").getDoubleValue() : 0.10;
+
+    std::map<juce::String, double> baseline;
+    juce::File baselineFile;
+    if (args.containsOption("--baseline"))
+    {
+        baselineFile = args.getFileForOption("--baseline");
+        if (!baselineFile.existsAsFile())
+        {
+            std::cerr << "Baseline not found: " << baselineFile.getFullPathName() << std::endl;
+            return 2;
+        }
+        baseline = loadBaseline(baselineFile);
+    }
+
+   #if JUCE_DEBUG
+    std::cout << "Warning: debug build, timings are not representative." << std::endl;
+   #endif
+
+    int numRegressions = 0, numImprovements = 0, numCompared = 0;
+    juce::Array<juce::var> cases;
+
+    BenchmarkSuite suite(settings);
+    suite.run([&](const BenchmarkResult& result)
+        {
+            auto entry = result.toVar();
+            juce::String line = result.id.paddedRight(' ', 64) + juce::String(result.nsPerSample, 2).paddedLeft(' ', 10) + " ns/sample"
+                + juce::String(result.realtimeLoad * 100.0, 2).paddedLeft(' ', 9) + "% RT";
+
+            const auto reference = baseline.find(result.id);
+            if (reference != baseline.end() && reference->second > 0.0)
+            {
+                const double change = result.nsPerSample / reference->second - 1.0;
+                const bool regressed = change > tolerance;
+                entry.getDynamicObject()->setProperty("baselineNsPerSample", reference->second);
+                entry.getDynamicObject()->setProperty("change", change);
+                entry.getDynamicObject()->setProperty("regression", regressed);
+
+                ++numCompared;
+                if (regressed) ++numRegressions;
+                else if (change < -tolerance) ++numImprovements;
+                line << juce::String(change * 100.0, 1).paddedLeft(' ', 8) << "%" << (regressed ? "  REGRESSION" : "");
+            }
+
+            std::cout << line << std::endl;
+            cases.add(entry);
+        });
+
+    auto* root = new juce::DynamicObject();
+    root->setProperty("version", 1);
+    root->setProperty("timestamp", juce::Time::getCurrentTime().toISO8601(true));
+    root->setProperty("machine", createMachineInfo());
+
+    auto* config = new juce::DynamicObject();
+    config->setProperty("secondsPerRun", settings.secondsPerRun);
+    config->setProperty("runs", settings.numRuns);
+    config->setProperty("randomMaxBlockSize", settings.randomMaxBlockSize);
+    config->setProperty("filter", settings.filter);
+    root->setProperty("config", juce::var(config));
+
+    if (baselineFile != juce::File())
+    {
+        auto* comparison = new juce::DynamicObject();
+        comparison->setProperty("baseline", baselineFile.getFullPathName());
+        comparison->setProperty("tolerance", tolerance);
+        comparison->setProperty("compared", numCompared);
+        comparison->setProperty("regressions", numRegressions);
+        comparison->setProperty("improvements", numImprovements);
+        root->setProperty("comparison", juce::var(comparison));
+    }
+    root->setProperty("results", cases);
+
+    if (!outputFile.replaceWithText(juce::JSON::toString(juce::var(root))))
+    {
+        std::cerr << "Could not write " << outputFile.getFullPathName() << std::endl;
+        return 2;
+    }
+
+    std::cout << cases.size() << " cases written to " << outputFile.getFullPathName() << std::endl;
+    if (baselineFile != juce::File())
+        std::cout << numCompared << " compared with the baseline: " << numRegressions << " regressed, "
+                  << numImprovements << " improved (tolerance " << juce::String(tolerance * 100.0, 1) << "%)" << std::endl;
+
+    return numRegressions > 0 ? 1 : 0;
+}
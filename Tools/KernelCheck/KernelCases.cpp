@@ -0,0 +1,431 @@
+//================================================================================
+// File: Tools/KernelCheck/KernelCases.cpp
+//================================================================================
+// The kernel registry. Each case pairs a plain reference with the path the modules run; when a
+// kernel gets an optimized version, its case is added (or its optimized path swapped) here.
+#include "KernelCheck.h"
+#include <juce_dsp/juce_dsp.h>
+#include "../../Source/DSPUtils.h"
+#include "../../Source/DSP_Helpers/InterpolatedCircularBuffer.h"
+#include "../../Source/DSP_Helpers/ModalFilterBank.h"
+#include "../../Source/DSP_Helpers/SympatheticStringBank.h"
+#include "../../Source/DSP_Helpers/KarplusStrongVoicePool.h"
+#include "../../Source/DSP_Helpers/SpectralFeatureExtractor.h"
+#include <cmath>
+#include <memory>
+
+namespace
+{
+    //==============================================================================
+    // DSPUtils::fastTanh against std::tanh, over the full input range and on driven audio.
+    KernelCase makeFastTanhCase()
+    {
+        KernelCase kernel;
+        kernel.id = "dsp/fastTanh";
+        kernel.description = "Pade tanh approximation, hard-clipped beyond +-4.97";
+        kernel.maxAbsError = 0.035; // Worst at the clip point, where the rational form overshoots 1
+        kernel.makeInput = [](std::vector<float>& input)
+        {
+            // First half sweeps [-8, 8]; second half is the test signal at +24 dB of drive.
+            KernelCheck::fillTestSignal(input);
+            const size_t half = input.size() / 2;
+            for (size_t i = 0; i < half; ++i)
+                input[i] = -8.0f + 16.0f * (float)i / (float)half;
+            for (size_t i = half; i < input.size(); ++i)
+                input[i] *= 16.0f;
+        };
+        kernel.reference = [](const std::vector<float>& input, std::vector<float>& output)
+        {
+            output.resize(input.size());
+            for (size_t i = 0; i < input.size(); ++i)
+                output[i] = (float)std::tanh((double)input[i]);
+        };
+        kernel.optimized = [](const std::vector<float>& input, std::vector<float>& output)
+        {
+            output.resize(input.size());
+            for (size_t i = 0; i < input.size(); ++i)
+                output[i] = DSPUtils::fastTanh(input[i]);
+        };
+        return kernel;
+    }
+
+    //==============================================================================
+    // InterpolatedCircularBuffer::read against a double-precision cubic over a plain ring, with a
+    // modulated delay (as the delays and the tape use it). Positions are passed as the same float
+    // to both, so only the kernel's own arithmetic (fmod, margins, float cubic) is measured.
+    constexpr int delayBufferSize = 48000;
+
+    float getModulatedReadPosition(int writePosition, size_t sample)
+    {
+        const double delay = 1200.0 + 900.0 * std::sin(juce::MathConstants<double>::twoPi * 0.7 * (double)sample / KernelCheck::sampleRate);
+        return (float)((double)writePosition - delay);
+    }
+
+    KernelCase makeCircularBufferReadCase()
+    {
+        KernelCase kernel;
+        kernel.id = "buffer/InterpolatedCircularBuffer.read";
+        kernel.description = "Cubic fractional read from the margin-padded circular buffer";
+        kernel.maxAbsError = 1.0e-5;
+        kernel.reference = [](const std::vector<float>& input, std::vector<float>& output)
+        {
+            std::vector<double> ring((size_t)delayBufferSize, 0.0);
+            output.resize(input.size());
+            int writePosition = 0;
+            for (size_t i = 0; i < input.size(); ++i)
+            {
+                ring[(size_t)writePosition] = input[i];
+
+                double position = std::fmod((double)getModulatedReadPosition(writePosition, i), (double)delayBufferSize);
+                if (position < 0.0) position += delayBufferSize;
+                const int i0 = (int)std::floor(position);
+                const double t = position - i0;
+                auto at = [&](int index) { return ring[(size_t)((index % delayBufferSize + delayBufferSize) % delayBufferSize)]; };
+                const double ym1 = at(i0 - 1), y0 = at(i0), y1 = at(i0 + 1), y2 = at(i0 + 2);
+
+                // Catmull-Rom, written out term by term
+                const double c1 = 0.5 * (y1 - ym1);
+                const double c2 = ym1 - 2.5 * y0 + 2.0 * y1 - 0.5 * y2;
+                const double c3 = 0.5 * (y2 - ym1) + 1.5 * (y0 - y1);
+                output[i] = (float)(y0 + t * (c1 + t * (c2 + t * c3)));
+
+                writePosition = (writePosition + 1) % delayBufferSize;
+            }
+        };
+
+        auto buffer = std::make_shared<InterpolatedCircularBuffer>();
+        buffer->prepare({ KernelCheck::sampleRate, 512, 1 }, delayBufferSize);
+        kernel.optimized = [buffer](const std::vector<float>& input, std::vector<float>& output)
+        {
+            buffer->reset();
+            output.resize(input.size());
+            for (size_t i = 0; i < input.size(); ++i)
+            {
+                const int writePosition = buffer->getWritePosition();
+                buffer->writeSample(0, input[i]);
+                output[i] = buffer->read(0, getModulatedReadPosition(writePosition, i));
+                buffer->advanceWritePosition();
+            }
+        };
+        return kernel;
+    }
+
+    //==============================================================================
+    // SpectralFeatureExtractor's frame features against a double-precision pass over JUCE's FFT
+    // of each windowed frame (the frames MorphoComp and the resonator's onset detection see). The
+    // extractor is fed a frame, then a hop at a time; five features per frame are compared.
+    using Features = SpectralFeatureExtractor::Features;
+
+    void appendFeatures(const Features& features, std::vector<float>& output)
+    {
+        for (float value : { features.centroid, features.flux, features.rolloff, features.flatness, features.rms })
+            output.push_back(value);
+    }
+
+    KernelCase makeSpectralFeaturesCase()
+    {
+        using Extractor = SpectralFeatureExtractor;
+
+        KernelCase kernel;
+        kernel.id = "stft/SpectralFeatureExtractor";
+        kernel.description = "Centroid, flux, rolloff, flatness and RMS per 512-point frame";
+        kernel.maxAbsError = 1.0 / 256.0 + 1.0e-4; // A rolloff within rounding of a bin edge lands one bin over
+        kernel.outputIsAudio = false;
+
+        kernel.reference = [](const std::vector<float>& input, std::vector<float>& output)
+        {
+            juce::dsp::FFT fft(Extractor::FFT_ORDER);
+            juce::dsp::WindowingFunction<float> window((size_t)Extractor::FFT_SIZE, juce::dsp::WindowingFunction<float>::hann);
+            std::vector<float> frame((size_t)Extractor::FFT_SIZE * 2);
+            std::vector<double> power((size_t)Extractor::NUM_BINS), magnitude((size_t)Extractor::NUM_BINS), lastMagnitude((size_t)Extractor::NUM_BINS, 0.0);
+
+            std::vector<float> unitFrame((size_t)Extractor::FFT_SIZE, 1.0f);
+            window.multiplyWithWindowingTable(unitFrame.data(), unitFrame.size());
+            double windowPower = 0.0;
+            for (float w : unitFrame) windowPower += (double)w * w;
+
+            const int nyquistBin = Extractor::NUM_BINS - 1;
+            Features features;
+            output.clear();
+            for (size_t start = 0; start + Extractor::FFT_SIZE <= input.size(); start += Extractor::HOP_SIZE)
+            {
+                std::copy_n(input.begin() + (std::ptrdiff_t)start, Extractor::FFT_SIZE, frame.begin());
+                window.multiplyWithWindowingTable(frame.data(), (size_t)Extractor::FFT_SIZE);
+                fft.performRealOnlyForwardTransform(frame.data(), true);
+
+                double powerSum = 0.0, flux = 0.0;
+                for (size_t k = 0; k < power.size(); ++k)
+                {
+                    const double re = frame[2 * k], im = frame[2 * k + 1];
+                    power[k] = re * re + im * im;
+                    magnitude[k] = std::sqrt(power[k]);
+                    powerSum += power[k];
+                    flux += std::max(0.0, magnitude[k] - lastMagnitude[k]);
+                }
+                lastMagnitude = magnitude;
+
+                features.flux = (float)juce::jlimit(0.0, 1.0, flux / 5.0);
+                features.rms = (float)std::sqrt((2.0 * powerSum - power[0] - power[(size_t)nyquistBin]) / Extractor::FFT_SIZE / windowPower);
+
+                double bandMagnitude = 0.0, weighted = 0.0, logSum = 0.0;
+                for (int k = 1; k <= nyquistBin; ++k)
+                {
+                    bandMagnitude += magnitude[(size_t)k];
+                    weighted += k * magnitude[(size_t)k];
+                    logSum += std::log2(power[(size_t)k] + 1.0e-12);
+                }
+                if (bandMagnitude > 1.0e-6)
+                {
+                    const double bandPower = powerSum - power[0];
+                    features.centroid = (float)juce::jlimit(0.0, 1.0, weighted / bandMagnitude / nyquistBin);
+                    features.flatness = (float)juce::jlimit(0.0, 1.0, std::exp2(logSum / nyquistBin) / (bandPower / nyquistBin + 1.0e-12));
+
+                    double cumulative = 0.0;
+                    int bin = 1;
+                    for (; bin < nyquistBin; ++bin)
+                        if ((cumulative += power[(size_t)bin]) >= Extractor::ROLLOFF_SHARE * bandPower) break;
+                    features.rolloff = (float)bin / (float)nyquistBin;
+                }
+                appendFeatures(features, output);
+            }
+        };
+
+        auto extractor = std::make_shared<Extractor>();
+        extractor->prepare({ KernelCheck::sampleRate, (juce::uint32)Extractor::FFT_SIZE, 1 });
+        kernel.optimized = [extractor](const std::vector<float>& input, std::vector<float>& output)
+        {
+            extractor->reset();
+            output.clear();
+            size_t position = 0;
+            for (size_t length = Extractor::FFT_SIZE; position + length <= input.size(); length = Extractor::HOP_SIZE)
+            {
+                const float* in = input.data() + position;
+                extractor->process(juce::dsp::AudioBlock<const float>(&in, 1, length));
+                appendFeatures(extractor->getFrameFeatures(), output);
+                position += length;
+            }
+        };
+        return kernel;
+    }
+
+    //==============================================================================
+    // ModalFilterBank against one IIR::Filter per mode with makeBandPass() coefficients (what
+    // the modal resonator ran before the bank), at fixed parameters. Modes are spread log-wise
+    // from 40 Hz to 20 kHz with a spread of Qs, so both low, sharp and high modes are covered.
+    struct ModeSet
+    {
+        std::vector<float> freqs, qs, gains;
+    };
+
+    ModeSet makeModeSet(int numModes)
+    {
+        ModeSet modes;
+        for (int m = 0; m < numModes; ++m)
+        {
+            modes.freqs.push_back(40.0f * std::pow(2.0f, 9.0f * (float)m / (float)numModes));
+            modes.qs.push_back(30.0f + 60.0f * (float)(m % 20));
+            modes.gains.push_back(1.0f / (1.0f + 0.05f * (float)m));
+        }
+        return modes;
+    }
+
+    KernelCase makeModalBankCase(int numModes)
+    {
+        KernelCase kernel;
+        kernel.id = "modal/ModalFilterBank." + juce::String(numModes);
+        kernel.description = juce::String(numModes) + " band-pass modes, summed";
+        kernel.maxAbsError = 1.0e-4; // The reference rounds its coefficients in float; ~1e-5 is typical
+        kernel.numSamples = 1 << 16;
+
+        using Filter = juce::dsp::IIR::Filter<float>;
+        const auto modes = std::make_shared<ModeSet>(makeModeSet(numModes));
+        auto filters = std::make_shared<std::vector<Filter>>((size_t)numModes);
+        for (int m = 0; m < numModes; ++m)
+        {
+            auto& filter = (*filters)[(size_t)m];
+            filter.coefficients = juce::dsp::IIR::Coefficients<float>::makeBandPass(KernelCheck::sampleRate, modes->freqs[(size_t)m], modes->qs[(size_t)m]);
+            filter.prepare({ KernelCheck::sampleRate, 512, 1 });
+        }
+        kernel.reference = [modes, filters](const std::vector<float>& input, std::vector<float>& output)
+        {
+            for (auto& filter : *filters) filter.reset();
+            output.resize(input.size());
+            for (size_t i = 0; i < input.size(); ++i)
+            {
+                float sum = 0.0f;
+                for (size_t m = 0; m < filters->size(); ++m)
+                    sum += (*filters)[m].processSample(input[i]) * modes->gains[m];
+                output[i] = sum;
+            }
+        };
+
+        auto bank = std::make_shared<ModalFilterBank>();
+        bank->prepare(KernelCheck::sampleRate, 1, numModes);
+        kernel.optimized = [modes, bank](const std::vector<float>& input, std::vector<float>& output)
+        {
+            bank->reset();
+            bank->setModes(modes->freqs.data(), modes->qs.data(), modes->gains.data(), (int)modes->freqs.size());
+            output.resize(input.size());
+            const float* in = input.data();
+            float* out = output.data();
+            juce::dsp::AudioBlock<float> outputBlock(&out, 1, output.size());
+            bank->process(juce::dsp::AudioBlock<const float>(&in, 1, input.size()), outputBlock);
+        };
+        return kernel;
+    }
+
+    //==============================================================================
+    // SympatheticStringBank against the sympathetic resonator's former per-string loop: a linear
+    // DelayLine and a FirstOrderTPTFilter per string, coupled through the summed feedback of the
+    // previous sample. Six strings on the fifths tuning at 220 Hz, with the resonator's coupling.
+    // The string count is set either before prepare() (as the resonator's prepare does) or after.
+    constexpr int sympatheticStrings = 6;
+    constexpr float sympatheticCutoff = 6000.0f, sympatheticFeedback = 0.9f, sympatheticCoupling = -0.1f;
+
+    std::vector<float> makeSympatheticDelays()
+    {
+        const float ratios[sympatheticStrings] = { 1.0f, 1.5f, 2.0f, 3.0f, 0.5f, 0.75f };
+        std::vector<float> delays;
+        for (float ratio : ratios)
+            delays.push_back((float)KernelCheck::sampleRate / (220.0f * ratio));
+        return delays;
+    }
+
+    KernelCase makeSympatheticBankCase(bool setCountBeforePrepare)
+    {
+        KernelCase kernel;
+        kernel.id = juce::String("strings/SympatheticStringBank.") + (setCountBeforePrepare ? "countFirst" : "prepareFirst");
+        kernel.description = "Six coupled linear-delay strings with one-pole damping";
+        kernel.maxAbsError = 1.0e-4; // Sums run in a different order; the feedback carries the rounding
+        kernel.numSamples = 1 << 16;
+
+        const auto delays = std::make_shared<std::vector<float>>(makeSympatheticDelays());
+        kernel.reference = [delays](const std::vector<float>& input, std::vector<float>& output)
+        {
+            using Delay = juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Linear>;
+            std::vector<Delay> lines((size_t)sympatheticStrings);
+            std::vector<juce::dsp::FirstOrderTPTFilter<float>> filters((size_t)sympatheticStrings);
+            std::vector<float> feedback((size_t)sympatheticStrings, 0.0f);
+            for (size_t s = 0; s < lines.size(); ++s)
+            {
+                lines[s].setMaximumDelayInSamples(4096);
+                lines[s].prepare({ KernelCheck::sampleRate, 512, 1 });
+                lines[s].setDelay((*delays)[s]);
+                filters[s].prepare({ KernelCheck::sampleRate, 512, 1 });
+                filters[s].setCutoffFrequency(sympatheticCutoff);
+            }
+
+            output.resize(input.size());
+            float summedFeedback = 0.0f;
+            for (size_t i = 0; i < input.size(); ++i)
+            {
+                float acc = 0.0f, currentSummedFeedback = 0.0f;
+                for (size_t s = 0; s < lines.size(); ++s)
+                {
+                    const float damped = filters[s].processSample(0, lines[s].popSample(0));
+                    lines[s].pushSample(0, input[i] + feedback[s] + summedFeedback * sympatheticCoupling);
+                    feedback[s] = damped * sympatheticFeedback;
+                    currentSummedFeedback += feedback[s];
+                    acc += damped;
+                }
+                summedFeedback = currentSummedFeedback;
+                output[i] = acc;
+            }
+        };
+
+        auto bank = std::make_shared<SympatheticStringBank>();
+        if (setCountBeforePrepare)
+        {
+            bank->setNumStrings(sympatheticStrings);
+            bank->prepare(KernelCheck::sampleRate, 4096);
+        }
+        else
+        {
+            bank->prepare(KernelCheck::sampleRate, 4096);
+            bank->setNumStrings(sympatheticStrings);
+        }
+        kernel.optimized = [delays, bank](const std::vector<float>& input, std::vector<float>& output)
+        {
+            bank->reset();
+            bank->setParameters(delays->data(), sympatheticCutoff, sympatheticFeedback, sympatheticCoupling);
+            output.resize(input.size());
+            bank->process(input.data(), output.data(), nullptr, (int)input.size());
+        };
+        return kernel;
+    }
+
+    //==============================================================================
+    // KarplusStrongVoicePool against the string resonator's former loop: a Lagrange DelayLine
+    // shortened by the filters' phase delay, a FirstOrderTPTFilter and two IIR all-passes. One
+    // drone voice at 220 Hz, so the pool runs the old single-string path at fixed settings.
+    constexpr float karplusFrequency = 220.0f, karplusCutoff = 8000.0f, karplusDispersion = 0.2f, karplusFeedback = 0.995f;
+
+    KernelCase makeKarplusStrongCase()
+    {
+        KernelCase kernel;
+        kernel.id = "strings/KarplusStrongVoicePool";
+        kernel.description = "One drone Karplus-Strong string with dispersion all-passes";
+        kernel.maxAbsError = 1.0e-4; // The all-pass coefficients and Lagrange weights round differently
+        kernel.numSamples = 1 << 16;
+
+        kernel.reference = [](const std::vector<float>& input, std::vector<float>& output)
+        {
+            const auto sr = KernelCheck::sampleRate;
+            const juce::dsp::ProcessSpec spec{ sr, 512, 1 };
+            juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Lagrange3rd> line;
+            line.setMaximumDelayInSamples(4096);
+            line.prepare(spec);
+            juce::dsp::FirstOrderTPTFilter<float> lowpass;
+            lowpass.prepare(spec);
+            lowpass.setCutoffFrequency(karplusCutoff);
+            juce::dsp::IIR::Filter<float> allpass1, allpass2;
+            allpass1.coefficients = juce::dsp::IIR::Coefficients<float>::makeAllPass(sr, juce::jmap(karplusDispersion, 0.25f, 0.5f) * (float)sr);
+            allpass2.coefficients = juce::dsp::IIR::Coefficients<float>::makeAllPass(sr, juce::jmap(karplusDispersion, 0.1f, 0.25f) * (float)sr);
+            allpass1.prepare(spec);
+            allpass2.prepare(spec);
+
+            const float phaseDelay = std::atan(karplusCutoff / ((float)sr * 0.5f)) / juce::MathConstants<float>::pi + karplusDispersion * 4.0f;
+            line.setDelay(juce::jmax(1.0f, (float)sr / karplusFrequency - phaseDelay));
+
+            output.resize(input.size());
+            float feedback = 0.0f;
+            for (size_t i = 0; i < input.size(); ++i)
+            {
+                const float damped = lowpass.processSample(0, line.popSample(0));
+                const float dispersed = allpass2.processSample(allpass1.processSample(damped));
+                line.pushSample(0, input[i] + feedback);
+                feedback = dispersed * karplusFeedback;
+                output[i] = dispersed * 0.8f;
+            }
+        };
+
+        auto pool = std::make_shared<KarplusStrongVoicePool>();
+        pool->prepare(KernelCheck::sampleRate, 1, 4096);
+        kernel.optimized = [pool](const std::vector<float>& input, std::vector<float>& output)
+        {
+            pool->reset();
+            pool->setParameters(karplusCutoff, karplusDispersion, karplusFeedback);
+            pool->setDrone(karplusFrequency);
+            output.resize(input.size());
+            const float* in = input.data();
+            float* out = output.data();
+            juce::dsp::AudioBlock<float> outputBlock(&out, 1, output.size());
+            pool->process(juce::dsp::AudioBlock<const float>(&in, 1, input.size()), outputBlock);
+        };
+        return kernel;
+    }
+}
+
+std::vector<KernelCase> createKernelCases()
+{
+    std::vector<KernelCase> cases;
+    cases.push_back(makeFastTanhCase());
+    cases.push_back(makeCircularBufferReadCase());
+    cases.push_back(makeSpectralFeaturesCase());
+    cases.push_back(makeModalBankCase(60));  // The modal resonator's mode count
+    cases.push_back(makeModalBankCase(240)); // Headroom for denser material models
+    cases.push_back(makeSympatheticBankCase(true));
+    cases.push_back(makeSympatheticBankCase(false));
+    cases.push_back(makeKarplusStrongCase());
+    return cases;
+}
@@ -0,0 +1,186 @@
+//================================================================================
+// File: Tools/KernelCheck/KernelCheck.cpp
+//================================================================================
+#include "KernelCheck.h"
+#include <juce_dsp/juce_dsp.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    constexpr int spectrumOrder = 11; // 2048-point frames, half overlapped
+    constexpr int spectrumSize = 1 << spectrumOrder;
+    constexpr int numOctaves = 10;    // Down from Nyquist: 12-24 kHz ... 23-47 Hz at 48 kHz
+    constexpr double silenceDb = -200.0;
+
+    double toDb(double amplitude)
+    {
+        return amplitude > 0.0 ? juce::jmax(silenceDb, 20.0 * std::log10(amplitude)) : silenceDb;
+    }
+}
+
+juce::var KernelResult::toVar() const
+{
+    auto* object = new juce::DynamicObject();
+    object->setProperty("id", id);
+    object->setProperty("tolerance", tolerance);
+    object->setProperty("maxAbsError", maxAbsError);
+    object->setProperty("maxErrorIndex", maxErrorIndex);
+    object->setProperty("rmsError", rmsError);
+
+    juce::Array<juce::var> bands;
+    for (const auto& band : errorSpectrum)
+    {
+        auto* entry = new juce::DynamicObject();
+        entry->setProperty("hz", band.centreHz);
+        entry->setProperty("db", band.levelDb);
+        bands.add(juce::var(entry));
+    }
+    object->setProperty("errorSpectrum", bands);
+
+    object->setProperty("referenceNsPerSample", referenceNsPerSample);
+    object->setProperty("optimizedNsPerSample", optimizedNsPerSample);
+    object->setProperty("speedup", speedup);
+    object->setProperty("passed", passed);
+    return juce::var(object);
+}
+
+//==============================================================================
+KernelCheck::KernelCheck(Settings settingsToUse)
+    : settings(std::move(settingsToUse))
+{
+}
+
+void KernelCheck::fillTestSignal(std::vector<float>& signal)
+{
+    juce::Random random(1234);
+    const int burstPeriod = (int)(sampleRate * 0.25);
+    const double toneIncrement = juce::MathConstants<double>::twoPi * 220.0 / sampleRate;
+
+    for (size_t i = 0; i < signal.size(); ++i)
+    {
+        const float burst = std::exp(-(float)((int)i % burstPeriod) / (float)(sampleRate * 0.02));
+        const float noise = random.nextFloat() * 2.0f - 1.0f;
+        signal[i] = 0.5f * (float)std::sin(toneIncrement * (double)i) + noise * (0.05f + 0.45f * burst);
+    }
+}
+
+std::vector<KernelResult> KernelCheck::run(const std::function<void(const KernelResult&)>& onResult)
+{
+    std::vector<KernelResult> results;
+    for (const auto& kernel : createKernelCases())
+    {
+        if (settings.filter.isNotEmpty() && !kernel.id.containsIgnoreCase(settings.filter))
+            continue;
+
+        results.push_back(runCase(kernel));
+        if (onResult) onResult(results.back());
+    }
+    return results;
+}
+
+KernelResult KernelCheck::runCase(const KernelCase& kernel)
+{
+    std::vector<float> input((size_t)kernel.numSamples);
+    if (kernel.makeInput) kernel.makeInput(input);
+    else fillTestSignal(input);
+
+    KernelResult result;
+    result.id = kernel.id;
+    result.tolerance = kernel.maxAbsError;
+
+    std::vector<float> referenceOutput, optimizedOutput;
+    result.referenceNsPerSample = timePath(kernel.reference, input, referenceOutput);
+    result.optimizedNsPerSample = timePath(kernel.optimized, input, optimizedOutput);
+    result.speedup = result.optimizedNsPerSample > 0.0 ? result.referenceNsPerSample / result.optimizedNsPerSample : 0.0;
+
+    // Outputs of different lengths are a broken case, never a pass.
+    if (referenceOutput.size() != optimizedOutput.size() || referenceOutput.empty())
+    {
+        jassertfalse;
+        result.maxAbsError = std::numeric_limits<double>::infinity();
+        return result;
+    }
+
+    std::vector<double> error(referenceOutput.size());
+    double sumSquares = 0.0;
+    bool finite = true;
+    for (size_t i = 0; i < error.size(); ++i)
+    {
+        error[i] = (double)optimizedOutput[i] - (double)referenceOutput[i];
+        finite = finite && std::isfinite(error[i]);
+        const double magnitude = std::abs(error[i]);
+        if (magnitude > result.maxAbsError)
+        {
+            result.maxAbsError = magnitude;
+            result.maxErrorIndex = (int)i;
+        }
+        sumSquares += error[i] * error[i];
+    }
+    result.rmsError = std::sqrt(sumSquares / (double)error.size());
+    if (kernel.outputIsAudio)
+        result.errorSpectrum = computeErrorSpectrum(error);
+
+    result.passed = finite && result.maxAbsError <= kernel.maxAbsError;
+    return result;
+}
+
+double KernelCheck::timePath(const KernelCase::Path& path, const std::vector<float>& input, std::vector<float>& output) const
+{
+    path(input, output); // Warm-up: caches, lazily built tables, first-touch of the output
+
+    std::vector<double> runs;
+    for (int run = 0; run < juce::jmax(1, settings.numRuns); ++run)
+    {
+        const auto start = juce::Time::getHighResolutionTicks();
+        path(input, output);
+        const auto ticks = juce::Time::getHighResolutionTicks() - start;
+        runs.push_back(juce::Time::highResolutionTicksToSeconds(ticks) * 1.0e9 / (double)input.size());
+    }
+
+    std::sort(runs.begin(), runs.end());
+    return runs[runs.size() / 2];
+}
+
+// Averaged, Hann-windowed power spectrum of the error, reduced to the loudest bin of each octave.
+std::vector<KernelResult::Band> KernelCheck::computeErrorSpectrum(const std::vector<double>& error)
+{
+    juce::dsp::FFT fft(spectrumOrder);
+    std::vector<float> window((size_t)spectrumSize), frame((size_t)spectrumSize * 2);
+    juce::dsp::WindowingFunction<float>::fillWindowingTables(window.data(), (size_t)spectrumSize,
+                                                             juce::dsp::WindowingFunction<float>::hann, false);
+    double windowSum = 0.0;
+    for (auto w : window) windowSum += w;
+
+    // The error is mostly tiny; scaling up before the float FFT keeps it well above its rounding.
+    double peak = 0.0;
+    for (auto e : error) peak = juce::jmax(peak, std::abs(e));
+
+    std::vector<double> power((size_t)spectrumSize / 2 + 1, 0.0);
+    int numFrames = 0;
+    for (size_t start = 0; peak > 0.0 && start + spectrumSize <= error.size(); start += spectrumSize / 2, ++numFrames)
+    {
+        std::fill(frame.begin(), frame.end(), 0.0f);
+        for (int i = 0; i < spectrumSize; ++i)
+            frame[(size_t)i] = (float)(error[start + (size_t)i] / peak) * window[(size_t)i];
+        fft.performFrequencyOnlyForwardTransform(frame.data(), true);
+        for (size_t bin = 0; bin < power.size(); ++bin)
+            power[bin] += (double)frame[bin] * (double)frame[bin];
+    }
+
+    // Amplitude of a sine that would produce the bin's average magnitude.
+    std::vector<KernelResult::Band> bands;
+    const double binHz = sampleRate / spectrumSize;
+    for (int octave = numOctaves - 1; octave >= 0; --octave)
+    {
+        const double high = sampleRate * 0.5 / std::pow(2.0, octave);
+        const double low = high * 0.5;
+        double loudest = 0.0;
+        for (size_t bin = (size_t)std::ceil(low / binHz); bin <= (size_t)std::floor(high / binHz) && bin < power.size(); ++bin)
+            if (numFrames > 0)
+                loudest = juce::jmax(loudest, std::sqrt(power[bin] / numFrames) * 2.0 / windowSum);
+        bands.push_back({ std::sqrt(low * high), toDb(loudest * peak) });
+    }
+    return bands;
+}
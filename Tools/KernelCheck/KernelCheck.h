@@ -0,0 +1,93 @@
+//================================================================================
+// File: Tools/KernelCheck/KernelCheck.h
+//================================================================================
+#pragma once
+#include <juce_core/juce_core.h>
+#include <functional>
+#include <vector>
+
+/**
+ * One hot kernel with two implementations that must agree: a plain scalar reference (double
+ * precision where that matters) and the optimized path the modules actually run.
+ *
+ * Both paths get the same deterministic input and write their output into the vector they are
+ * given (same length for both). A path must not depend on any earlier call: stateful kernels
+ * reset or rebuild their state at the start, because every path runs several times for timing.
+ */
+struct KernelCase
+{
+    using Path = std::function<void(const std::vector<float>& input, std::vector<float>& output)>;
+
+    juce::String id;          // "group/kernel"; what --filter matches
+    juce::String description;
+    double maxAbsError = 0.0; // The case fails above this
+    bool outputIsAudio = true; // Whether the error spectrum means anything (false for e.g. FFT bins)
+
+    int numSamples = 1 << 18; // Input length (at KernelCheck::sampleRate)
+    std::function<void(std::vector<float>&)> makeInput; // Defaults to KernelCheck::fillTestSignal
+    Path reference, optimized;
+};
+
+struct KernelResult
+{
+    struct Band
+    {
+        double centreHz = 0.0;
+        double levelDb = 0.0; // Loudest error component in the octave, as a sine level in dBFS
+    };
+
+    juce::String id;
+    double tolerance = 0.0;
+    double maxAbsError = 0.0;
+    int maxErrorIndex = 0;     // Output sample with the largest error
+    double rmsError = 0.0;
+    std::vector<Band> errorSpectrum; // Octave bands, low to high; empty if the output is not audio
+
+    double referenceNsPerSample = 0.0; // Median run, per input sample
+    double optimizedNsPerSample = 0.0;
+    double speedup = 0.0;              // reference / optimized
+
+    bool passed = false;
+
+    juce::var toVar() const;
+};
+
+/**
+ * Equivalence harness: runs every registered kernel case, compares the optimized output with the
+ * reference output sample by sample, and times both paths.
+ *
+ * A case passes when the largest absolute error stays within its tolerance. The error spectrum
+ * shows where the remaining error sits (a broadband floor is rounding; a peak is usually a bug
+ * or an approximation that aliases). New optimized kernels register a case in KernelCases.cpp.
+ */
+class KernelCheck
+{
+public:
+    static constexpr double sampleRate = 48000.0;
+
+    struct Settings
+    {
+        int numRuns = 5;     // Timed runs per path; the median is reported
+        juce::String filter; // Only cases whose ID contains this (case-insensitive) run
+    };
+
+    explicit KernelCheck(Settings settingsToUse);
+
+    // Runs every case that passes the filter, reporting each result as it completes.
+    std::vector<KernelResult> run(const std::function<void(const KernelResult&)>& onResult);
+
+    // Tone, noise and decaying bursts in [-1, 1], from a fixed seed.
+    static void fillTestSignal(std::vector<float>& signal);
+
+private:
+    KernelResult runCase(const KernelCase& kernel);
+    double timePath(const KernelCase::Path& path, const std::vector<float>& input, std::vector<float>& output) const;
+    static std::vector<KernelResult::Band> computeErrorSpectrum(const std::vector<double>& error);
+
+    Settings settings;
+
+    JUCE_DECLARE_NON_COPYABLE(KernelCheck)
+};
+
+// Every kernel the harness knows about (KernelCases.cpp).
+std::vector<KernelCase> createKernelCases();
@@ -0,0 +1,82 @@
+//================================================================================
+// File: Tools/KernelCheck/Main.cpp
+//================================================================================
+// Reference-vs-optimized equivalence check for the hot DSP kernels (see KernelCheck.h).
+//
+// Build as a JUCE console application from this folder, linked against juce_dsp (and the modules it needs).
+// Error figures do not depend on the build type; speedups are only meaningful in Release.
+//
+// Usage:
+//   TesseraKernelCheck [--filter=<text>] [--runs=<n>] [--output=<results.json>]
+//
+// --filter   Only kernels whose ID contains the text, e.g. "stft/".
+// --runs     Timed runs per path (default 5); the median is reported.
+// --output   Where to write the JSON results, error spectra included (default: kernel_check.json).
+//
+// The exit code is 1 when any kernel exceeds its error tolerance, so the tool can gate a CI job.
+#include <juce_core/juce_core.h>
+#include <iostream>
+#include "KernelCheck.h"
+
+int main(int argc, char* argv[])
+{
+    const juce::ArgumentList args(argc, argv);
+
+    KernelCheck::Settings settings;
+    if (args.containsOption("--filter"))
+        settings.filter = args.getValueForOption("--filter");
+    if (args.containsOption("--runs"))
+        settings.numRuns = juce::jmax(1, args.getValueForOption("--runs").getIntValue());
+
+    const auto outputFile = args.containsOption("--output") ? args.getFileForOption("--output")
+                                                            : juce::File::getCurrentWorkingDirectory().getChildFile("kernel_check.json");
+
+   #if JUCE_DEBUG
+    std::cout << "Warning: debug build, speedups are not representative." << std::endl;
+   #endif
+
+    int numFailed = 0;
+    juce::Array<juce::var> cases;
+
+    KernelCheck check(settings);
+    check.run([&](const KernelResult& result)
+        {
+            // The loudest octave of the error, to tell a rounding floor from a localised error.
+            juce::String worstBand = "-";
+            if (!result.errorSpectrum.empty())
+            {
+                auto worst = result.errorSpectrum.front();
+                for (const auto& band : result.errorSpectrum)
+                    if (band.levelDb > worst.levelDb) worst = band;
+                worstBand = juce::String(worst.levelDb, 1) + " dB @ " + juce::String(juce::roundToInt(worst.centreHz)) + " Hz";
+            }
+
+            std::cout << result.id.paddedRight(' ', 44)
+                      << (" max " + juce::String(result.maxAbsError, 9)).paddedRight(' ', 18)
+                      << (" rms " + juce::String(result.rmsError, 9)).paddedRight(' ', 18)
+                      << (" worst " + worstBand).paddedRight(' ', 30)
+                      << juce::String(result.speedup, 2).paddedLeft(' ', 8) << "x"
+                      << (result.passed ? "  ok" : "  FAIL (tolerance " + juce::String(result.tolerance, 9) + ")") << std::endl;
+
+            if (!result.passed) ++numFailed;
+            cases.add(result.toVar());
+        });
+
+    auto* root = new juce::DynamicObject();
+    root->setProperty("version", 1);
+    root->setProperty("timestamp", juce::Time::getCurrentTime().toISO8601(true));
+    root->setProperty("cpu", juce::SystemStats::getCpuModel());
+    root->setProperty("sampleRate", KernelCheck::sampleRate);
+    root->setProperty("runs", settings.numRuns);
+    root->setProperty("failed", numFailed);
+    root->setProperty("results", cases);
+
+    if (!outputFile.replaceWithText(juce::JSON::toString(juce::var(root))))
+    {
+        std::cerr << "Could not write " << outputFile.getFullPathName() << std::endl;
+        return 2;
+    }
+
+    std::cout << cases.size() << " kernels checked, " << numFailed << " failed; results in " << outputFile.getFullPathName() << std::endl;
+    return numFailed > 0 ? 1 : 0;
+}